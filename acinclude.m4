@@ -7,6 +7,11 @@ AC_DEFUN([AX_LIBESEDB_CHECK_LOCAL],
   [dnl Check for internationalization functions in libesedb/libesedb_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
 
+  dnl Headers and functions included in libesedb/libesedb_io_handle.c
+  AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+  AC_CHECK_FUNCS([mmap munmap])
+
   dnl Check if library should be build with verbose output
   AX_COMMON_CHECK_ENABLE_VERBOSE_OUTPUT
 
@@ -119,3 +119,103 @@ int esedbtools_system_string_copy_from_64_bit_in_decimal(
 	return( 1 );
 }
 
+/* Copies a string of a decimal value to a 64-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int esedbtools_system_string_decimal_copy_to_64_bit(
+     const system_character_t *string,
+     size_t string_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function   = "esedbtools_system_string_decimal_copy_to_64_bit";
+	size_t string_index     = 0;
+	uint64_t safe_value     = 0;
+	uint8_t character_value = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < string_size;
+	     string_index++ )
+	{
+		if( string[ string_index ] == 0 )
+		{
+			break;
+		}
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character value at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		character_value = (uint8_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( safe_value > ( ( UINT64_MAX - character_value ) / 10 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value *= 10;
+		safe_value += character_value;
+	}
+	if( string_index == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing decimal value.",
+		 function );
+
+		return( -1 );
+	}
+	*value_64bit = safe_value;
+
+	return( 1 );
+}
+
@@ -38,6 +38,12 @@ int esedbtools_system_string_copy_from_64_bit_in_decimal(
      uint64_t value_64bit,
      libcerror_error_t **error );
 
+int esedbtools_system_string_decimal_copy_to_64_bit(
+     const system_character_t *string,
+     size_t string_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
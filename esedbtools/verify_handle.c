@@ -0,0 +1,1446 @@
+/*
+ * Verification handle
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "esedbtools_libbfio.h"
+#include "esedbtools_libcdata.h"
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcnotify.h"
+#include "esedbtools_libcthreads.h"
+#include "esedbtools_libesedb.h"
+#include "esedbtools_system_string.h"
+#include "verify_handle.h"
+
+#define VERIFY_HANDLE_NOTIFY_STREAM	stdout
+
+/* Frees a corrupt page
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_corrupt_page_free(
+     verify_handle_corrupt_page_t **corrupt_page,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_corrupt_page_free";
+
+	if( corrupt_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid corrupt page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *corrupt_page != NULL )
+	{
+		memory_free(
+		 *corrupt_page );
+
+		*corrupt_page = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two corrupt pages by their page number
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int verify_handle_corrupt_page_compare(
+     verify_handle_corrupt_page_t *first_corrupt_page,
+     verify_handle_corrupt_page_t *second_corrupt_page,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_corrupt_page_compare";
+
+	if( first_corrupt_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first corrupt page.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_corrupt_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second corrupt page.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_corrupt_page->page_number < second_corrupt_page->page_number )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_corrupt_page->page_number > second_corrupt_page->page_number )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Creates a verify handle
+ * Make sure the value verify_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_initialize(
+     verify_handle_t **verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_initialize";
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verify_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verify handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*verify_handle = memory_allocate_structure(
+	                  verify_handle_t );
+
+	if( *verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create verify handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *verify_handle,
+	     0,
+	     sizeof( verify_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear verify handle.",
+		 function );
+
+		memory_free(
+		 *verify_handle );
+
+		*verify_handle = NULL;
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &( ( *verify_handle )->input_file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_initialize(
+	     &( ( *verify_handle )->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *verify_handle )->corrupt_pages_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create corrupt pages array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *verify_handle )->results_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create results mutex.",
+		 function );
+
+		goto on_error;
+	}
+	( *verify_handle )->number_of_jobs = 4;
+#endif
+	( *verify_handle )->notify_stream = VERIFY_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *verify_handle != NULL )
+	{
+		if( ( *verify_handle )->corrupt_pages_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *verify_handle )->corrupt_pages_array ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *verify_handle )->input_file != NULL )
+		{
+			libesedb_file_free(
+			 &( ( *verify_handle )->input_file ),
+			 NULL );
+		}
+		if( ( *verify_handle )->input_file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *verify_handle )->input_file_io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *verify_handle );
+
+		*verify_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a verify handle
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_free(
+     verify_handle_t **verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_free";
+	int result            = 1;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verify_handle != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *verify_handle )->jobs_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *verify_handle )->jobs_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join jobs thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *verify_handle )->results_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free results mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libcdata_array_free(
+		     &( ( *verify_handle )->corrupt_pages_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &verify_handle_corrupt_page_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free corrupt pages array.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_file_free(
+		     &( ( *verify_handle )->input_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( ( *verify_handle )->input_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *verify_handle );
+
+		*verify_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the verify handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_signal_abort(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_signal_abort";
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	verify_handle->abort = 1;
+
+	if( verify_handle->input_file != NULL )
+	{
+		if( libesedb_file_signal_abort(
+		     verify_handle->input_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the number of concurrent verification jobs
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int verify_handle_set_number_of_jobs(
+     verify_handle_t *verify_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_set_number_of_jobs";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( esedbtools_system_string_decimal_copy_to_64_bit(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit > (uint64_t) VERIFY_HANDLE_MAXIMUM_NUMBER_OF_JOBS )
+	{
+		return( 0 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( value_64bit != 0 )
+	{
+		return( 0 );
+	}
+#endif
+	verify_handle->number_of_jobs = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Opens the verify handle
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_open(
+     verify_handle_t *verify_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_open";
+	size_t filename_length = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     verify_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     verify_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in input file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     verify_handle->input_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_open_file_io_handle(
+	     verify_handle->input_file,
+	     verify_handle->input_file_io_handle,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_get_page_size(
+	     verify_handle->input_file,
+	     &( verify_handle->page_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_get_number_of_pages(
+	     verify_handle->input_file,
+	     &( verify_handle->number_of_pages ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of pages.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libesedb_file_close(
+	 verify_handle->input_file,
+	 NULL );
+
+	libbfio_handle_close(
+	 verify_handle->input_file_io_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes the verify handle
+ * Returns the 0 if succesful or -1 on error
+ */
+int verify_handle_close(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_close";
+	int result            = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_close(
+	     verify_handle->input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_handle_close(
+	     verify_handle->input_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Appends a corrupt or unreadable page to the results
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_append_corrupt_page(
+     verify_handle_t *verify_handle,
+     uint32_t page_number,
+     uint32_t father_data_page_object_identifier,
+     uint32_t corruption_flags,
+     uint8_t is_unreadable,
+     libcerror_error_t **error )
+{
+	verify_handle_corrupt_page_t *corrupt_page = NULL;
+	static char *function                      = "verify_handle_append_corrupt_page";
+	int entry_index                            = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int results_mutex_grabbed                  = 0;
+#endif
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	corrupt_page = memory_allocate_structure(
+	                verify_handle_corrupt_page_t );
+
+	if( corrupt_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create corrupt page.",
+		 function );
+
+		goto on_error;
+	}
+	corrupt_page->page_number                        = page_number;
+	corrupt_page->father_data_page_object_identifier = father_data_page_object_identifier;
+	corrupt_page->corruption_flags                   = corruption_flags;
+	corrupt_page->is_unreadable                      = is_unreadable;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     verify_handle->results_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab results mutex.",
+		 function );
+
+		goto on_error;
+	}
+	results_mutex_grabbed = 1;
+#endif
+	if( libcdata_array_insert_entry(
+	     verify_handle->corrupt_pages_array,
+	     &entry_index,
+	     (intptr_t *) corrupt_page,
+	     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &verify_handle_corrupt_page_compare,
+	     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert corrupt page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		goto on_error;
+	}
+	corrupt_page = NULL;
+
+	if( is_unreadable != 0 )
+	{
+		verify_handle->number_of_unreadable_pages += 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     verify_handle->results_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release results mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( results_mutex_grabbed != 0 )
+	{
+		libcthreads_mutex_release(
+		 verify_handle->results_mutex,
+		 NULL );
+	}
+#endif
+	if( corrupt_page != NULL )
+	{
+		memory_free(
+		 corrupt_page );
+	}
+	return( -1 );
+}
+
+/* Verifies a range of pages
+ * This function is the callback of the verification jobs and takes ownership of the page range
+ * Pages that cannot be read are recorded as unreadable and do not stop the verification
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_verify_page_range(
+     verify_handle_page_range_t *page_range,
+     verify_handle_t *verify_handle )
+{
+	libbfio_handle_t *file_io_handle            = NULL;
+	libcerror_error_t *error                    = NULL;
+	uint8_t *pages_data                         = NULL;
+	static char *function                       = "verify_handle_verify_page_range";
+	size_t pages_data_offset                    = 0;
+	size_t pages_data_size                      = 0;
+	ssize_t read_count                          = 0;
+	off64_t file_offset                         = 0;
+	uint32_t corruption_flags                   = 0;
+	uint32_t father_data_page_object_identifier = 0;
+	uint32_t number_of_verified_pages           = 0;
+	uint32_t page_index                         = 0;
+	uint32_t page_number                        = 0;
+	uint8_t read_pages_individually             = 0;
+	int result                                  = 0;
+
+	if( page_range == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page range.",
+		 function );
+
+		goto on_error;
+	}
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( page_range->number_of_pages == 0 )
+	 || ( page_range->number_of_pages > ( (uint32_t) SSIZE_MAX / verify_handle->page_size ) ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page range - number of pages value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( verify_handle->abort != 0 )
+	{
+		memory_free(
+		 page_range );
+
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verify_handle->number_of_jobs > 0 )
+	{
+		/* Every job uses its own file IO handle to allow concurrent reads
+		 */
+		if( libbfio_handle_clone(
+		     &file_io_handle,
+		     verify_handle->input_file_io_handle,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone input file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif
+	{
+		file_io_handle = verify_handle->input_file_io_handle;
+	}
+	pages_data_size = (size_t) page_range->number_of_pages * verify_handle->page_size;
+
+	pages_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * pages_data_size );
+
+	if( pages_data == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pages data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The first page is stored after the file header and its shadow copy
+	 */
+	file_offset = ( (off64_t) page_range->first_page_number + 1 ) * verify_handle->page_size;
+
+	read_count = -1;
+
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     &error ) != -1 )
+	{
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              pages_data,
+		              pages_data_size,
+		              &error );
+	}
+	if( read_count != (ssize_t) pages_data_size )
+	{
+		/* Read the pages one by one so that a page that cannot be read
+		 * does not prevent the other pages in the range from being verified
+		 */
+		libcerror_error_free(
+		 &error );
+
+		read_pages_individually = 1;
+	}
+	for( page_index = 0;
+	     page_index < page_range->number_of_pages;
+	     page_index++ )
+	{
+		page_number = page_range->first_page_number + page_index;
+
+		if( read_pages_individually != 0 )
+		{
+			file_offset = ( (off64_t) page_number + 1 ) * verify_handle->page_size;
+			read_count  = -1;
+
+			if( libbfio_handle_seek_offset(
+			     file_io_handle,
+			     file_offset,
+			     SEEK_SET,
+			     &error ) != -1 )
+			{
+				read_count = libbfio_handle_read_buffer(
+				              file_io_handle,
+				              &( pages_data[ pages_data_offset ] ),
+				              (size_t) verify_handle->page_size,
+				              &error );
+			}
+			if( read_count != (ssize_t) verify_handle->page_size )
+			{
+				libcerror_error_free(
+				 &error );
+
+				if( verify_handle_append_corrupt_page(
+				     verify_handle,
+				     page_number,
+				     0,
+				     0,
+				     1,
+				     &error ) != 1 )
+				{
+					libcerror_error_set(
+					 &error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append unreadable page: %" PRIu32 ".",
+					 function,
+					 page_number );
+
+					goto on_error;
+				}
+				pages_data_offset += verify_handle->page_size;
+
+				continue;
+			}
+		}
+		result = libesedb_file_verify_page_data(
+		          verify_handle->input_file,
+		          page_number,
+		          &( pages_data[ pages_data_offset ] ),
+		          (size_t) verify_handle->page_size,
+		          &father_data_page_object_identifier,
+		          &corruption_flags,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( verify_handle_append_corrupt_page(
+			     verify_handle,
+			     page_number,
+			     father_data_page_object_identifier,
+			     corruption_flags,
+			     0,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append corrupt page: %" PRIu32 ".",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+		}
+		number_of_verified_pages += 1;
+
+		pages_data_offset += verify_handle->page_size;
+	}
+	memory_free(
+	 pages_data );
+
+	pages_data = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verify_handle->number_of_jobs > 0 )
+	{
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     &error ) != 0 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_handle_free(
+		     &file_io_handle,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     verify_handle->results_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab results mutex.",
+		 function );
+
+		goto on_error;
+	}
+	verify_handle->number_of_verified_pages += number_of_verified_pages;
+
+	if( libcthreads_mutex_release(
+	     verify_handle->results_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release results mutex.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	verify_handle->number_of_verified_pages += number_of_verified_pages;
+#endif
+	memory_free(
+	 page_range );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( verify_handle != NULL )
+	 && ( verify_handle->number_of_jobs > 0 )
+	 && ( file_io_handle != NULL ) )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+#endif
+	if( pages_data != NULL )
+	{
+		memory_free(
+		 pages_data );
+	}
+	if( page_range != NULL )
+	{
+		memory_free(
+		 page_range );
+	}
+	if( verify_handle != NULL )
+	{
+		verify_handle->job_failed = 1;
+	}
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Verifies all the pages
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_verify_pages(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	verify_handle_page_range_t *page_range = NULL;
+	static char *function                  = "verify_handle_verify_pages";
+	uint32_t page_number                   = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->page_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verify handle - missing page size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verify_handle->number_of_jobs > 0 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( verify_handle->jobs_thread_pool ),
+		     NULL,
+		     verify_handle->number_of_jobs,
+		     verify_handle->number_of_jobs * 4,
+		     (int (*)(intptr_t *, void *)) &verify_handle_verify_page_range,
+		     (void *) verify_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create jobs thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	/* Page numbers start at 1
+	 */
+	page_number = 1;
+
+	while( page_number <= verify_handle->number_of_pages )
+	{
+		if( ( verify_handle->abort != 0 )
+		 || ( verify_handle->job_failed != 0 ) )
+		{
+			break;
+		}
+		page_range = memory_allocate_structure(
+		              verify_handle_page_range_t );
+
+		if( page_range == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page range.",
+			 function );
+
+			goto on_error;
+		}
+		page_range->first_page_number = page_number;
+		page_range->number_of_pages   = verify_handle->number_of_pages - page_number + 1;
+
+		if( page_range->number_of_pages > VERIFY_HANDLE_NUMBER_OF_PAGES_PER_JOB )
+		{
+			page_range->number_of_pages = VERIFY_HANDLE_NUMBER_OF_PAGES_PER_JOB;
+		}
+		page_number += page_range->number_of_pages;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( verify_handle->jobs_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_push(
+			     verify_handle->jobs_thread_pool,
+			     (intptr_t *) page_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push page range onto jobs thread pool queue.",
+				 function );
+
+				goto on_error;
+			}
+			page_range = NULL;
+
+			continue;
+		}
+#endif
+		/* The page range is freed by the job
+		 */
+		if( verify_handle_verify_page_range(
+		     page_range,
+		     verify_handle ) != 1 )
+		{
+			page_range = NULL;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify page range.",
+			 function );
+
+			goto on_error;
+		}
+		page_range = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verify_handle->jobs_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( verify_handle->jobs_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join jobs thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( verify_handle->job_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify pages.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( page_range != NULL )
+	{
+		memory_free(
+		 page_range );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verify_handle->jobs_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( verify_handle->jobs_thread_pool ),
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Prints the verification results to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_results_fprint(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	verify_handle_corrupt_page_t *corrupt_page = NULL;
+	static char *function                      = "verify_handle_results_fprint";
+	int corrupt_page_index                     = 0;
+	int number_of_entries                      = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     verify_handle->corrupt_pages_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of corrupt pages.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 verify_handle->notify_stream,
+	 "Extensible Storage Engine Database verification:\n" );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tPage size:\t\t%" PRIu32 " bytes\n",
+	 verify_handle->page_size );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tNumber of pages:\t%" PRIu32 "\n",
+	 verify_handle->number_of_pages );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tVerified pages:\t\t%" PRIu32 "\n",
+	 verify_handle->number_of_verified_pages );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tUnreadable pages:\t%" PRIu32 "\n",
+	 verify_handle->number_of_unreadable_pages );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tCorrupt pages:\t\t%d\n",
+	 number_of_entries - (int) verify_handle->number_of_unreadable_pages );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\n" );
+
+	for( corrupt_page_index = 0;
+	     corrupt_page_index < number_of_entries;
+	     corrupt_page_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     verify_handle->corrupt_pages_array,
+		     corrupt_page_index,
+		     (intptr_t **) &corrupt_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve corrupt page: %d.",
+			 function,
+			 corrupt_page_index );
+
+			return( -1 );
+		}
+		if( corrupt_page == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing corrupt page: %d.",
+			 function,
+			 corrupt_page_index );
+
+			return( -1 );
+		}
+		if( corrupt_page->is_unreadable != 0 )
+		{
+			fprintf(
+			 verify_handle->notify_stream,
+			 "Unreadable page: %" PRIu32 "\n",
+			 corrupt_page->page_number );
+
+			fprintf(
+			 verify_handle->notify_stream,
+			 "\tOffset:\t\t\t%" PRIu64 " (0x%08" PRIx64 ")\n\n",
+			 ( (uint64_t) corrupt_page->page_number + 1 ) * verify_handle->page_size,
+			 ( (uint64_t) corrupt_page->page_number + 1 ) * verify_handle->page_size );
+
+			continue;
+		}
+		fprintf(
+		 verify_handle->notify_stream,
+		 "Corrupt page: %" PRIu32 "\n",
+		 corrupt_page->page_number );
+
+		fprintf(
+		 verify_handle->notify_stream,
+		 "\tOffset:\t\t\t%" PRIu64 " (0x%08" PRIx64 ")\n",
+		 ( (uint64_t) corrupt_page->page_number + 1 ) * verify_handle->page_size,
+		 ( (uint64_t) corrupt_page->page_number + 1 ) * verify_handle->page_size );
+
+		fprintf(
+		 verify_handle->notify_stream,
+		 "\tOwner object identifier:\t%" PRIu32 "\n",
+		 corrupt_page->father_data_page_object_identifier );
+
+		if( ( corrupt_page->corruption_flags & LIBESEDB_PAGE_CORRUPTION_FLAG_CHECKSUM_MISMATCH ) != 0 )
+		{
+			fprintf(
+			 verify_handle->notify_stream,
+			 "\tChecksum mismatch\n" );
+		}
+		if( ( corrupt_page->corruption_flags & LIBESEDB_PAGE_CORRUPTION_FLAG_PAGE_NUMBER_MISMATCH ) != 0 )
+		{
+			fprintf(
+			 verify_handle->notify_stream,
+			 "\tPage number mismatch\n" );
+		}
+		if( ( corrupt_page->corruption_flags & LIBESEDB_PAGE_CORRUPTION_FLAG_INVALID_PAGE_TAGS ) != 0 )
+		{
+			fprintf(
+			 verify_handle->notify_stream,
+			 "\tInvalid page tags\n" );
+		}
+		fprintf(
+		 verify_handle->notify_stream,
+		 "\n" );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,200 @@
+/*
+ * Verification handle
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VERIFY_HANDLE_H )
+#define _VERIFY_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "esedbtools_libbfio.h"
+#include "esedbtools_libcdata.h"
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcthreads.h"
+#include "esedbtools_libesedb.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of pages processed by a single verification job
+ */
+#define VERIFY_HANDLE_NUMBER_OF_PAGES_PER_JOB	256
+
+/* The maximum number of concurrent verification jobs
+ */
+#define VERIFY_HANDLE_MAXIMUM_NUMBER_OF_JOBS	64
+
+typedef struct verify_handle_corrupt_page verify_handle_corrupt_page_t;
+
+struct verify_handle_corrupt_page
+{
+	/* The page number
+	 */
+	uint32_t page_number;
+
+	/* The father data page (FDP) object identifier
+	 */
+	uint32_t father_data_page_object_identifier;
+
+	/* The corruption flags
+	 */
+	uint32_t corruption_flags;
+
+	/* Value to indicate the page could not be read
+	 */
+	uint8_t is_unreadable;
+};
+
+typedef struct verify_handle_page_range verify_handle_page_range_t;
+
+struct verify_handle_page_range
+{
+	/* The first page number
+	 */
+	uint32_t first_page_number;
+
+	/* The number of pages
+	 */
+	uint32_t number_of_pages;
+};
+
+typedef struct verify_handle verify_handle_t;
+
+struct verify_handle
+{
+	/* The libbfio input file IO handle
+	 */
+	libbfio_handle_t *input_file_io_handle;
+
+	/* The libesedb input file
+	 */
+	libesedb_file_t *input_file;
+
+	/* The page size
+	 */
+	uint32_t page_size;
+
+	/* The number of pages
+	 */
+	uint32_t number_of_pages;
+
+	/* The number of concurrent verification jobs
+	 */
+	int number_of_jobs;
+
+	/* The number of verified pages
+	 */
+	uint32_t number_of_verified_pages;
+
+	/* The number of pages that could not be read
+	 */
+	uint32_t number_of_unreadable_pages;
+
+	/* The corrupt pages array
+	 */
+	libcdata_array_t *corrupt_pages_array;
+
+	/* Value to indicate a verification job failed
+	 */
+	int job_failed;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The results mutex
+	 */
+	libcthreads_mutex_t *results_mutex;
+
+	/* The verification jobs thread pool
+	 */
+	libcthreads_thread_pool_t *jobs_thread_pool;
+#endif
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int verify_handle_corrupt_page_free(
+     verify_handle_corrupt_page_t **corrupt_page,
+     libcerror_error_t **error );
+
+int verify_handle_corrupt_page_compare(
+     verify_handle_corrupt_page_t *first_corrupt_page,
+     verify_handle_corrupt_page_t *second_corrupt_page,
+     libcerror_error_t **error );
+
+int verify_handle_initialize(
+     verify_handle_t **verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_free(
+     verify_handle_t **verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_signal_abort(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_set_number_of_jobs(
+     verify_handle_t *verify_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int verify_handle_open(
+     verify_handle_t *verify_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int verify_handle_close(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_append_corrupt_page(
+     verify_handle_t *verify_handle,
+     uint32_t page_number,
+     uint32_t father_data_page_object_identifier,
+     uint32_t corruption_flags,
+     uint8_t is_unreadable,
+     libcerror_error_t **error );
+
+int verify_handle_verify_page_range(
+     verify_handle_page_range_t *page_range,
+     verify_handle_t *verify_handle );
+
+int verify_handle_verify_pages(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_results_fprint(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VERIFY_HANDLE_H ) */
+
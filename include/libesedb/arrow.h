@@ -0,0 +1,81 @@
+/*
+ * Apache Arrow C data interface definitions for libesedb
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_ARROW_H )
+#define _LIBESEDB_ARROW_H
+
+#include <libesedb/types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The structures are defined by the Apache Arrow C data interface specification
+ * and are shared with other producers and consumers of the interface
+ */
+#if !defined( ARROW_C_DATA_INTERFACE )
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED	1
+#define ARROW_FLAG_NULLABLE		2
+#define ARROW_FLAG_MAP_KEYS_SORTED	4
+
+struct ArrowSchema
+{
+	const char *format;
+	const char *name;
+	const char *metadata;
+	int64_t flags;
+	int64_t n_children;
+	struct ArrowSchema **children;
+	struct ArrowSchema *dictionary;
+
+	void (*release)(
+	       struct ArrowSchema *schema );
+
+	void *private_data;
+};
+
+struct ArrowArray
+{
+	int64_t length;
+	int64_t null_count;
+	int64_t offset;
+	int64_t n_buffers;
+	int64_t n_children;
+	const void **buffers;
+	struct ArrowArray **children;
+	struct ArrowArray *dictionary;
+
+	void (*release)(
+	       struct ArrowArray *array );
+
+	void *private_data;
+};
+
+#endif /* !defined( ARROW_C_DATA_INTERFACE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_ARROW_H ) */
+
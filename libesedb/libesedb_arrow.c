@@ -0,0 +1,2291 @@
+/*
+ * Apache Arrow C data interface functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_arrow.h"
+#include "libesedb_definitions.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_long_value.h"
+#include "libesedb_multi_value.h"
+#include "libesedb_record.h"
+#include "libesedb_table_definition.h"
+
+/* The initial size of the element data per element of a variable size column type
+ */
+#define LIBESEDB_ARROW_INITIAL_ELEMENT_DATA_SIZE	16
+
+/* Releases a schema
+ * This function is used as the release callback of the schema
+ */
+void libesedb_arrow_schema_release(
+      struct ArrowSchema *schema )
+{
+	libesedb_arrow_schema_private_t *schema_private = NULL;
+	int64_t child_index                             = 0;
+
+	if( schema == NULL )
+	{
+		return;
+	}
+	if( schema->release == NULL )
+	{
+		return;
+	}
+	schema_private = (libesedb_arrow_schema_private_t *) schema->private_data;
+
+	if( schema_private != NULL )
+	{
+		if( schema_private->children != NULL )
+		{
+			for( child_index = 0;
+			     child_index < schema_private->number_of_children;
+			     child_index++ )
+			{
+				if( schema_private->children[ child_index ] != NULL )
+				{
+					if( schema_private->children[ child_index ]->release != NULL )
+					{
+						schema_private->children[ child_index ]->release(
+						 schema_private->children[ child_index ] );
+					}
+					memory_free(
+					 schema_private->children[ child_index ] );
+				}
+			}
+			memory_free(
+			 schema_private->children );
+		}
+		if( schema_private->name != NULL )
+		{
+			memory_free(
+			 schema_private->name );
+		}
+		memory_free(
+		 schema_private );
+	}
+	schema->private_data = NULL;
+	schema->release      = NULL;
+}
+
+/* Initializes a schema
+ * The children of the schema are created but not initialized
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_schema_initialize(
+     struct ArrowSchema *schema,
+     const char *format,
+     const uint8_t *name,
+     size_t name_size,
+     int64_t flags,
+     int64_t number_of_children,
+     libcerror_error_t **error )
+{
+	libesedb_arrow_schema_private_t *schema_private = NULL;
+	static char *function                           = "libesedb_arrow_schema_initialize";
+	int64_t child_index                             = 0;
+
+	if( schema == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid schema.",
+		 function );
+
+		return( -1 );
+	}
+	if( format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_children < 0 )
+	 || ( number_of_children > (int64_t) ( SSIZE_MAX / sizeof( struct ArrowSchema * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of children value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     schema,
+	     0,
+	     sizeof( struct ArrowSchema ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear schema.",
+		 function );
+
+		return( -1 );
+	}
+	schema_private = memory_allocate_structure(
+	                  libesedb_arrow_schema_private_t );
+
+	if( schema_private == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create schema private data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     schema_private,
+	     0,
+	     sizeof( libesedb_arrow_schema_private_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear schema private data.",
+		 function );
+
+		memory_free(
+		 schema_private );
+
+		return( -1 );
+	}
+	schema->format       = format;
+	schema->flags        = flags;
+	schema->private_data = (void *) schema_private;
+	schema->release      = &libesedb_arrow_schema_release;
+
+	if( ( name != NULL )
+	 && ( name_size > 0 ) )
+	{
+		schema_private->name = (char *) memory_allocate(
+		                                 sizeof( char ) * ( name_size + 1 ) );
+
+		if( schema_private->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     schema_private->name,
+		     name,
+		     name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			goto on_error;
+		}
+		/* The name is not required to contain an end-of-string character
+		 */
+		schema_private->name[ name_size ] = 0;
+
+		schema->name = schema_private->name;
+	}
+	if( number_of_children > 0 )
+	{
+		schema_private->children = (struct ArrowSchema **) memory_allocate(
+		                                                    sizeof( struct ArrowSchema * ) * (size_t) number_of_children );
+
+		if( schema_private->children == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create children.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     schema_private->children,
+		     0,
+		     sizeof( struct ArrowSchema * ) * (size_t) number_of_children ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear children.",
+			 function );
+
+			memory_free(
+			 schema_private->children );
+
+			schema_private->children = NULL;
+
+			goto on_error;
+		}
+		schema_private->number_of_children = number_of_children;
+
+		for( child_index = 0;
+		     child_index < number_of_children;
+		     child_index++ )
+		{
+			schema_private->children[ child_index ] = memory_allocate_structure(
+			                                           struct ArrowSchema );
+
+			if( schema_private->children[ child_index ] == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create child: %" PRIi64 ".",
+				 function,
+				 child_index );
+
+				goto on_error;
+			}
+			/* A child without a release callback is not released
+			 */
+			schema_private->children[ child_index ]->release = NULL;
+		}
+		schema->n_children = number_of_children;
+		schema->children   = schema_private->children;
+	}
+	return( 1 );
+
+on_error:
+	libesedb_arrow_schema_release(
+	 schema );
+
+	return( -1 );
+}
+
+/* Releases an array
+ * This function is used as the release callback of the array
+ */
+void libesedb_arrow_array_release(
+      struct ArrowArray *array )
+{
+	libesedb_arrow_array_private_t *array_private = NULL;
+	int64_t child_index                           = 0;
+	int buffer_index                              = 0;
+
+	if( array == NULL )
+	{
+		return;
+	}
+	if( array->release == NULL )
+	{
+		return;
+	}
+	array_private = (libesedb_arrow_array_private_t *) array->private_data;
+
+	if( array_private != NULL )
+	{
+		if( array_private->children != NULL )
+		{
+			for( child_index = 0;
+			     child_index < array_private->number_of_children;
+			     child_index++ )
+			{
+				if( array_private->children[ child_index ] != NULL )
+				{
+					if( array_private->children[ child_index ]->release != NULL )
+					{
+						array_private->children[ child_index ]->release(
+						 array_private->children[ child_index ] );
+					}
+					memory_free(
+					 array_private->children[ child_index ] );
+				}
+			}
+			memory_free(
+			 array_private->children );
+		}
+		for( buffer_index = 0;
+		     buffer_index < 3;
+		     buffer_index++ )
+		{
+			if( array_private->buffers[ buffer_index ] != NULL )
+			{
+				memory_free(
+				 array_private->buffers[ buffer_index ] );
+			}
+		}
+		memory_free(
+		 array_private );
+	}
+	array->private_data = NULL;
+	array->release      = NULL;
+}
+
+/* Initializes an array
+ * The buffers of the array are set to NULL and are owned by the array once set
+ * The children of the array are created but not initialized
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_array_initialize(
+     struct ArrowArray *array,
+     int64_t length,
+     int64_t null_count,
+     int64_t number_of_buffers,
+     int64_t number_of_children,
+     libcerror_error_t **error )
+{
+	libesedb_arrow_array_private_t *array_private = NULL;
+	static char *function                         = "libesedb_arrow_array_initialize";
+	int64_t child_index                           = 0;
+
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buffers < 0 )
+	 || ( number_of_buffers > 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_children < 0 )
+	 || ( number_of_children > (int64_t) ( SSIZE_MAX / sizeof( struct ArrowArray * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of children value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     array,
+	     0,
+	     sizeof( struct ArrowArray ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear array.",
+		 function );
+
+		return( -1 );
+	}
+	array_private = memory_allocate_structure(
+	                 libesedb_arrow_array_private_t );
+
+	if( array_private == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create array private data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     array_private,
+	     0,
+	     sizeof( libesedb_arrow_array_private_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear array private data.",
+		 function );
+
+		memory_free(
+		 array_private );
+
+		return( -1 );
+	}
+	array->length       = length;
+	array->null_count   = null_count;
+	array->n_buffers    = number_of_buffers;
+	array->buffers      = (const void **) array_private->buffers;
+	array->private_data = (void *) array_private;
+	array->release      = &libesedb_arrow_array_release;
+
+	if( number_of_children > 0 )
+	{
+		array_private->children = (struct ArrowArray **) memory_allocate(
+		                                                  sizeof( struct ArrowArray * ) * (size_t) number_of_children );
+
+		if( array_private->children == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create children.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     array_private->children,
+		     0,
+		     sizeof( struct ArrowArray * ) * (size_t) number_of_children ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear children.",
+			 function );
+
+			memory_free(
+			 array_private->children );
+
+			array_private->children = NULL;
+
+			goto on_error;
+		}
+		array_private->number_of_children = number_of_children;
+
+		for( child_index = 0;
+		     child_index < number_of_children;
+		     child_index++ )
+		{
+			array_private->children[ child_index ] = memory_allocate_structure(
+			                                          struct ArrowArray );
+
+			if( array_private->children[ child_index ] == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create child: %" PRIi64 ".",
+				 function,
+				 child_index );
+
+				goto on_error;
+			}
+			/* A child without a release callback is not released
+			 */
+			array_private->children[ child_index ]->release = NULL;
+		}
+		array->n_children = number_of_children;
+		array->children   = array_private->children;
+	}
+	return( 1 );
+
+on_error:
+	libesedb_arrow_array_release(
+	 array );
+
+	return( -1 );
+}
+
+/* Creates an Arrow column
+ * The Arrow column is used to build the Arrow buffers of a column one value at a time
+ * Make sure the value arrow_column is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_column_initialize(
+     libesedb_arrow_column_t **arrow_column,
+     uint32_t column_type,
+     uint8_t is_multi_valued,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function       = "libesedb_arrow_column_initialize";
+	size_t validity_bitmap_size = 0;
+
+	if( arrow_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow column.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arrow_column != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Arrow column value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*arrow_column = memory_allocate_structure(
+	                 libesedb_arrow_column_t );
+
+	if( *arrow_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Arrow column.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arrow_column,
+	     0,
+	     sizeof( libesedb_arrow_column_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Arrow column.",
+		 function );
+
+		memory_free(
+		 *arrow_column );
+
+		*arrow_column = NULL;
+
+		return( -1 );
+	}
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			( *arrow_column )->format     = "b";
+			( *arrow_column )->value_size = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			( *arrow_column )->format     = "C";
+			( *arrow_column )->value_size = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			( *arrow_column )->format     = "s";
+			( *arrow_column )->value_size = 2;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			( *arrow_column )->format     = "S";
+			( *arrow_column )->value_size = 2;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			( *arrow_column )->format     = "i";
+			( *arrow_column )->value_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			( *arrow_column )->format     = "I";
+			( *arrow_column )->value_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			( *arrow_column )->format     = "f";
+			( *arrow_column )->value_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			( *arrow_column )->format     = "l";
+			( *arrow_column )->value_size = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			( *arrow_column )->format     = "g";
+			( *arrow_column )->value_size = 8;
+			break;
+
+		/* The date and time value is stored as-is since it can either be
+		 * a FILETIME or a floating-point date and time value
+		 */
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			( *arrow_column )->format     = "L";
+			( *arrow_column )->value_size = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_GUID:
+			( *arrow_column )->format     = "w:16";
+			( *arrow_column )->value_size = 16;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			( *arrow_column )->format     = "u";
+			( *arrow_column )->value_size = 0;
+			break;
+
+		default:
+			( *arrow_column )->format     = "z";
+			( *arrow_column )->value_size = 0;
+			break;
+	}
+	( *arrow_column )->column_type              = column_type;
+	( *arrow_column )->is_multi_valued          = is_multi_valued;
+	( *arrow_column )->maximum_number_of_values = (int64_t) number_of_values;
+
+	validity_bitmap_size = ( (size_t) number_of_values + 7 ) / 8;
+
+	/* Arrow buffers are allocated even if empty
+	 */
+	if( validity_bitmap_size == 0 )
+	{
+		validity_bitmap_size = 1;
+	}
+	( *arrow_column )->validity_bitmap = (uint8_t *) memory_allocate(
+	                                                  sizeof( uint8_t ) * validity_bitmap_size );
+
+	if( ( *arrow_column )->validity_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create validity bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *arrow_column )->validity_bitmap,
+	     0,
+	     sizeof( uint8_t ) * validity_bitmap_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear validity bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( is_multi_valued != 0 )
+	{
+		( *arrow_column )->list_offsets = (int32_t *) memory_allocate(
+		                                               sizeof( int32_t ) * ( (size_t) number_of_values + 1 ) );
+
+		if( ( *arrow_column )->list_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create list offsets.",
+			 function );
+
+			goto on_error;
+		}
+		( *arrow_column )->list_offsets[ 0 ] = 0;
+	}
+	if( ( *arrow_column )->value_size == 0 )
+	{
+		( *arrow_column )->allocated_element_data_size = LIBESEDB_ARROW_INITIAL_ELEMENT_DATA_SIZE;
+
+		if( number_of_values > 0 )
+		{
+			( *arrow_column )->allocated_element_data_size *= (size_t) number_of_values;
+		}
+		if( ( *arrow_column )->allocated_element_data_size > (size_t) INT32_MAX )
+		{
+			( *arrow_column )->allocated_element_data_size = (size_t) INT32_MAX;
+		}
+		( *arrow_column )->element_data = (uint8_t *) memory_allocate(
+		                                               sizeof( uint8_t ) * ( *arrow_column )->allocated_element_data_size );
+
+		if( ( *arrow_column )->element_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create element data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_arrow_column_resize_elements(
+	     *arrow_column,
+	     ( number_of_values > 0 ) ? (int64_t) number_of_values : 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize elements.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( *arrow_column )->value_size == 0 )
+	{
+		( *arrow_column )->element_offsets[ 0 ] = 0;
+	}
+	return( 1 );
+
+on_error:
+	if( *arrow_column != NULL )
+	{
+		libesedb_arrow_column_free(
+		 arrow_column,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an Arrow column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_column_free(
+     libesedb_arrow_column_t **arrow_column,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_arrow_column_free";
+
+	if( arrow_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow column.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arrow_column != NULL )
+	{
+		if( ( *arrow_column )->element_data != NULL )
+		{
+			memory_free(
+			 ( *arrow_column )->element_data );
+		}
+		if( ( *arrow_column )->element_offsets != NULL )
+		{
+			memory_free(
+			 ( *arrow_column )->element_offsets );
+		}
+		if( ( *arrow_column )->list_offsets != NULL )
+		{
+			memory_free(
+			 ( *arrow_column )->list_offsets );
+		}
+		if( ( *arrow_column )->validity_bitmap != NULL )
+		{
+			memory_free(
+			 ( *arrow_column )->validity_bitmap );
+		}
+		memory_free(
+		 *arrow_column );
+
+		*arrow_column = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the elements of an Arrow column
+ * The elements are only resized if the number of elements exceeds the maximum number of elements
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_column_resize_elements(
+     libesedb_arrow_column_t *arrow_column,
+     int64_t number_of_elements,
+     libcerror_error_t **error )
+{
+	void *reallocation                 = NULL;
+	static char *function              = "libesedb_arrow_column_resize_elements";
+	size_t elements_size               = 0;
+	int64_t maximum_number_of_elements = 0;
+
+	if( arrow_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow column.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_elements <= arrow_column->maximum_number_of_elements )
+	{
+		return( 1 );
+	}
+	/* The offsets of a variable size column type are 32-bit signed integers
+	 */
+	if( number_of_elements >= (int64_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of elements value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_elements = arrow_column->maximum_number_of_elements * 2;
+
+	if( maximum_number_of_elements < number_of_elements )
+	{
+		maximum_number_of_elements = number_of_elements;
+	}
+	if( maximum_number_of_elements >= (int64_t) INT32_MAX )
+	{
+		maximum_number_of_elements = (int64_t) INT32_MAX - 1;
+	}
+	if( arrow_column->value_size == 0 )
+	{
+		elements_size = sizeof( int32_t ) * ( (size_t) maximum_number_of_elements + 1 );
+	}
+	else if( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_BOOLEAN )
+	{
+		elements_size = ( (size_t) maximum_number_of_elements + 7 ) / 8;
+	}
+	else
+	{
+		elements_size = arrow_column->value_size * (size_t) maximum_number_of_elements;
+	}
+	if( elements_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid elements size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_column->value_size == 0 )
+	{
+		reallocation = memory_reallocate(
+		                arrow_column->element_offsets,
+		                elements_size );
+	}
+	else
+	{
+		reallocation = memory_reallocate(
+		                arrow_column->element_data,
+		                elements_size );
+	}
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_column->value_size == 0 )
+	{
+		arrow_column->element_offsets = (int32_t *) reallocation;
+	}
+	else
+	{
+		arrow_column->element_data                = (uint8_t *) reallocation;
+		arrow_column->allocated_element_data_size = elements_size;
+	}
+	arrow_column->maximum_number_of_elements = maximum_number_of_elements;
+
+	return( 1 );
+}
+
+/* Retrieves the buffer to store the data of the next element of an Arrow column
+ * The data of a fixed size element is stored in little-endian and converted when appended
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_column_get_element_data(
+     libesedb_arrow_column_t *arrow_column,
+     size_t element_data_size,
+     uint8_t **element_data,
+     libcerror_error_t **error )
+{
+	void *reallocation                 = NULL;
+	static char *function              = "libesedb_arrow_column_get_element_data";
+	size_t allocated_element_data_size = 0;
+
+	if( arrow_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow column.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element data.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_column->value_size != 0 )
+	{
+		if( element_data_size != arrow_column->value_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported element data size: %" PRIzd ".",
+			 function,
+			 element_data_size );
+
+			return( -1 );
+		}
+		*element_data = arrow_column->element_value_data;
+
+		return( 1 );
+	}
+	/* The offsets of a variable size column type are 32-bit signed integers
+	 */
+	if( element_data_size > ( (size_t) INT32_MAX - arrow_column->element_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid element data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	allocated_element_data_size = arrow_column->element_data_size + element_data_size;
+
+	if( allocated_element_data_size > arrow_column->allocated_element_data_size )
+	{
+		if( allocated_element_data_size < ( arrow_column->allocated_element_data_size * 2 ) )
+		{
+			allocated_element_data_size = arrow_column->allocated_element_data_size * 2;
+		}
+		if( allocated_element_data_size > (size_t) INT32_MAX )
+		{
+			allocated_element_data_size = (size_t) INT32_MAX;
+		}
+		reallocation = memory_reallocate(
+		                arrow_column->element_data,
+		                sizeof( uint8_t ) * allocated_element_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize element data.",
+			 function );
+
+			return( -1 );
+		}
+		arrow_column->element_data                = (uint8_t *) reallocation;
+		arrow_column->allocated_element_data_size = allocated_element_data_size;
+	}
+	*element_data = &( arrow_column->element_data[ arrow_column->element_data_size ] );
+
+	return( 1 );
+}
+
+/* Appends an element to an Arrow column
+ * The element data must have been stored in the buffer retrieved by libesedb_arrow_column_get_element_data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_column_append_element(
+     libesedb_arrow_column_t *arrow_column,
+     size_t element_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_arrow_column_append_element";
+	size_t element_index  = 0;
+	uint16_t value_16bit  = 0;
+	uint32_t value_32bit  = 0;
+	uint64_t value_64bit  = 0;
+	uint8_t element_bit   = 0;
+
+	if( arrow_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_arrow_column_resize_elements(
+	     arrow_column,
+	     arrow_column->number_of_elements + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize elements.",
+		 function );
+
+		return( -1 );
+	}
+	element_index = (size_t) arrow_column->number_of_elements;
+
+	if( arrow_column->value_size == 0 )
+	{
+		if( element_data_size > ( arrow_column->allocated_element_data_size - arrow_column->element_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid element data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		arrow_column->element_data_size += element_data_size;
+
+		arrow_column->element_offsets[ element_index + 1 ] = (int32_t) arrow_column->element_data_size;
+	}
+	else if( element_data_size != arrow_column->value_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported element data size: %" PRIzd ".",
+		 function,
+		 element_data_size );
+
+		return( -1 );
+	}
+	else if( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_BOOLEAN )
+	{
+		element_bit = (uint8_t) ( 1 << ( element_index % 8 ) );
+
+		if( arrow_column->element_value_data[ 0 ] != 0 )
+		{
+			arrow_column->element_data[ element_index / 8 ] |= element_bit;
+		}
+		else
+		{
+			arrow_column->element_data[ element_index / 8 ] &= (uint8_t) ~element_bit;
+		}
+	}
+	else
+	{
+		switch( arrow_column->value_size )
+		{
+			case 1:
+				arrow_column->element_data[ element_index ] = arrow_column->element_value_data[ 0 ];
+				break;
+
+			case 2:
+				byte_stream_copy_to_uint16_little_endian(
+				 arrow_column->element_value_data,
+				 value_16bit );
+
+				( (uint16_t *) arrow_column->element_data )[ element_index ] = value_16bit;
+				break;
+
+			case 4:
+				byte_stream_copy_to_uint32_little_endian(
+				 arrow_column->element_value_data,
+				 value_32bit );
+
+				( (uint32_t *) arrow_column->element_data )[ element_index ] = value_32bit;
+				break;
+
+			case 8:
+				byte_stream_copy_to_uint64_little_endian(
+				 arrow_column->element_value_data,
+				 value_64bit );
+
+				( (uint64_t *) arrow_column->element_data )[ element_index ] = value_64bit;
+				break;
+
+			default:
+				if( memory_copy(
+				     &( arrow_column->element_data[ element_index * arrow_column->value_size ] ),
+				     arrow_column->element_value_data,
+				     arrow_column->value_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy element data.",
+					 function );
+
+					return( -1 );
+				}
+				break;
+		}
+	}
+	arrow_column->number_of_elements += 1;
+
+	return( 1 );
+}
+
+/* Appends a value to an Arrow column
+ * The elements of a value that is not NULL must have been appended before
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_column_append_value(
+     libesedb_arrow_column_t *arrow_column,
+     uint8_t is_null,
+     libcerror_error_t **error )
+{
+	uint8_t *element_data = NULL;
+	static char *function = "libesedb_arrow_column_append_value";
+	size_t value_index    = 0;
+
+	if( arrow_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow column.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_column->number_of_values >= arrow_column->maximum_number_of_values )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid Arrow column - number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	value_index = (size_t) arrow_column->number_of_values;
+
+	if( is_null != 0 )
+	{
+		/* A NULL value of a column that is not multi valued still occupies an element
+		 */
+		if( arrow_column->is_multi_valued == 0 )
+		{
+			if( libesedb_arrow_column_get_element_data(
+			     arrow_column,
+			     arrow_column->value_size,
+			     &element_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element data.",
+				 function );
+
+				return( -1 );
+			}
+			if( arrow_column->value_size != 0 )
+			{
+				if( memory_set(
+				     element_data,
+				     0,
+				     arrow_column->value_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear element data.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( libesedb_arrow_column_append_element(
+			     arrow_column,
+			     arrow_column->value_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append element.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		arrow_column->number_of_null_values += 1;
+	}
+	else
+	{
+		arrow_column->validity_bitmap[ value_index / 8 ] |= (uint8_t) ( 1 << ( value_index % 8 ) );
+	}
+	if( arrow_column->is_multi_valued != 0 )
+	{
+		arrow_column->list_offsets[ value_index + 1 ] = (int32_t) arrow_column->number_of_elements;
+	}
+	else if( arrow_column->number_of_elements != ( arrow_column->number_of_values + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid Arrow column - number of elements value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	arrow_column->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Appends the data of a record value as an element to an Arrow column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_column_append_record_element(
+     libesedb_arrow_column_t *arrow_column,
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libcerror_error_t **error )
+{
+	libesedb_data_type_value_t *data_type_value = NULL;
+	uint8_t *element_data                       = NULL;
+	static char *function                       = "libesedb_arrow_column_append_record_element";
+	size_t element_data_size                    = 0;
+	int result                                  = 0;
+
+	if( arrow_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow column.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_column->value_size != 0 )
+	{
+		data_type_value = &( internal_record->data_type_values[ value_entry ] );
+
+		/* Long values and compressed values have no fixed size
+		 */
+		if( ( data_type_value->data_flags != 0 )
+		 || ( (size_t) data_type_value->data_size != arrow_column->value_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value: %d.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+		element_data_size = arrow_column->value_size;
+	}
+	else if( ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	      || ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		result = libesedb_record_get_value_utf8_string_size(
+		          (libesedb_record_t *) internal_record,
+		          value_entry,
+		          &element_data_size,
+		          error );
+	}
+	else if( ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	      || ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		result = libesedb_record_get_value_binary_data_size(
+		          (libesedb_record_t *) internal_record,
+		          value_entry,
+		          &element_data_size,
+		          error );
+	}
+	else
+	{
+		result = libesedb_record_get_value_data_size(
+		          (libesedb_record_t *) internal_record,
+		          value_entry,
+		          &element_data_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of value: %d.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( libesedb_arrow_column_get_element_data(
+	     arrow_column,
+	     element_data_size,
+	     &element_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve element data.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_data_size > 0 )
+	{
+		if( arrow_column->value_size != 0 )
+		{
+			if( memory_copy(
+			     element_data,
+			     &( internal_record->values_data[ data_type_value->data_offset ] ),
+			     element_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy value: %d.",
+				 function,
+				 value_entry );
+
+				return( -1 );
+			}
+			result = 1;
+		}
+		else if( ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+		      || ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+		{
+			result = libesedb_record_get_value_utf8_string(
+			          (libesedb_record_t *) internal_record,
+			          value_entry,
+			          element_data,
+			          element_data_size,
+			          error );
+
+			/* The end-of-string character is not stored
+			 */
+			element_data_size -= 1;
+		}
+		else if( ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+		      || ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+		{
+			result = libesedb_record_get_value_binary_data(
+			          (libesedb_record_t *) internal_record,
+			          value_entry,
+			          element_data,
+			          element_data_size,
+			          error );
+		}
+		else
+		{
+			result = libesedb_record_get_value_data(
+			          (libesedb_record_t *) internal_record,
+			          value_entry,
+			          element_data,
+			          element_data_size,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_arrow_column_append_element(
+	     arrow_column,
+	     element_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append element.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the data of a long value as an element to an Arrow column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_column_append_long_value_element(
+     libesedb_arrow_column_t *arrow_column,
+     libesedb_long_value_t *long_value,
+     libcerror_error_t **error )
+{
+	uint8_t *element_data    = NULL;
+	static char *function    = "libesedb_arrow_column_append_long_value_element";
+	size64_t data_size       = 0;
+	size_t element_data_size = 0;
+	int result               = 0;
+
+	if( arrow_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow column.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_column->value_size != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported long value of fixed size column type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	 || ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		result = libesedb_long_value_get_utf8_string_size(
+		          long_value,
+		          &element_data_size,
+		          error );
+	}
+	else
+	{
+		result = libesedb_long_value_get_data_size(
+		          long_value,
+		          &data_size,
+		          error );
+
+		if( data_size > (size64_t) INT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid long value data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		element_data_size = (size_t) data_size;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve long value size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_arrow_column_get_element_data(
+	     arrow_column,
+	     element_data_size,
+	     &element_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve element data.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_data_size > 0 )
+	{
+		if( ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+		 || ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+		{
+			result = libesedb_long_value_get_utf8_string(
+			          long_value,
+			          element_data,
+			          element_data_size,
+			          error );
+
+			/* The end-of-string character is not stored
+			 */
+			element_data_size -= 1;
+		}
+		else
+		{
+			result = libesedb_long_value_get_data(
+			          long_value,
+			          element_data,
+			          element_data_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve long value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_arrow_column_append_element(
+	     arrow_column,
+	     element_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append element.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a specific value of a multi value as an element to an Arrow column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_column_append_multi_value_element(
+     libesedb_arrow_column_t *arrow_column,
+     libesedb_multi_value_t *multi_value,
+     int multi_value_index,
+     libcerror_error_t **error )
+{
+	uint8_t *element_data    = NULL;
+	static char *function    = "libesedb_arrow_column_append_multi_value_element";
+	size_t element_data_size = 0;
+	int result               = 0;
+
+	if( arrow_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow column.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	 || ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		result = libesedb_multi_value_get_value_utf8_string_size(
+		          multi_value,
+		          multi_value_index,
+		          &element_data_size,
+		          error );
+	}
+	else if( ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	      || ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		result = libesedb_multi_value_get_value_binary_data_size(
+		          multi_value,
+		          multi_value_index,
+		          &element_data_size,
+		          error );
+	}
+	else
+	{
+		result = libesedb_multi_value_get_value_data_size(
+		          multi_value,
+		          multi_value_index,
+		          &element_data_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of multi value: %d.",
+		 function,
+		 multi_value_index );
+
+		return( -1 );
+	}
+	if( libesedb_arrow_column_get_element_data(
+	     arrow_column,
+	     element_data_size,
+	     &element_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve element data.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_data_size > 0 )
+	{
+		if( ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+		 || ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+		{
+			result = libesedb_multi_value_get_value_utf8_string(
+			          multi_value,
+			          multi_value_index,
+			          element_data,
+			          element_data_size,
+			          error );
+
+			/* The end-of-string character is not stored
+			 */
+			element_data_size -= 1;
+		}
+		else if( ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+		      || ( arrow_column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+		{
+			result = libesedb_multi_value_get_value_binary_data(
+			          multi_value,
+			          multi_value_index,
+			          element_data,
+			          element_data_size,
+			          error );
+		}
+		else
+		{
+			result = libesedb_multi_value_get_value_data(
+			          multi_value,
+			          multi_value_index,
+			          element_data,
+			          element_data_size,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve multi value: %d.",
+			 function,
+			 multi_value_index );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_arrow_column_append_element(
+	     arrow_column,
+	     element_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append element.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a record value to an Arrow column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_column_append_record_value(
+     libesedb_arrow_column_t *arrow_column,
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libcerror_error_t **error )
+{
+	libesedb_data_type_value_t *data_type_value = NULL;
+	libesedb_long_value_t *long_value           = NULL;
+	libesedb_multi_value_t *multi_value         = NULL;
+	static char *function                       = "libesedb_arrow_column_append_record_value";
+	uint8_t is_null                             = 0;
+	int multi_value_index                       = 0;
+	int number_of_multi_values                  = 0;
+	int result                                  = 0;
+
+	if( arrow_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow column.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->data_type_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing data type values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_entry < 0 )
+	 || ( internal_record->table_definition == NULL )
+	 || ( internal_record->table_definition->record_layout == NULL )
+	 || ( value_entry >= internal_record->table_definition->record_layout->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_type_value = &( internal_record->data_type_values[ value_entry ] );
+
+	if( ( data_type_value->is_set == 0 )
+	 || ( ( data_type_value->data_size == 0 )
+	  &&  ( data_type_value->data_flags == 0 ) ) )
+	{
+		is_null = 1;
+	}
+	else if( ( data_type_value->data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+	{
+		result = libesedb_record_get_long_value(
+		          (libesedb_record_t *) internal_record,
+		          value_entry,
+		          &long_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve long value: %d.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			is_null = 1;
+		}
+		else
+		{
+			if( libesedb_arrow_column_append_long_value_element(
+			     arrow_column,
+			     long_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append long value: %d.",
+				 function,
+				 value_entry );
+
+				goto on_error;
+			}
+			if( libesedb_long_value_free(
+			     &long_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free long value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	else if( ( data_type_value->data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+	{
+		if( arrow_column->is_multi_valued == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported multi value: %d of column that is not multi valued.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+		result = libesedb_record_get_multi_value(
+		          (libesedb_record_t *) internal_record,
+		          value_entry,
+		          &multi_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve multi value: %d.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			is_null = 1;
+		}
+		else
+		{
+			if( libesedb_multi_value_get_number_of_values(
+			     multi_value,
+			     &number_of_multi_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of multi values.",
+				 function );
+
+				goto on_error;
+			}
+			for( multi_value_index = 0;
+			     multi_value_index < number_of_multi_values;
+			     multi_value_index++ )
+			{
+				if( libesedb_arrow_column_append_multi_value_element(
+				     arrow_column,
+				     multi_value,
+				     multi_value_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append multi value: %d.",
+					 function,
+					 multi_value_index );
+
+					goto on_error;
+				}
+			}
+			if( libesedb_multi_value_free(
+			     &multi_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free multi value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	else if( libesedb_arrow_column_append_record_element(
+	          arrow_column,
+	          internal_record,
+	          value_entry,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value: %d.",
+		 function,
+		 value_entry );
+
+		goto on_error;
+	}
+	if( libesedb_arrow_column_append_value(
+	     arrow_column,
+	     is_null,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value: %d.",
+		 function,
+		 value_entry );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( multi_value != NULL )
+	{
+		libesedb_multi_value_free(
+		 &multi_value,
+		 NULL );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports an Arrow column
+ * The buffers of the Arrow column are moved to the array
+ * The schema and array are overwritten and must have been released before
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_arrow_column_export(
+     libesedb_arrow_column_t *arrow_column,
+     const uint8_t *name,
+     size_t name_size,
+     struct ArrowSchema *schema,
+     struct ArrowArray *array,
+     libcerror_error_t **error )
+{
+	libesedb_arrow_array_private_t *array_private = NULL;
+	struct ArrowArray *element_array              = NULL;
+	static char *function                         = "libesedb_arrow_column_export";
+	int64_t number_of_buffers                     = 2;
+
+	if( arrow_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow column.",
+		 function );
+
+		return( -1 );
+	}
+	if( schema == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid schema.",
+		 function );
+
+		return( -1 );
+	}
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	/* The release callbacks are cleared so the schema and array can be released on error
+	 */
+	schema->release = NULL;
+	array->release  = NULL;
+
+	if( arrow_column->number_of_values != arrow_column->maximum_number_of_values )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid Arrow column - number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_column->value_size == 0 )
+	{
+		number_of_buffers = 3;
+	}
+	if( libesedb_arrow_schema_initialize(
+	     schema,
+	     ( arrow_column->is_multi_valued != 0 ) ? "+l" : arrow_column->format,
+	     name,
+	     name_size,
+	     ARROW_FLAG_NULLABLE,
+	     ( arrow_column->is_multi_valued != 0 ) ? 1 : 0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize schema.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_column->is_multi_valued != 0 )
+	{
+		if( libesedb_arrow_schema_initialize(
+		     schema->children[ 0 ],
+		     arrow_column->format,
+		     (uint8_t *) "item",
+		     4,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize element schema.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_arrow_array_initialize(
+		     array,
+		     arrow_column->number_of_values,
+		     arrow_column->number_of_null_values,
+		     2,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize array.",
+			 function );
+
+			goto on_error;
+		}
+		array_private = (libesedb_arrow_array_private_t *) array->private_data;
+
+		array_private->buffers[ 0 ] = arrow_column->validity_bitmap;
+		array_private->buffers[ 1 ] = arrow_column->list_offsets;
+
+		arrow_column->validity_bitmap = NULL;
+		arrow_column->list_offsets    = NULL;
+
+		element_array = array->children[ 0 ];
+
+		/* The elements of a list do not contain NULL values
+		 */
+		if( libesedb_arrow_array_initialize(
+		     element_array,
+		     arrow_column->number_of_elements,
+		     0,
+		     number_of_buffers,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize element array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libesedb_arrow_array_initialize(
+		     array,
+		     arrow_column->number_of_values,
+		     arrow_column->number_of_null_values,
+		     number_of_buffers,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize array.",
+			 function );
+
+			goto on_error;
+		}
+		element_array = array;
+
+		array_private = (libesedb_arrow_array_private_t *) array->private_data;
+
+		array_private->buffers[ 0 ] = arrow_column->validity_bitmap;
+
+		arrow_column->validity_bitmap = NULL;
+	}
+	array_private = (libesedb_arrow_array_private_t *) element_array->private_data;
+
+	if( arrow_column->value_size == 0 )
+	{
+		array_private->buffers[ 1 ] = arrow_column->element_offsets;
+		array_private->buffers[ 2 ] = arrow_column->element_data;
+
+		arrow_column->element_offsets = NULL;
+	}
+	else
+	{
+		array_private->buffers[ 1 ] = arrow_column->element_data;
+	}
+	arrow_column->element_data = NULL;
+
+	return( 1 );
+
+on_error:
+	libesedb_arrow_array_release(
+	 array );
+
+	libesedb_arrow_schema_release(
+	 schema );
+
+	return( -1 );
+}
+
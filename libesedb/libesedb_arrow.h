@@ -0,0 +1,287 @@
+/*
+ * Apache Arrow C data interface functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_INTERNAL_ARROW_H )
+#define _LIBESEDB_INTERNAL_ARROW_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_long_value.h"
+#include "libesedb_multi_value.h"
+#include "libesedb_record.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBESEDB )
+
+#include <libesedb/arrow.h>
+
+/* Define HAVE_LOCAL_LIBESEDB for local use of libesedb
+ * The definitions in <libesedb/arrow.h> are copied here
+ * for local use of libesedb
+ */
+#else
+
+#if !defined( ARROW_C_DATA_INTERFACE )
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED	1
+#define ARROW_FLAG_NULLABLE		2
+#define ARROW_FLAG_MAP_KEYS_SORTED	4
+
+struct ArrowSchema
+{
+	const char *format;
+	const char *name;
+	const char *metadata;
+	int64_t flags;
+	int64_t n_children;
+	struct ArrowSchema **children;
+	struct ArrowSchema *dictionary;
+
+	void (*release)(
+	       struct ArrowSchema *schema );
+
+	void *private_data;
+};
+
+struct ArrowArray
+{
+	int64_t length;
+	int64_t null_count;
+	int64_t offset;
+	int64_t n_buffers;
+	int64_t n_children;
+	const void **buffers;
+	struct ArrowArray **children;
+	struct ArrowArray *dictionary;
+
+	void (*release)(
+	       struct ArrowArray *array );
+
+	void *private_data;
+};
+
+#endif /* !defined( ARROW_C_DATA_INTERFACE ) */
+
+#endif /* !defined( HAVE_LOCAL_LIBESEDB ) */
+
+typedef struct libesedb_arrow_schema_private libesedb_arrow_schema_private_t;
+
+struct libesedb_arrow_schema_private
+{
+	/* The name
+	 */
+	char *name;
+
+	/* The children
+	 */
+	struct ArrowSchema **children;
+
+	/* The number of children
+	 */
+	int64_t number_of_children;
+};
+
+typedef struct libesedb_arrow_array_private libesedb_arrow_array_private_t;
+
+struct libesedb_arrow_array_private
+{
+	/* The buffers
+	 */
+	void *buffers[ 3 ];
+
+	/* The children
+	 */
+	struct ArrowArray **children;
+
+	/* The number of children
+	 */
+	int64_t number_of_children;
+};
+
+typedef struct libesedb_arrow_column libesedb_arrow_column_t;
+
+struct libesedb_arrow_column
+{
+	/* The column type
+	 */
+	uint32_t column_type;
+
+	/* The (element) format
+	 */
+	const char *format;
+
+	/* The value size of a fixed size column type
+	 * 0 represents a variable size column type
+	 */
+	size_t value_size;
+
+	/* Value to indicate the column is multi valued
+	 * The values of a multi valued column are stored as a list of elements
+	 */
+	uint8_t is_multi_valued;
+
+	/* The number of values
+	 */
+	int64_t number_of_values;
+
+	/* The maximum number of values
+	 */
+	int64_t maximum_number_of_values;
+
+	/* The number of NULL values
+	 */
+	int64_t number_of_null_values;
+
+	/* The validity bitmap
+	 */
+	uint8_t *validity_bitmap;
+
+	/* The list offsets of a multi valued column
+	 */
+	int32_t *list_offsets;
+
+	/* The number of elements
+	 */
+	int64_t number_of_elements;
+
+	/* The maximum number of elements
+	 */
+	int64_t maximum_number_of_elements;
+
+	/* The element offsets of a variable size column type
+	 */
+	int32_t *element_offsets;
+
+	/* The element data
+	 */
+	uint8_t *element_data;
+
+	/* The element data size
+	 */
+	size_t element_data_size;
+
+	/* The allocated element data size
+	 */
+	size_t allocated_element_data_size;
+
+	/* The fixed size element value data
+	 */
+	uint8_t element_value_data[ 16 ];
+};
+
+void libesedb_arrow_schema_release(
+      struct ArrowSchema *schema );
+
+int libesedb_arrow_schema_initialize(
+     struct ArrowSchema *schema,
+     const char *format,
+     const uint8_t *name,
+     size_t name_size,
+     int64_t flags,
+     int64_t number_of_children,
+     libcerror_error_t **error );
+
+void libesedb_arrow_array_release(
+      struct ArrowArray *array );
+
+int libesedb_arrow_array_initialize(
+     struct ArrowArray *array,
+     int64_t length,
+     int64_t null_count,
+     int64_t number_of_buffers,
+     int64_t number_of_children,
+     libcerror_error_t **error );
+
+int libesedb_arrow_column_initialize(
+     libesedb_arrow_column_t **arrow_column,
+     uint32_t column_type,
+     uint8_t is_multi_valued,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int libesedb_arrow_column_free(
+     libesedb_arrow_column_t **arrow_column,
+     libcerror_error_t **error );
+
+int libesedb_arrow_column_resize_elements(
+     libesedb_arrow_column_t *arrow_column,
+     int64_t number_of_elements,
+     libcerror_error_t **error );
+
+int libesedb_arrow_column_get_element_data(
+     libesedb_arrow_column_t *arrow_column,
+     size_t element_data_size,
+     uint8_t **element_data,
+     libcerror_error_t **error );
+
+int libesedb_arrow_column_append_element(
+     libesedb_arrow_column_t *arrow_column,
+     size_t element_data_size,
+     libcerror_error_t **error );
+
+int libesedb_arrow_column_append_value(
+     libesedb_arrow_column_t *arrow_column,
+     uint8_t is_null,
+     libcerror_error_t **error );
+
+int libesedb_arrow_column_append_record_element(
+     libesedb_arrow_column_t *arrow_column,
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libcerror_error_t **error );
+
+int libesedb_arrow_column_append_long_value_element(
+     libesedb_arrow_column_t *arrow_column,
+     libesedb_long_value_t *long_value,
+     libcerror_error_t **error );
+
+int libesedb_arrow_column_append_multi_value_element(
+     libesedb_arrow_column_t *arrow_column,
+     libesedb_multi_value_t *multi_value,
+     int multi_value_index,
+     libcerror_error_t **error );
+
+int libesedb_arrow_column_append_record_value(
+     libesedb_arrow_column_t *arrow_column,
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libcerror_error_t **error );
+
+int libesedb_arrow_column_export(
+     libesedb_arrow_column_t *arrow_column,
+     const uint8_t *name,
+     size_t name_size,
+     struct ArrowSchema *schema,
+     struct ArrowArray *array,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_INTERNAL_ARROW_H ) */
+
@@ -930,7 +930,7 @@ int libesedb_catalog_read_file_io_handle(
 
 	if( libfcache_cache_initialize(
 	     &catalog_values_cache,
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_TREE_VALUES,
+	     io_handle->maximum_cache_entries[ LIBESEDB_CACHE_TYPE_TREE_VALUES ],
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -165,6 +165,11 @@ int libesedb_catalog_definition_free(
 			memory_free(
 			 ( *catalog_definition )->default_value );
 		}
+		if( ( *catalog_definition )->key_columns_data != NULL )
+		{
+			memory_free(
+			 ( *catalog_definition )->key_columns_data );
+		}
 		memory_free(
 		 *catalog_definition );
 
@@ -415,6 +420,12 @@ int libesedb_catalog_definition_read_data(
 	 ( (esedb_data_definition_t *) fixed_size_data_type_value_data )->space_usage,
 	 catalog_definition->size );
 
+	if( last_fixed_size_data_type >= 6 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_data_definition_t *) fixed_size_data_type_value_data )->flags,
+		 catalog_definition->flags );
+	}
 	if( catalog_definition->type == LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN )
 	{
 		byte_stream_copy_to_uint32_little_endian(
@@ -480,10 +491,6 @@ int libesedb_catalog_definition_read_data(
 		 data_type_number++,
 		 catalog_definition->size );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (esedb_data_definition_t *) fixed_size_data_type_value_data )->flags,
-		 value_32bit );
-
 		if( last_fixed_size_data_type >= 6 )
 		{
 			if( catalog_definition->type == LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN )
@@ -492,9 +499,9 @@ int libesedb_catalog_definition_read_data(
 				 "%s: (%03" PRIu16 ") flags\t\t\t\t\t: 0x%08" PRIx32 "\n",
 				 function,
 				 data_type_number++,
-				 value_32bit );
+				 catalog_definition->flags );
 				libesedb_debug_print_column_group_of_bits(
-				 value_32bit );
+				 catalog_definition->flags );
 				libcnotify_printf(
 				 "\n" );
 			}
@@ -504,9 +511,9 @@ int libesedb_catalog_definition_read_data(
 				 "%s: (%03" PRIu16 ") flags\t\t\t\t\t: 0x%08" PRIx32 "\n",
 				 function,
 				 data_type_number++,
-				 value_32bit );
+				 catalog_definition->flags );
 				libesedb_debug_print_index_group_of_bits(
-				 value_32bit );
+				 catalog_definition->flags );
 				libcnotify_printf(
 				 "\n" );
 			}
@@ -516,7 +523,7 @@ int libesedb_catalog_definition_read_data(
 				 "%s: (%03" PRIu16 ") flags\t\t\t\t\t: 0x%08" PRIx32 "\n",
 				 function,
 				 data_type_number++,
-				 value_32bit );
+				 catalog_definition->flags );
 			}
 		}
 		if( last_fixed_size_data_type >= 7 )
@@ -1040,33 +1047,75 @@ int libesedb_catalog_definition_read_data(
 #endif
 					break;
 
-#if defined( HAVE_DEBUG_OUTPUT )
 				case 132:
-					if( libcnotify_verbose != 0 )
+					/* The MSB signifies that the variable size data type is empty
+					 */
+					if( ( variable_size_data_type_size & 0x8000 ) == 0 )
 					{
-						/* The MSB signifies that the variable size data type is empty
-						 */
-						if( ( variable_size_data_type_size & 0x8000 ) == 0 )
+						catalog_definition->key_columns_data_size = (size_t) ( variable_size_data_type_size - previous_variable_size_data_type_size );
+
+						catalog_definition->key_columns_data = (uint8_t *) memory_allocate(
+						                                        sizeof( uint8_t ) * catalog_definition->key_columns_data_size );
+
+						if( catalog_definition->key_columns_data == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+							 "%s: unable to create key columns data.",
+							 function );
+
+							catalog_definition->key_columns_data_size = 0;
+
+							return( -1 );
+						}
+						if( memory_copy(
+						     catalog_definition->key_columns_data,
+						     &( variable_size_data_type_value_data[ previous_variable_size_data_type_size ] ),
+						     catalog_definition->key_columns_data_size ) == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+							 "%s: unable to set key columns data.",
+							 function );
+
+							memory_free(
+							 catalog_definition->key_columns_data );
+
+							catalog_definition->key_columns_data      = NULL;
+							catalog_definition->key_columns_data_size = 0;
+
+							return( -1 );
+						}
+#if defined( HAVE_DEBUG_OUTPUT )
+						if( libcnotify_verbose != 0 )
 						{
 							libcnotify_printf(
 							 "%s: (%03" PRIu8 ") KeyFldIDs:\n",
 							 function,
 							 data_type_number );
 							libcnotify_print_data(
-							 &( variable_size_data_type_value_data[ previous_variable_size_data_type_size ] ),
-							 variable_size_data_type_size - previous_variable_size_data_type_size,
+							 catalog_definition->key_columns_data,
+							 catalog_definition->key_columns_data_size,
 							 0 );
 						}
-						else
-						{
-							libcnotify_printf(
-							 "%s: (%03" PRIu8 ") KeyFldIDs\t\t\t\t: <NULL>\n",
-							 function,
-							 data_type_number );
-						}
+#endif
 					}
+#if defined( HAVE_DEBUG_OUTPUT )
+					else if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: (%03" PRIu8 ") KeyFldIDs\t\t\t\t: <NULL>\n",
+						 function,
+						 data_type_number );
+					}
+#endif
 					break;
 
+#if defined( HAVE_DEBUG_OUTPUT )
 				case 133:
 					if( libcnotify_verbose != 0 )
 					{
@@ -1293,6 +1342,211 @@ int libesedb_catalog_definition_get_column_type(
 	return( 1 );
 }
 
+/* Retrieves the size of a key column entry in the key columns (KeyFldIDs) data
+ * The key columns data either contains 4-byte index segments, consisting of flags, a reserved
+ * byte and a 16-bit column identifier, or 2-byte signed column identifiers, where a negative
+ * identifier indicates a descending key column
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libesedb_catalog_definition_get_key_column_entry_size(
+     libesedb_catalog_definition_t *catalog_definition,
+     size_t *entry_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libesedb_catalog_definition_get_key_column_entry_size";
+	size_t data_offset         = 0;
+	uint16_t column_identifier = 0;
+
+	if( catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( catalog_definition->key_columns_data == NULL )
+	 || ( catalog_definition->key_columns_data_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( catalog_definition->key_columns_data_size % 4 ) == 0 )
+	{
+		for( data_offset = 0;
+		     data_offset < catalog_definition->key_columns_data_size;
+		     data_offset += 4 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( catalog_definition->key_columns_data[ data_offset + 2 ] ),
+			 column_identifier );
+
+			if( ( ( catalog_definition->key_columns_data[ data_offset ] & 0xf8 ) != 0 )
+			 || ( catalog_definition->key_columns_data[ data_offset + 1 ] != 0 )
+			 || ( column_identifier == 0 ) )
+			{
+				break;
+			}
+		}
+		if( data_offset >= catalog_definition->key_columns_data_size )
+		{
+			*entry_size = 4;
+
+			return( 1 );
+		}
+	}
+	if( ( catalog_definition->key_columns_data_size % 2 ) == 0 )
+	{
+		*entry_size = 2;
+
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of key columns
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_definition_get_number_of_key_columns(
+     libesedb_catalog_definition_t *catalog_definition,
+     int *number_of_key_columns,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_definition_get_number_of_key_columns";
+	size_t entry_size     = 0;
+	int result            = 0;
+
+	if( number_of_key_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of key columns.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_catalog_definition_get_key_column_entry_size(
+	          catalog_definition,
+	          &entry_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key column entry size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*number_of_key_columns = 0;
+	}
+	else
+	{
+		*number_of_key_columns = (int) ( catalog_definition->key_columns_data_size / entry_size );
+	}
+	return( 1 );
+}
+
+/* Retrieves the column identifier of a specific key column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_definition_get_key_column_identifier(
+     libesedb_catalog_definition_t *catalog_definition,
+     int key_column_index,
+     uint32_t *column_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_definition_get_key_column_identifier";
+	size_t data_offset    = 0;
+	size_t entry_size     = 0;
+	uint16_t value_16bit  = 0;
+	int result            = 0;
+
+	if( column_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column identifier.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_catalog_definition_get_key_column_entry_size(
+	          catalog_definition,
+	          &entry_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key column entry size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_column_index < 0 )
+	 || ( (size_t) key_column_index >= ( catalog_definition->key_columns_data_size / entry_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = (size_t) key_column_index * entry_size;
+
+	if( entry_size == 4 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( catalog_definition->key_columns_data[ data_offset + 2 ] ),
+		 value_16bit );
+	}
+	else
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( catalog_definition->key_columns_data[ data_offset ] ),
+		 value_16bit );
+
+		/* A negative column identifier indicates a descending key column
+		 */
+		if( ( value_16bit & 0x8000 ) != 0 )
+		{
+			value_16bit = (uint16_t) ( ( ~value_16bit ) + 1 );
+		}
+	}
+	*column_identifier = (uint32_t) value_16bit;
+
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-8 encoded string string of the catalog definition name
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
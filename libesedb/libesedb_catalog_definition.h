@@ -62,6 +62,10 @@ struct libesedb_catalog_definition
 	 */
 	uint32_t size;
 
+	/* The flags (group of bits)
+	 */
+	uint32_t flags;
+
 	/* The codepage
 	 */
 	uint32_t codepage;
@@ -99,6 +103,14 @@ struct libesedb_catalog_definition
 	/* The default value size
 	 */
 	size_t default_value_size;
+
+	/* The key columns (KeyFldIDs) data
+	 */
+	uint8_t *key_columns_data;
+
+	/* The key columns data size
+	 */
+	size_t key_columns_data_size;
 };
 
 int libesedb_catalog_definition_initialize(
@@ -126,6 +138,22 @@ int libesedb_catalog_definition_get_column_type(
      uint32_t *column_type,
      libcerror_error_t **error );
 
+int libesedb_catalog_definition_get_key_column_entry_size(
+     libesedb_catalog_definition_t *catalog_definition,
+     size_t *entry_size,
+     libcerror_error_t **error );
+
+int libesedb_catalog_definition_get_number_of_key_columns(
+     libesedb_catalog_definition_t *catalog_definition,
+     int *number_of_key_columns,
+     libcerror_error_t **error );
+
+int libesedb_catalog_definition_get_key_column_identifier(
+     libesedb_catalog_definition_t *catalog_definition,
+     int key_column_index,
+     uint32_t *column_identifier,
+     libcerror_error_t **error );
+
 int libesedb_catalog_definition_get_utf8_name_size(
      libesedb_catalog_definition_t *catalog_definition,
      size_t *utf8_string_size,
@@ -26,6 +26,10 @@
 #include "libesedb_checksum.h"
 #include "libesedb_libcerror.h"
 
+#if defined( HAVE_LIBESEDB_CHECKSUM_X86_SIMD )
+#include <immintrin.h>
+#endif
+
 /* The largest primary (or scalar) available
  * supported by a single load and store instruction
  */
@@ -52,6 +56,418 @@ const uint8_t libesedb_checksum_ecc32_include_lookup_table[ 256 ] = {
 	0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0
 };
 
+#if defined( HAVE_LIBESEDB_CHECKSUM_X86_SIMD )
+
+/* The instruction set used to calculate the checksums
+ * -1 represents that the instruction set has not been determined yet
+ */
+static int libesedb_checksum_instruction_set = -1;
+
+/* Determines the row parity bits and column XOR of 4 rows of 16 bytes using SSE2
+ */
+static __attribute__((target("sse2"))) void libesedb_checksum_ecc32_sse2_4_rows(
+                                             const uint8_t *buffer,
+                                             __m128i *column_xor,
+                                             int *parity_bits )
+{
+	__m128i first_row  = _mm_loadu_si128( (const __m128i *) &( buffer[ 0 ] ) );
+	__m128i second_row = _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) );
+	__m128i third_row  = _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) );
+	__m128i fourth_row = _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) );
+	__m128i first_xor  = _mm_setzero_si128();
+	__m128i second_xor = _mm_setzero_si128();
+	__m128i row_xor    = _mm_setzero_si128();
+
+	*column_xor = _mm_xor_si128(
+	               *column_xor,
+	               _mm_xor_si128(
+	                _mm_xor_si128( first_row, second_row ),
+	                _mm_xor_si128( third_row, fourth_row ) ) );
+
+	/* Transpose the rows so that every 32-bit lane contains the XOR of one row
+	 */
+	first_xor  = _mm_xor_si128(
+	              _mm_unpacklo_epi32( first_row, second_row ),
+	              _mm_unpackhi_epi32( first_row, second_row ) );
+	second_xor = _mm_xor_si128(
+	              _mm_unpacklo_epi32( third_row, fourth_row ),
+	              _mm_unpackhi_epi32( third_row, fourth_row ) );
+	row_xor    = _mm_xor_si128(
+	              _mm_unpacklo_epi64( first_xor, second_xor ),
+	              _mm_unpackhi_epi64( first_xor, second_xor ) );
+
+	/* Fold every 32-bit lane into its parity bit
+	 */
+	row_xor = _mm_xor_si128( row_xor, _mm_srli_epi32( row_xor, 16 ) );
+	row_xor = _mm_xor_si128( row_xor, _mm_srli_epi32( row_xor, 8 ) );
+	row_xor = _mm_xor_si128( row_xor, _mm_srli_epi32( row_xor, 4 ) );
+	row_xor = _mm_xor_si128( row_xor, _mm_srli_epi32( row_xor, 2 ) );
+	row_xor = _mm_xor_si128( row_xor, _mm_srli_epi32( row_xor, 1 ) );
+
+	*parity_bits = _mm_movemask_ps(
+	                _mm_castsi128_ps(
+	                 _mm_slli_epi32( row_xor, 31 ) ) );
+}
+
+/* Calculates the ECC-32 of rows of 16 bytes using SSE2
+ * Returns the number of bytes processed
+ */
+static __attribute__((target("sse2"))) size_t libesedb_checksum_calculate_ecc32_rows_sse2(
+                                               const uint8_t *buffer,
+                                               size_t size,
+                                               uint32_t *ecc_checksum_value,
+                                               uint32_t *bitmask,
+                                               uint32_t *xor32_vertical )
+{
+	uint32_t column_values[ 4 ];
+
+	__m128i column_xor     = _mm_setzero_si128();
+	size_t buffer_iterator = 0;
+	uint32_t safe_bitmask  = *bitmask;
+	uint32_t safe_ecc      = *ecc_checksum_value;
+	int parity_bits        = 0;
+	int row_index          = 0;
+
+	while( ( size - buffer_iterator ) >= 64 )
+	{
+		libesedb_checksum_ecc32_sse2_4_rows(
+		 &( buffer[ buffer_iterator ] ),
+		 &column_xor,
+		 &parity_bits );
+
+		for( row_index = 0;
+		     row_index < 4;
+		     row_index++ )
+		{
+			safe_ecc     ^= safe_bitmask & ( 0 - (uint32_t) ( ( parity_bits >> row_index ) & 1 ) );
+			safe_bitmask -= 0x007fff80UL;
+		}
+		buffer_iterator += 64;
+	}
+	_mm_storeu_si128(
+	 (__m128i *) column_values,
+	 column_xor );
+
+	xor32_vertical[ 0 ] ^= column_values[ 0 ];
+	xor32_vertical[ 1 ] ^= column_values[ 1 ];
+	xor32_vertical[ 2 ] ^= column_values[ 2 ];
+	xor32_vertical[ 3 ] ^= column_values[ 3 ];
+
+	*ecc_checksum_value = safe_ecc;
+	*bitmask            = safe_bitmask;
+
+	return( buffer_iterator );
+}
+
+/* Calculates the ECC-32 of rows of 16 bytes using AVX2
+ * Returns the number of bytes processed
+ */
+static __attribute__((target("avx2"))) size_t libesedb_checksum_calculate_ecc32_rows_avx2(
+                                               const uint8_t *buffer,
+                                               size_t size,
+                                               uint32_t *ecc_checksum_value,
+                                               uint32_t *bitmask,
+                                               uint32_t *xor32_vertical )
+{
+	uint32_t column_values[ 4 ];
+
+	__m256i column_xor     = _mm256_setzero_si256();
+	__m256i row_order      = _mm256_setr_epi32( 0, 4, 1, 5, 2, 6, 3, 7 );
+	__m256i first_rows     = _mm256_setzero_si256();
+	__m256i second_rows    = _mm256_setzero_si256();
+	__m256i third_rows     = _mm256_setzero_si256();
+	__m256i fourth_rows    = _mm256_setzero_si256();
+	__m256i first_xor      = _mm256_setzero_si256();
+	__m256i second_xor     = _mm256_setzero_si256();
+	__m256i row_xor        = _mm256_setzero_si256();
+	__m128i column_xor_128 = _mm_setzero_si128();
+	size_t buffer_iterator = 0;
+	uint32_t safe_bitmask  = *bitmask;
+	uint32_t safe_ecc      = *ecc_checksum_value;
+	int parity_bits        = 0;
+	int row_index          = 0;
+
+	while( ( size - buffer_iterator ) >= 128 )
+	{
+		/* Every 128-bit lane contains a row, the lower lane contains
+		 * the even rows and the upper lane contains the odd rows
+		 */
+		first_rows  = _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_iterator ] ) );
+		second_rows = _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_iterator + 32 ] ) );
+		third_rows  = _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_iterator + 64 ] ) );
+		fourth_rows = _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_iterator + 96 ] ) );
+
+		column_xor = _mm256_xor_si256(
+		              column_xor,
+		              _mm256_xor_si256(
+		               _mm256_xor_si256( first_rows, second_rows ),
+		               _mm256_xor_si256( third_rows, fourth_rows ) ) );
+
+		first_xor  = _mm256_xor_si256(
+		              _mm256_unpacklo_epi32( first_rows, second_rows ),
+		              _mm256_unpackhi_epi32( first_rows, second_rows ) );
+		second_xor = _mm256_xor_si256(
+		              _mm256_unpacklo_epi32( third_rows, fourth_rows ),
+		              _mm256_unpackhi_epi32( third_rows, fourth_rows ) );
+		row_xor    = _mm256_xor_si256(
+		              _mm256_unpacklo_epi64( first_xor, second_xor ),
+		              _mm256_unpackhi_epi64( first_xor, second_xor ) );
+
+		/* Restore the row order: 0, 2, 4, 6, 1, 3, 5, 7 into 0 to 7
+		 */
+		row_xor = _mm256_permutevar8x32_epi32( row_xor, row_order );
+
+		row_xor = _mm256_xor_si256( row_xor, _mm256_srli_epi32( row_xor, 16 ) );
+		row_xor = _mm256_xor_si256( row_xor, _mm256_srli_epi32( row_xor, 8 ) );
+		row_xor = _mm256_xor_si256( row_xor, _mm256_srli_epi32( row_xor, 4 ) );
+		row_xor = _mm256_xor_si256( row_xor, _mm256_srli_epi32( row_xor, 2 ) );
+		row_xor = _mm256_xor_si256( row_xor, _mm256_srli_epi32( row_xor, 1 ) );
+
+		parity_bits = _mm256_movemask_ps(
+		               _mm256_castsi256_ps(
+		                _mm256_slli_epi32( row_xor, 31 ) ) );
+
+		for( row_index = 0;
+		     row_index < 8;
+		     row_index++ )
+		{
+			safe_ecc     ^= safe_bitmask & ( 0 - (uint32_t) ( ( parity_bits >> row_index ) & 1 ) );
+			safe_bitmask -= 0x007fff80UL;
+		}
+		buffer_iterator += 128;
+	}
+	column_xor_128 = _mm_xor_si128(
+	                  _mm256_castsi256_si128( column_xor ),
+	                  _mm256_extracti128_si256( column_xor, 1 ) );
+
+	_mm_storeu_si128(
+	 (__m128i *) column_values,
+	 column_xor_128 );
+
+	xor32_vertical[ 0 ] ^= column_values[ 0 ];
+	xor32_vertical[ 1 ] ^= column_values[ 1 ];
+	xor32_vertical[ 2 ] ^= column_values[ 2 ];
+	xor32_vertical[ 3 ] ^= column_values[ 3 ];
+
+	*ecc_checksum_value = safe_ecc;
+	*bitmask            = safe_bitmask;
+
+	return( buffer_iterator );
+}
+
+/* Calculates the XOR-32 of a buffer using SSE2
+ * Returns the number of bytes processed, which is a multitude of 16
+ */
+static __attribute__((target("sse2"))) size_t libesedb_checksum_calculate_xor32_sse2(
+                                               const uint8_t *buffer,
+                                               size_t size,
+                                               uint32_t *checksum_value )
+{
+	uint32_t values[ 4 ];
+
+	__m128i first_xor      = _mm_setzero_si128();
+	__m128i second_xor     = _mm_setzero_si128();
+	size_t buffer_iterator = 0;
+
+	while( ( size - buffer_iterator ) >= 32 )
+	{
+		first_xor  = _mm_xor_si128(
+		              first_xor,
+		              _mm_loadu_si128( (const __m128i *) &( buffer[ buffer_iterator ] ) ) );
+		second_xor = _mm_xor_si128(
+		              second_xor,
+		              _mm_loadu_si128( (const __m128i *) &( buffer[ buffer_iterator + 16 ] ) ) );
+
+		buffer_iterator += 32;
+	}
+	_mm_storeu_si128(
+	 (__m128i *) values,
+	 _mm_xor_si128( first_xor, second_xor ) );
+
+	*checksum_value ^= values[ 0 ] ^ values[ 1 ] ^ values[ 2 ] ^ values[ 3 ];
+
+	return( buffer_iterator );
+}
+
+/* Calculates the XOR-32 of a buffer using AVX2
+ * Returns the number of bytes processed, which is a multitude of 32
+ */
+static __attribute__((target("avx2"))) size_t libesedb_checksum_calculate_xor32_avx2(
+                                               const uint8_t *buffer,
+                                               size_t size,
+                                               uint32_t *checksum_value )
+{
+	uint32_t values[ 4 ];
+
+	__m256i first_xor      = _mm256_setzero_si256();
+	__m256i second_xor     = _mm256_setzero_si256();
+	__m128i value_xor      = _mm_setzero_si128();
+	size_t buffer_iterator = 0;
+
+	while( ( size - buffer_iterator ) >= 64 )
+	{
+		first_xor  = _mm256_xor_si256(
+		              first_xor,
+		              _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_iterator ] ) ) );
+		second_xor = _mm256_xor_si256(
+		              second_xor,
+		              _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_iterator + 32 ] ) ) );
+
+		buffer_iterator += 64;
+	}
+	first_xor = _mm256_xor_si256( first_xor, second_xor );
+	value_xor = _mm_xor_si128(
+	             _mm256_castsi256_si128( first_xor ),
+	             _mm256_extracti128_si256( first_xor, 1 ) );
+
+	_mm_storeu_si128(
+	 (__m128i *) values,
+	 value_xor );
+
+	*checksum_value ^= values[ 0 ] ^ values[ 1 ] ^ values[ 2 ] ^ values[ 3 ];
+
+	return( buffer_iterator );
+}
+
+#endif /* defined( HAVE_LIBESEDB_CHECKSUM_X86_SIMD ) */
+
+/* Retrieves the best instruction set supported by the CPU
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_checksum_get_supported_instruction_set(
+     int *instruction_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_checksum_get_supported_instruction_set";
+
+	if( instruction_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction set.",
+		 function );
+
+		return( -1 );
+	}
+	*instruction_set = LIBESEDB_CHECKSUM_INSTRUCTION_SET_NONE;
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_X86_SIMD )
+	__builtin_cpu_init();
+
+	if( __builtin_cpu_supports( "avx2" ) )
+	{
+		*instruction_set = LIBESEDB_CHECKSUM_INSTRUCTION_SET_AVX2;
+	}
+	else if( __builtin_cpu_supports( "sse2" ) )
+	{
+		*instruction_set = LIBESEDB_CHECKSUM_INSTRUCTION_SET_SSE2;
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the instruction set used to calculate the checksums
+ * The instruction set is determined on first use, which is not synchronized,
+ * libesedb_file_open_read determines it before pages can be verified concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_checksum_get_instruction_set(
+     int *instruction_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_checksum_get_instruction_set";
+
+	if( instruction_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_CHECKSUM_X86_SIMD )
+	if( libesedb_checksum_instruction_set == -1 )
+	{
+		if( libesedb_checksum_get_supported_instruction_set(
+		     &libesedb_checksum_instruction_set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve supported instruction set.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*instruction_set = libesedb_checksum_instruction_set;
+#else
+	*instruction_set = LIBESEDB_CHECKSUM_INSTRUCTION_SET_NONE;
+#endif
+	return( 1 );
+}
+
+/* Sets the instruction set used to calculate the checksums
+ * The instruction set must be supported by the CPU
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_checksum_set_instruction_set(
+     int instruction_set,
+     libcerror_error_t **error )
+{
+	static char *function         = "libesedb_checksum_set_instruction_set";
+	int supported_instruction_set = 0;
+
+	if( ( instruction_set != LIBESEDB_CHECKSUM_INSTRUCTION_SET_NONE )
+	 && ( instruction_set != LIBESEDB_CHECKSUM_INSTRUCTION_SET_SSE2 )
+	 && ( instruction_set != LIBESEDB_CHECKSUM_INSTRUCTION_SET_AVX2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported instruction set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_checksum_get_supported_instruction_set(
+	     &supported_instruction_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve supported instruction set.",
+		 function );
+
+		return( -1 );
+	}
+	if( instruction_set > supported_instruction_set )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: instruction set not supported by CPU.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_CHECKSUM_X86_SIMD )
+	libesedb_checksum_instruction_set = instruction_set;
+#endif
+	return( 1 );
+}
+
 /* Calculates the little-endian ECC-32 and XOR-32 of a buffer
  * It uses the initial value to calculate a new XOR-32
  * Returns 1 if successful or -1 on error
@@ -79,6 +495,13 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 	uint32_t xor32_vertical_fourth = 0;
 	uint8_t mask_table_index       = 0;
 
+#if defined( HAVE_LIBESEDB_CHECKSUM_X86_SIMD )
+	uint32_t xor32_vertical[ 4 ];
+
+	size_t rows_size               = 0;
+	int instruction_set            = 0;
+#endif
+
 	if( ecc_checksum_value == NULL )
 	{
 		libcerror_error_set(
@@ -147,15 +570,72 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBESEDB_CHECKSUM_X86_SIMD )
+	if( libesedb_checksum_get_instruction_set(
+	     &instruction_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve instruction set.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	*ecc_checksum_value = 0;
 	*xor_checksum_value = initial_value;
 	bitmask             = 0xff800000UL;
 	buffer             += offset;
+	buffer_iterator     = offset;
 
-	for( buffer_iterator = offset;
-	     buffer_iterator < size;
-	     buffer_iterator += 4 )
+	while( buffer_iterator < size )
 	{
+#if defined( HAVE_LIBESEDB_CHECKSUM_X86_SIMD )
+		/* Process whole rows of 16 bytes in bulk
+		 */
+		if( ( buffer_alignment == 0 )
+		 && ( instruction_set != LIBESEDB_CHECKSUM_INSTRUCTION_SET_NONE ) )
+		{
+			xor32_vertical[ 0 ] = xor32_vertical_first;
+			xor32_vertical[ 1 ] = xor32_vertical_second;
+			xor32_vertical[ 2 ] = xor32_vertical_third;
+			xor32_vertical[ 3 ] = xor32_vertical_fourth;
+
+			if( instruction_set == LIBESEDB_CHECKSUM_INSTRUCTION_SET_AVX2 )
+			{
+				rows_size = libesedb_checksum_calculate_ecc32_rows_avx2(
+				             buffer,
+				             size - buffer_iterator,
+				             ecc_checksum_value,
+				             &bitmask,
+				             xor32_vertical );
+			}
+			else
+			{
+				rows_size = libesedb_checksum_calculate_ecc32_rows_sse2(
+				             buffer,
+				             size - buffer_iterator,
+				             ecc_checksum_value,
+				             &bitmask,
+				             xor32_vertical );
+			}
+			xor32_vertical_first  = xor32_vertical[ 0 ];
+			xor32_vertical_second = xor32_vertical[ 1 ];
+			xor32_vertical_third  = xor32_vertical[ 2 ];
+			xor32_vertical_fourth = xor32_vertical[ 3 ];
+
+			if( rows_size > 0 )
+			{
+				buffer          += rows_size;
+				buffer_iterator += rows_size;
+
+				continue;
+			}
+		}
+#endif
 		byte_stream_copy_to_uint32_little_endian(
 		 buffer,
 		 value_32bit );
@@ -198,6 +678,7 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 			buffer_alignment = 0;
 			xor32_value      = 0;
 		}
+		buffer_iterator += 4;
 	}
 	if( xor32_value != 0 )
 	{
@@ -345,6 +826,11 @@ int libesedb_checksum_calculate_little_endian_xor32(
 	uint8_t byte_size                           = 0;
 	uint8_t realignment_size                    = 0;
 
+#if defined( HAVE_LIBESEDB_CHECKSUM_X86_SIMD )
+	size_t bulk_size                            = 0;
+	int instruction_set                         = 0;
+#endif
+
 	if( checksum_value == NULL )
 	{
 		libcerror_error_set(
@@ -378,8 +864,48 @@ int libesedb_checksum_calculate_little_endian_xor32(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBESEDB_CHECKSUM_X86_SIMD )
+	if( libesedb_checksum_get_instruction_set(
+	     &instruction_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve instruction set.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	safe_checksum_value = initial_value;
 
+#if defined( HAVE_LIBESEDB_CHECKSUM_X86_SIMD )
+	/* Process a 32-bit aligned buffer in bulk, the remainder starts at
+	 * a multitude of 32-bit values from the start of the buffer and is handled below
+	 */
+	if( ( (intptr_t) buffer % 4 ) != 0 )
+	{
+		instruction_set = LIBESEDB_CHECKSUM_INSTRUCTION_SET_NONE;
+	}
+	if( instruction_set == LIBESEDB_CHECKSUM_INSTRUCTION_SET_AVX2 )
+	{
+		bulk_size = libesedb_checksum_calculate_xor32_avx2(
+		             buffer,
+		             size,
+		             &safe_checksum_value );
+	}
+	else if( instruction_set == LIBESEDB_CHECKSUM_INSTRUCTION_SET_SSE2 )
+	{
+		bulk_size = libesedb_checksum_calculate_xor32_sse2(
+		             buffer,
+		             size,
+		             &safe_checksum_value );
+	}
+	buffer += bulk_size;
+	size   -= bulk_size;
+#endif
 	buffer_iterator = (uint8_t *) buffer;
 
 	/* Only optimize when there is the alignment is a multitude of 32-bit
@@ -31,6 +31,33 @@
 extern "C" {
 #endif
 
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#if defined( __clang__ ) || ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) )
+#define HAVE_LIBESEDB_CHECKSUM_X86_SIMD	1
+#endif
+#endif
+
+/* The checksum instruction sets
+ */
+enum LIBESEDB_CHECKSUM_INSTRUCTION_SETS
+{
+	LIBESEDB_CHECKSUM_INSTRUCTION_SET_NONE	= 0,
+	LIBESEDB_CHECKSUM_INSTRUCTION_SET_SSE2	= 1,
+	LIBESEDB_CHECKSUM_INSTRUCTION_SET_AVX2	= 2
+};
+
+int libesedb_checksum_get_supported_instruction_set(
+     int *instruction_set,
+     libcerror_error_t **error );
+
+int libesedb_checksum_get_instruction_set(
+     int *instruction_set,
+     libcerror_error_t **error );
+
+int libesedb_checksum_set_instruction_set(
+     int instruction_set,
+     libcerror_error_t **error );
+
 int libesedb_checksum_calculate_little_endian_ecc32(
      uint32_t *ecc_checksum_value,
      uint32_t *xor_checksum_value,
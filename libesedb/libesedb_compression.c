@@ -25,9 +25,247 @@
 #include <types.h>
 
 #include "libesedb_compression.h"
+#include "libesedb_definitions.h"
+#include "libesedb_huffman_tree.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
 #include "libesedb_libuna.h"
+#include "libesedb_unicode.h"
+
+#if defined( HAVE_LIBESEDB_COMPRESSION_X86_SIMD )
+#include <immintrin.h>
+#endif
+
+/* The XPRESS10 compressed data header consists of:
+ * 0 - 1	the leading byte (0x30)
+ * 1 - 5	the uncompressed data size
+ * 5 - 13	the checksum of the uncompressed data
+ * The header is followed by LZXPRESS Huffman compressed data
+ */
+#define LIBESEDB_COMPRESSION_XPRESS10_HEADER_SIZE	13
+
+#if defined( HAVE_LIBESEDB_COMPRESSION_X86_SIMD )
+
+/* The instruction set used to decompress the 7-bit compressed data
+ * -1 represents that the instruction set has not been determined yet
+ */
+static int libesedb_compression_instruction_set = -1;
+
+/* Unpacks 7-bit compressed data in blocks of 14 bytes into 16 bytes using SSSE3
+ * Every output byte is gathered into a 16-bit lane together with its successor,
+ * shifted to the upper byte by a multiplication and masked to 7 bits
+ * Returns the number of bytes processed, which is a multitude of 14
+ */
+static __attribute__((target("ssse3"))) size_t libesedb_compression_7bit_unpack_ssse3(
+                                                const uint8_t *compressed_data,
+                                                size_t compressed_data_size,
+                                                uint8_t *uncompressed_data )
+{
+	__m128i lower_shuffle_mask   = _mm_setr_epi8( 0, 1, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7 );
+	__m128i upper_shuffle_mask   = _mm_setr_epi8( 7, 8, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14 );
+	__m128i multipliers          = _mm_setr_epi16( 256, 2, 4, 8, 16, 32, 64, 128 );
+	__m128i value_mask           = _mm_set1_epi8( 0x7f );
+	__m128i lower_values         = _mm_setzero_si128();
+	__m128i upper_values         = _mm_setzero_si128();
+	__m128i data                 = _mm_setzero_si128();
+	size_t compressed_data_index = 0;
+
+	/* The 16-byte load reads 2 bytes beyond the 14 bytes that are unpacked
+	 */
+	while( ( compressed_data_size - compressed_data_index ) >= 16 )
+	{
+		data = _mm_loadu_si128(
+		        (const __m128i *) &( compressed_data[ compressed_data_index ] ) );
+
+		lower_values = _mm_srli_epi16(
+		                _mm_mullo_epi16(
+		                 _mm_shuffle_epi8( data, lower_shuffle_mask ),
+		                 multipliers ),
+		                8 );
+		upper_values = _mm_srli_epi16(
+		                _mm_mullo_epi16(
+		                 _mm_shuffle_epi8( data, upper_shuffle_mask ),
+		                 multipliers ),
+		                8 );
+
+		_mm_storeu_si128(
+		 (__m128i *) uncompressed_data,
+		 _mm_and_si128(
+		  _mm_packus_epi16( lower_values, upper_values ),
+		  value_mask ) );
+
+		compressed_data_index += 14;
+		uncompressed_data     += 16;
+	}
+	return( compressed_data_index );
+}
+
+#endif /* defined( HAVE_LIBESEDB_COMPRESSION_X86_SIMD ) */
+
+/* Unpacks 7-bit compressed data in blocks of 7 bytes into 8 bytes
+ * Returns the number of bytes processed, which is a multitude of 7
+ */
+static size_t libesedb_compression_7bit_unpack(
+               const uint8_t *compressed_data,
+               size_t compressed_data_size,
+               uint8_t *uncompressed_data )
+{
+	size_t compressed_data_index = 0;
+	uint64_t value_64bit         = 0;
+
+	/* The 8-byte read includes 1 byte beyond the 7 bytes that are unpacked
+	 * which is shifted out by the last value
+	 */
+	while( ( compressed_data_size - compressed_data_index ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( compressed_data[ compressed_data_index ] ),
+		 value_64bit );
+
+		uncompressed_data[ 0 ] = (uint8_t) ( value_64bit & 0x7f );
+		uncompressed_data[ 1 ] = (uint8_t) ( ( value_64bit >> 7 ) & 0x7f );
+		uncompressed_data[ 2 ] = (uint8_t) ( ( value_64bit >> 14 ) & 0x7f );
+		uncompressed_data[ 3 ] = (uint8_t) ( ( value_64bit >> 21 ) & 0x7f );
+		uncompressed_data[ 4 ] = (uint8_t) ( ( value_64bit >> 28 ) & 0x7f );
+		uncompressed_data[ 5 ] = (uint8_t) ( ( value_64bit >> 35 ) & 0x7f );
+		uncompressed_data[ 6 ] = (uint8_t) ( ( value_64bit >> 42 ) & 0x7f );
+		uncompressed_data[ 7 ] = (uint8_t) ( ( value_64bit >> 49 ) & 0x7f );
+
+		compressed_data_index += 7;
+		uncompressed_data     += 8;
+	}
+	return( compressed_data_index );
+}
+
+/* Retrieves the best instruction set supported by the CPU
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_compression_get_supported_instruction_set(
+     int *instruction_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_get_supported_instruction_set";
+
+	if( instruction_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction set.",
+		 function );
+
+		return( -1 );
+	}
+	*instruction_set = LIBESEDB_COMPRESSION_INSTRUCTION_SET_NONE;
+
+#if defined( HAVE_LIBESEDB_COMPRESSION_X86_SIMD )
+	__builtin_cpu_init();
+
+	if( __builtin_cpu_supports( "ssse3" ) )
+	{
+		*instruction_set = LIBESEDB_COMPRESSION_INSTRUCTION_SET_SSSE3;
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the instruction set used to decompress the 7-bit compressed data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_compression_get_instruction_set(
+     int *instruction_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_get_instruction_set";
+
+	if( instruction_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_COMPRESSION_X86_SIMD )
+	if( libesedb_compression_instruction_set == -1 )
+	{
+		if( libesedb_compression_get_supported_instruction_set(
+		     &libesedb_compression_instruction_set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve supported instruction set.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*instruction_set = libesedb_compression_instruction_set;
+#else
+	*instruction_set = LIBESEDB_COMPRESSION_INSTRUCTION_SET_NONE;
+#endif
+	return( 1 );
+}
+
+/* Sets the instruction set used to decompress the 7-bit compressed data
+ * The instruction set must be supported by the CPU
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_compression_set_instruction_set(
+     int instruction_set,
+     libcerror_error_t **error )
+{
+	static char *function         = "libesedb_compression_set_instruction_set";
+	int supported_instruction_set = 0;
+
+	if( ( instruction_set != LIBESEDB_COMPRESSION_INSTRUCTION_SET_NONE )
+	 && ( instruction_set != LIBESEDB_COMPRESSION_INSTRUCTION_SET_SSSE3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported instruction set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_compression_get_supported_instruction_set(
+	     &supported_instruction_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve supported instruction set.",
+		 function );
+
+		return( -1 );
+	}
+	if( instruction_set > supported_instruction_set )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: instruction set not supported by CPU.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_COMPRESSION_X86_SIMD )
+	libesedb_compression_instruction_set = instruction_set;
+#endif
+	return( 1 );
+}
 
 /* Retrieves the size of the decompressed 7-bit compressed-data
  * Returns 1 on success or -1 on error
@@ -38,7 +276,8 @@ int libesedb_compression_7bit_decompress_get_size(
      size_t *uncompressed_data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_compression_7bit_decompress_get_size";
+	static char *function      = "libesedb_compression_7bit_decompress_get_size";
+	uint8_t compression_scheme = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -84,7 +323,10 @@ int libesedb_compression_7bit_decompress_get_size(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
+	compression_scheme = compressed_data[ 0 ] >> 3;
+
+	if( ( compression_scheme != LIBESEDB_COMPRESSION_SCHEME_7BIT_ASCII )
+	 && ( compression_scheme != LIBESEDB_COMPRESSION_SCHEME_7BIT_UNICODE ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -113,9 +355,15 @@ int libesedb_compression_7bit_decompress(
 {
 	static char *function          = "libesedb_compression_7bit_decompress";
 	size_t compressed_data_index   = 0;
+	size_t processed_data_size     = 0;
 	size_t uncompressed_data_index = 0;
 	uint16_t value_16bit           = 0;
 	uint8_t bit_index              = 0;
+	uint8_t compression_scheme     = 0;
+
+#if defined( HAVE_LIBESEDB_COMPRESSION_X86_SIMD )
+	int instruction_set            = 0;
+#endif
 
 	if( compressed_data == NULL )
 	{
@@ -183,7 +431,10 @@ int libesedb_compression_7bit_decompress(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
+	compression_scheme = compressed_data[ 0 ] >> 3;
+
+	if( ( compression_scheme != LIBESEDB_COMPRESSION_SCHEME_7BIT_ASCII )
+	 && ( compression_scheme != LIBESEDB_COMPRESSION_SCHEME_7BIT_UNICODE ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -195,9 +446,47 @@ int libesedb_compression_7bit_decompress(
 
 		return( -1 );
 	}
-	for( compressed_data_index = 1;
-	     compressed_data_index < compressed_data_size;
-	     compressed_data_index++ )
+#if defined( HAVE_LIBESEDB_COMPRESSION_X86_SIMD )
+	if( libesedb_compression_get_instruction_set(
+	     &instruction_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve instruction set.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	compressed_data_index = 1;
+
+	/* Unpack whole blocks of 7 bytes in bulk, every block contains
+	 * exactly 8 values so no bits are carried over to the next block
+	 */
+#if defined( HAVE_LIBESEDB_COMPRESSION_X86_SIMD )
+	if( instruction_set == LIBESEDB_COMPRESSION_INSTRUCTION_SET_SSSE3 )
+	{
+		processed_data_size = libesedb_compression_7bit_unpack_ssse3(
+		                       &( compressed_data[ compressed_data_index ] ),
+		                       compressed_data_size - compressed_data_index,
+		                       &( uncompressed_data[ uncompressed_data_index ] ) );
+
+		compressed_data_index   += processed_data_size;
+		uncompressed_data_index += ( processed_data_size / 7 ) * 8;
+	}
+#endif
+	processed_data_size = libesedb_compression_7bit_unpack(
+	                       &( compressed_data[ compressed_data_index ] ),
+	                       compressed_data_size - compressed_data_index,
+	                       &( uncompressed_data[ uncompressed_data_index ] ) );
+
+	compressed_data_index   += processed_data_size;
+	uncompressed_data_index += ( processed_data_size / 7 ) * 8;
+
+	while( compressed_data_index < compressed_data_size )
 	{
 		value_16bit |= (uint16_t) compressed_data[ compressed_data_index ] << bit_index;
 
@@ -215,6 +504,7 @@ int libesedb_compression_7bit_decompress(
 
 			bit_index = 0;
 		}
+		compressed_data_index++;
 	}
 	if( value_16bit != 0 )
 	{
@@ -306,6 +596,8 @@ int libesedb_compression_xpress_decompress_get_size(
 }
 
 /* Decompresses XPRESS compressed-data
+ * Runs of 8 uncompressed bytes and non-overlapping or 8-byte overlapping matches are copied
+ * in blocks, other overlapping matches are copied per byte
  * Returns 1 on success or -1 on error
  */
 int libesedb_compression_xpress_decompress(
@@ -315,16 +607,16 @@ int libesedb_compression_xpress_decompress(
      size_t uncompressed_data_size,
      libcerror_error_t **error )
 {
-	static char *function                  = "libesedb_compression_xpress_decompress";
-	size_t compressed_data_iterator        = 0;
-	size_t compression_iterator            = 0;
-	size_t compression_shared_byte_index   = 0;
-	size_t uncompressed_data_iterator      = 0;
-	uint32_t compression_indicator         = 0;
-	uint32_t compression_indicator_bitmask = 0;
-	int16_t compression_offset             = 0;
-	uint16_t compression_size              = 0;
-	uint16_t compression_tuple             = 0;
+	static char *function                = "libesedb_compression_xpress_decompress";
+	size_t compressed_data_iterator      = 0;
+	size_t compression_iterator          = 0;
+	size_t compression_offset            = 0;
+	size_t compression_shared_byte_index = 0;
+	size_t compression_size              = 0;
+	size_t uncompressed_data_iterator    = 0;
+	uint32_t compression_indicator       = 0;
+	uint16_t compression_tuple           = 0;
+	uint8_t number_of_indicator_bits     = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -397,26 +689,70 @@ int libesedb_compression_xpress_decompress(
 
 	while( compressed_data_iterator < compressed_data_size )
 	{
-                byte_stream_copy_to_uint32_little_endian(
-                 &( compressed_data[ compressed_data_iterator ] ),
-                 compression_indicator );
+		/* An incomplete compression indicator cannot be followed by data
+		 */
+		if( ( compressed_data_size - compressed_data_iterator ) < 4 )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ compressed_data_iterator ] ),
+		 compression_indicator );
 
 		compressed_data_iterator += 4;
+		number_of_indicator_bits  = 32;
 
-		for( compression_indicator_bitmask = 0x80000000UL;
-		     compression_indicator_bitmask > 0;
-		     compression_indicator_bitmask >>= 1 )
+		/* The indicator bits are consumed from the most significant bit,
+		 * if the indicator bit is 0 the data is uncompressed or 1 if the data is compressed
+		 */
+		while( ( number_of_indicator_bits > 0 )
+		    && ( compressed_data_iterator < compressed_data_size ) )
 		{
-			if( compressed_data_iterator >= compressed_data_size )
+			if( ( number_of_indicator_bits >= 8 )
+			 && ( ( compression_indicator & 0xff000000UL ) == 0 )
+			 && ( ( compressed_data_size - compressed_data_iterator ) >= 8 ) )
+			{
+				if( ( uncompressed_data_size - uncompressed_data_iterator ) < 8 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: uncompressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				memory_copy(
+				 &( uncompressed_data[ uncompressed_data_iterator ] ),
+				 &( compressed_data[ compressed_data_iterator ] ),
+				 8 );
+
+				compressed_data_iterator   += 8;
+				uncompressed_data_iterator += 8;
+				compression_indicator     <<= 8;
+				number_of_indicator_bits   -= 8;
+
+				continue;
+			}
+			if( ( compression_indicator & 0x80000000UL ) == 0 )
 			{
-				break;
+				if( uncompressed_data_iterator >= uncompressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: uncompressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				uncompressed_data[ uncompressed_data_iterator++ ] = compressed_data[ compressed_data_iterator++ ];
 			}
-			/* If the indicator bit is 0 the data is uncompressed
-			 * or 1 if the data is compressed
-			 */
-			if( ( compression_indicator & compression_indicator_bitmask ) != 0 )
+			else
 			{
-				if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
+				if( ( compressed_data_size - compressed_data_iterator ) < 2 )
 				{
 					libcerror_error_set(
 					 error,
@@ -427,9 +763,9 @@ int libesedb_compression_xpress_decompress(
 
 					return( -1 );
 				}
-		                byte_stream_copy_to_uint16_little_endian(
-		                 &( compressed_data[ compressed_data_iterator ] ),
-		                 compression_tuple );
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ compressed_data_iterator ] ),
+				 compression_tuple );
 
 				compressed_data_iterator += 2;
 
@@ -437,8 +773,8 @@ int libesedb_compression_xpress_decompress(
 				 * 0 - 2	the size
 				 * 3 - 15	the offset - 1
 				 */
-				compression_size   = ( compression_tuple & 0x0007 );
-				compression_offset = ( compression_tuple >> 3 ) + 1;
+				compression_size   = (size_t) ( compression_tuple & 0x0007 );
+				compression_offset = (size_t) ( compression_tuple >> 3 ) + 1;
 
 				/* Check for a first level extended size
 				 * stored in the 4-bits of a shared extended compression size byte
@@ -469,48 +805,49 @@ int libesedb_compression_xpress_decompress(
 
 						compression_shared_byte_index = 0;
 					}
-				}
-				/* Check for a second level extended size
-				 * stored in the 8-bits of the next byte
-				 * the size is added to the previous size
-				 */
-				if( compression_size == ( 0x07 + 0x0f ) )
-				{
-					if( compressed_data_iterator >= compressed_data_size )
+					/* Check for a second level extended size
+					 * stored in the 8-bits of the next byte
+					 * the size is added to the previous size
+					 */
+					if( compression_size == ( 0x07 + 0x0f ) )
 					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-						 "%s: compressed data too small.",
-						 function );
+						if( compressed_data_iterator >= compressed_data_size )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+							 "%s: compressed data too small.",
+							 function );
 
-						return( -1 );
-					}
-					compression_size += compressed_data[ compressed_data_iterator++ ];
-				}
-				/* Check for a third level extended size
-				 * stored in the 16-bits of the next two bytes
-				 * the previous size is ignored
-				 */
-				if( compression_size == ( 0x07 + 0x0f + 0xff ) )
-				{
-					if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-						 "%s: compressed data too small.",
-						 function );
+							return( -1 );
+						}
+						compression_size += compressed_data[ compressed_data_iterator++ ];
 
-						return( -1 );
+						/* Check for a third level extended size
+						 * stored in the 16-bits of the next two bytes
+						 * the previous size is ignored
+						 */
+						if( compression_size == ( 0x07 + 0x0f + 0xff ) )
+						{
+							if( ( compressed_data_size - compressed_data_iterator ) < 2 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+								 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+								 "%s: compressed data too small.",
+								 function );
+
+								return( -1 );
+							}
+							byte_stream_copy_to_uint16_little_endian(
+							 &( compressed_data[ compressed_data_iterator ] ),
+							 compression_size );
+
+							compressed_data_iterator += 2;
+						}
 					}
-			                byte_stream_copy_to_uint16_little_endian(
-			                 &( compressed_data[ compressed_data_iterator ] ),
-			                 compression_size );
-		
-					compressed_data_iterator += 2;
 				}
 				/* The size value is stored as
 				 * size - 3
@@ -528,53 +865,22 @@ int libesedb_compression_xpress_decompress(
 
 					return( -1 );
 				}
-				compression_iterator = uncompressed_data_iterator - compression_offset;
-
-				while( compression_size > 0 )
-				{
-					if( compression_iterator > uncompressed_data_iterator )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-						 "compression iterator: %" PRIzd " out of range: %" PRIzd ".",
-						 function,
-						 compression_iterator,
-						 uncompressed_data_iterator );
-
-						return( -1 );
-					}
-					if( uncompressed_data_iterator > uncompressed_data_size )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-						 "%s: uncompressed data too small.",
-						 function );
-
-						return( -1 );
-					}
-					uncompressed_data[ uncompressed_data_iterator++ ] = uncompressed_data[ compression_iterator++ ];
-
-					compression_size--;
-				}
-			}
-			else
-			{
-				if( compressed_data_iterator >= compressed_data_size )
+				/* The bounds are checked once per match instead of per byte
+				 */
+				if( compression_offset > uncompressed_data_iterator )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: compressed data too small.",
-					 function );
+					 "%s: compression offset: %" PRIzd " out of range: %" PRIzd ".",
+					 function,
+					 compression_offset,
+					 uncompressed_data_iterator );
 
 					return( -1 );
 				}
-				if( uncompressed_data_iterator > uncompressed_data_size )
+				if( compression_size > ( uncompressed_data_size - uncompressed_data_iterator ) )
 				{
 					libcerror_error_set(
 					 error,
@@ -585,24 +891,94 @@ int libesedb_compression_xpress_decompress(
 
 					return( -1 );
 				}
-				uncompressed_data[ uncompressed_data_iterator++ ] = compressed_data[ compressed_data_iterator++ ];
+				compression_iterator = uncompressed_data_iterator - compression_offset;
+
+				if( compression_offset == 1 )
+				{
+					/* A match with an offset of 1 repeats the previous byte
+					 */
+					memory_set(
+					 &( uncompressed_data[ uncompressed_data_iterator ] ),
+					 uncompressed_data[ compression_iterator ],
+					 compression_size );
+
+					uncompressed_data_iterator += compression_size;
+				}
+				else if( compression_offset >= compression_size )
+				{
+					memory_copy(
+					 &( uncompressed_data[ uncompressed_data_iterator ] ),
+					 &( uncompressed_data[ compression_iterator ] ),
+					 compression_size );
+
+					uncompressed_data_iterator += compression_size;
+				}
+				else
+				{
+					/* The source and destination of an overlapping match are at least
+					 * 8 bytes apart when the offset is 8 or more
+					 */
+					if( compression_offset >= 8 )
+					{
+						while( compression_size >= 8 )
+						{
+							memory_copy(
+							 &( uncompressed_data[ uncompressed_data_iterator ] ),
+							 &( uncompressed_data[ compression_iterator ] ),
+							 8 );
+
+							compression_iterator       += 8;
+							uncompressed_data_iterator += 8;
+							compression_size           -= 8;
+						}
+					}
+					while( compression_size > 0 )
+					{
+						uncompressed_data[ uncompressed_data_iterator++ ] = uncompressed_data[ compression_iterator++ ];
+
+						compression_size--;
+					}
+				}
 			}
+			compression_indicator   <<= 1;
+			number_of_indicator_bits -= 1;
 		}
 	}
 	return( 1 );
 }
 
-/* Retrieves the size of the decompressed compressed-data
+/* Decompresses LZXPRESS Huffman compressed-data
+ * The compressed data consists of blocks of 65536 uncompressed bytes that start with
+ * the 4-bit code sizes of 512 symbols, the symbols are decoded with a lookup table
+ * Compressed data that ends before all the bits needed to decode it are read is an error
  * Returns 1 on success or -1 on error
  */
-int libesedb_compression_decompress_get_size(
+int libesedb_compression_xpress_huffman_decompress(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
-     size_t *uncompressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_compression_decompress_get_size";
-	int result            = 0;
+	uint8_t code_sizes_array[ 512 ];
+
+	libesedb_huffman_tree_t *huffman_tree = NULL;
+	static char *function                 = "libesedb_compression_xpress_huffman_decompress";
+	size_t block_end_offset               = 0;
+	size_t compressed_data_offset         = 0;
+	size_t compression_iterator           = 0;
+	size_t compression_offset             = 0;
+	size_t compression_size               = 0;
+	size_t uncompressed_data_offset       = 0;
+	uint32_t next_bits                    = 0;
+	uint16_t lookup_table_entry           = 0;
+	uint16_t symbol                       = 0;
+	uint16_t value_16bit                  = 0;
+	uint8_t code_size                     = 0;
+	uint8_t compression_offset_size       = 0;
+	int code_sizes_array_index            = 0;
+	int extra_bit_count                   = 0;
+	int number_of_available_bits          = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -626,58 +1002,754 @@ int libesedb_compression_decompress_get_size(
 
 		return( -1 );
 	}
-	if( compressed_data_size < 1 )
+	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: compressed data size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
 	{
-		result = libesedb_compression_xpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( uncompressed_data_size == 0 )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data_size,
-		          error );
+		return( 1 );
 	}
-	if( result != 1 )
+	if( libesedb_huffman_tree_initialize(
+	     &huffman_tree,
+	     512,
+	     15,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable retrieve uncompressed data size.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create Huffman tree.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		if( ( compressed_data_size - compressed_data_offset ) < 256 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data too small.",
+			 function );
+
+			goto on_error;
+		}
+		/* Every byte contains the code size of an even symbol in the lower 4 bits
+		 * and of an odd symbol in the upper 4 bits
+		 */
+		for( code_sizes_array_index = 0;
+		     code_sizes_array_index < 512;
+		     code_sizes_array_index += 2 )
+		{
+			code_sizes_array[ code_sizes_array_index ]     = compressed_data[ compressed_data_offset ] & 0x0f;
+			code_sizes_array[ code_sizes_array_index + 1 ] = compressed_data[ compressed_data_offset ] >> 4;
+
+			compressed_data_offset++;
+		}
+		if( libesedb_huffman_tree_build(
+		     huffman_tree,
+		     code_sizes_array,
+		     512,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build Huffman tree.",
+			 function );
+
+			goto on_error;
+		}
+		/* The bits are read in 16-bit little-endian values, of which the most significant
+		 * bit is consumed first, 16 bits are read ahead of the bits being decoded
+		 * The bits read ahead past the end of the compressed data are 0, these are
+		 * only used for the lookup and cannot be consumed
+		 */
+		next_bits                = 0;
+		number_of_available_bits = 0;
+
+		for( extra_bit_count = 0;
+		     extra_bit_count < 32;
+		     extra_bit_count += 16 )
+		{
+			value_16bit = 0;
+
+			if( ( compressed_data_size - compressed_data_offset ) >= 2 )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ compressed_data_offset ] ),
+				 value_16bit );
+
+				compressed_data_offset   += 2;
+				number_of_available_bits += 16;
+			}
+			next_bits = ( next_bits << 16 ) | value_16bit;
+		}
+		extra_bit_count = 16;
+
+		block_end_offset = uncompressed_data_size - uncompressed_data_offset;
+
+		if( block_end_offset > 65536 )
+		{
+			block_end_offset = 65536;
+		}
+		block_end_offset += uncompressed_data_offset;
+
+		while( uncompressed_data_offset < block_end_offset )
+		{
+			lookup_table_entry = huffman_tree->lookup_table[ next_bits >> ( 32 - huffman_tree->number_of_lookup_bits ) ];
+
+			code_size = (uint8_t) ( lookup_table_entry & 0x000f );
+			symbol    = lookup_table_entry >> 4;
+
+			if( code_size == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid Huffman code: 0x%08" PRIx32 ".",
+				 function,
+				 next_bits );
+
+				goto on_error;
+			}
+			if( (int) code_size > number_of_available_bits )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data too small.",
+				 function );
+
+				goto on_error;
+			}
+			next_bits               <<= code_size;
+			extra_bit_count          -= code_size;
+			number_of_available_bits -= code_size;
+
+			if( extra_bit_count < 0 )
+			{
+				value_16bit = 0;
+
+				if( ( compressed_data_size - compressed_data_offset ) >= 2 )
+				{
+					byte_stream_copy_to_uint16_little_endian(
+					 &( compressed_data[ compressed_data_offset ] ),
+					 value_16bit );
+
+					compressed_data_offset   += 2;
+					number_of_available_bits += 16;
+				}
+				next_bits       |= (uint32_t) value_16bit << -extra_bit_count;
+				extra_bit_count += 16;
+			}
+			if( symbol < 256 )
+			{
+				uncompressed_data[ uncompressed_data_offset++ ] = (uint8_t) symbol;
+
+				continue;
+			}
+			/* The match symbol contains:
+			 * 0 - 3	the size - 3
+			 * 4 - 7	the number of bits of the offset
+			 */
+			compression_size        = (size_t) ( symbol & 0x000f );
+			compression_offset_size = (uint8_t) ( ( symbol >> 4 ) & 0x000f );
+
+			/* Extended sizes are stored in the bytes that follow the 16-bit values
+			 * that have been read so far
+			 */
+			if( compression_size == 0x0f )
+			{
+				if( compressed_data_offset >= compressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: compressed data too small.",
+					 function );
+
+					goto on_error;
+				}
+				compression_size = compressed_data[ compressed_data_offset++ ];
+
+				if( compression_size == 0xff )
+				{
+					if( ( compressed_data_size - compressed_data_offset ) < 2 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: compressed data too small.",
+						 function );
+
+						goto on_error;
+					}
+					byte_stream_copy_to_uint16_little_endian(
+					 &( compressed_data[ compressed_data_offset ] ),
+					 compression_size );
+
+					compressed_data_offset += 2;
+
+					if( compression_size == 0 )
+					{
+						if( ( compressed_data_size - compressed_data_offset ) < 4 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+							 "%s: compressed data too small.",
+							 function );
+
+							goto on_error;
+						}
+						byte_stream_copy_to_uint32_little_endian(
+						 &( compressed_data[ compressed_data_offset ] ),
+						 compression_size );
+
+						compressed_data_offset += 4;
+					}
+					if( compression_size < 0x0f )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: compression size value out of bounds.",
+						 function );
+
+						goto on_error;
+					}
+					compression_size -= 0x0f;
+				}
+				compression_size += 0x0f;
+			}
+			compression_size += 3;
+
+			/* The offset is stored as the bits below its most significant bit
+			 */
+			compression_offset = (size_t) 1 << compression_offset_size;
+
+			if( compression_offset_size > 0 )
+			{
+				if( (int) compression_offset_size > number_of_available_bits )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: compressed data too small.",
+					 function );
+
+					goto on_error;
+				}
+				compression_offset |= (size_t) ( next_bits >> ( 32 - compression_offset_size ) );
+
+				next_bits               <<= compression_offset_size;
+				extra_bit_count          -= compression_offset_size;
+				number_of_available_bits -= compression_offset_size;
+
+				if( extra_bit_count < 0 )
+				{
+					value_16bit = 0;
+
+					if( ( compressed_data_size - compressed_data_offset ) >= 2 )
+					{
+						byte_stream_copy_to_uint16_little_endian(
+						 &( compressed_data[ compressed_data_offset ] ),
+						 value_16bit );
+
+						compressed_data_offset   += 2;
+						number_of_available_bits += 16;
+					}
+					next_bits       |= (uint32_t) value_16bit << -extra_bit_count;
+					extra_bit_count += 16;
+				}
+			}
+			if( compression_offset > uncompressed_data_offset )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compression offset: %" PRIzd " out of range: %" PRIzd ".",
+				 function,
+				 compression_offset,
+				 uncompressed_data_offset );
+
+				goto on_error;
+			}
+			if( compression_size > ( uncompressed_data_size - uncompressed_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: uncompressed data too small.",
+				 function );
+
+				goto on_error;
+			}
+			compression_iterator = uncompressed_data_offset - compression_offset;
+
+			if( compression_offset == 1 )
+			{
+				memory_set(
+				 &( uncompressed_data[ uncompressed_data_offset ] ),
+				 uncompressed_data[ compression_iterator ],
+				 compression_size );
+
+				uncompressed_data_offset += compression_size;
+			}
+			else if( compression_offset >= compression_size )
+			{
+				memory_copy(
+				 &( uncompressed_data[ uncompressed_data_offset ] ),
+				 &( uncompressed_data[ compression_iterator ] ),
+				 compression_size );
+
+				uncompressed_data_offset += compression_size;
+			}
+			else
+			{
+				if( compression_offset >= 8 )
+				{
+					while( compression_size >= 8 )
+					{
+						memory_copy(
+						 &( uncompressed_data[ uncompressed_data_offset ] ),
+						 &( uncompressed_data[ compression_iterator ] ),
+						 8 );
+
+						compression_iterator     += 8;
+						uncompressed_data_offset += 8;
+						compression_size         -= 8;
+					}
+				}
+				while( compression_size > 0 )
+				{
+					uncompressed_data[ uncompressed_data_offset++ ] = uncompressed_data[ compression_iterator++ ];
+
+					compression_size--;
+				}
+			}
+		}
+	}
+	if( libesedb_huffman_tree_free(
+	     &huffman_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( huffman_tree != NULL )
+	{
+		libesedb_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of the decompressed XPRESS10 compressed-data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_xpress10_decompress_get_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_xpress10_decompress_get_size";
+	uint32_t value_32bit  = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < LIBESEDB_COMPRESSION_XPRESS10_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data[ 0 ] >> 3 ) != LIBESEDB_COMPRESSION_SCHEME_XPRESS10 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported leading byte: 0x%02" PRIx8 ".",
+		 function,
+		 compressed_data[ 0 ] );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 1 ] ),
+	 value_32bit );
+
+	if( (size_t) value_32bit > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data_size = (size_t) value_32bit;
+
+	return( 1 );
+}
+
+/* Decompresses XPRESS10 compressed-data
+ * The checksum in the header is not verified
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_xpress10_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                = "libesedb_compression_xpress10_decompress";
+	size_t stored_uncompressed_data_size = 0;
+
+	if( libesedb_compression_xpress10_decompress_get_size(
+	     compressed_data,
+	     compressed_data_size,
+	     &stored_uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size < stored_uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: uncompressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_compression_xpress_huffman_decompress(
+	     &( compressed_data[ LIBESEDB_COMPRESSION_XPRESS10_HEADER_SIZE ] ),
+	     compressed_data_size - LIBESEDB_COMPRESSION_XPRESS10_HEADER_SIZE,
+	     uncompressed_data,
+	     stored_uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress LZXPRESS Huffman compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the decompressed compressed-data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_decompress_get_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_decompress_get_size";
+	int result            = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The compression scheme is stored in the upper 5 bits of the leading byte
+	 */
+	switch( compressed_data[ 0 ] >> 3 )
+	{
+		case LIBESEDB_COMPRESSION_SCHEME_7BIT_ASCII:
+		case LIBESEDB_COMPRESSION_SCHEME_7BIT_UNICODE:
+			result = libesedb_compression_7bit_decompress_get_size(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case LIBESEDB_COMPRESSION_SCHEME_XPRESS:
+			result = libesedb_compression_xpress_decompress_get_size(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case LIBESEDB_COMPRESSION_SCHEME_XPRESS10:
+			result = libesedb_compression_xpress10_decompress_get_size(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compression scheme: %d.",
+			 function,
+			 compressed_data[ 0 ] >> 3 );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses compressed-data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_decompress";
+	int result            = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The compression scheme is stored in the upper 5 bits of the leading byte
+	 */
+	switch( compressed_data[ 0 ] >> 3 )
+	{
+		case LIBESEDB_COMPRESSION_SCHEME_7BIT_ASCII:
+		case LIBESEDB_COMPRESSION_SCHEME_7BIT_UNICODE:
+			result = libesedb_compression_7bit_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case LIBESEDB_COMPRESSION_SCHEME_XPRESS:
+			result = libesedb_compression_xpress_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case LIBESEDB_COMPRESSION_SCHEME_XPRESS10:
+			result = libesedb_compression_xpress10_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compression scheme: %d.",
+			 function,
+			 compressed_data[ 0 ] >> 3 );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable decompressed data.",
+		 function );
+
+		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Decompresses compressed-data
+/* Retrieves the UTF-8 string size of uncompressed data
+ * The compressed data is used to determine the encoding of the uncompressed data
  * Returns 1 on success or -1 on error
  */
-int libesedb_compression_decompress(
+int libesedb_compression_get_utf8_string_size_from_uncompressed_data(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
-     uint8_t *uncompressed_data,
+     const uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_compression_decompress";
+	static char *function = "libesedb_compression_get_utf8_string_size_from_uncompressed_data";
 	int result            = 0;
 
 	if( compressed_data == NULL )
@@ -691,17 +1763,6 @@ int libesedb_compression_decompress(
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
 	if( compressed_data_size < 1 )
 	{
 		libcerror_error_set(
@@ -713,34 +1774,76 @@ int libesedb_compression_decompress(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
+	if( ( ( uncompressed_data_size % 2 ) == 0 )
+	 && ( ( compressed_data[ 0 ] >> 3 ) != LIBESEDB_COMPRESSION_SCHEME_7BIT_UNICODE ) )
 	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
+		result = libesedb_unicode_utf8_string_size_from_utf16_stream(
 		          uncompressed_data,
 		          uncompressed_data_size,
+		          utf8_string_size,
 		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 string size of UTF-16 stream.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			result = libuna_utf8_string_size_from_utf16_stream(
+				  uncompressed_data,
+				  uncompressed_data_size,
+				  LIBUNA_ENDIAN_LITTLE,
+				  utf8_string_size,
+				  error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine UTF-8 string size of UTF-16 stream.",
+				 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+		}
 	}
 	if( result != 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-		 "%s: unable decompressed data.",
-		 function );
+		result = libuna_utf8_string_size_from_utf8_stream(
+			  uncompressed_data,
+			  uncompressed_data_size,
+			  utf8_string_size,
+			  error );
 
-		return( -1 );
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 string size of UTF-8 stream.",
+			 function );
+
+			return( -1 );
+		}
 	}
 	return( 1 );
 }
@@ -792,22 +1895,12 @@ int libesedb_compression_get_utf8_string_size(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
+	result = libesedb_compression_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -833,24 +1926,13 @@ int libesedb_compression_get_utf8_string_size(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
+	result = libesedb_compression_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -862,46 +1944,137 @@ int libesedb_compression_get_utf8_string_size(
 
 		goto on_error;
 	}
-	result = 0;
+	if( libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size of uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Copies uncompressed data to an UTF-8 string
+ * The compressed data is used to determine the encoding of the uncompressed data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_copy_uncompressed_data_to_utf8_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_copy_uncompressed_data_to_utf8_string";
+	int result            = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
 
+		return( -1 );
+	}
 	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	 && ( ( compressed_data[ 0 ] >> 3 ) != LIBESEDB_COMPRESSION_SCHEME_7BIT_UNICODE ) )
 	{
-		result = libuna_utf8_string_size_from_utf16_stream(
-			  uncompressed_data,
-			  uncompressed_data_size,
-			  LIBUNA_ENDIAN_LITTLE,
-			  utf8_string_size,
-			  error );
+		result = libesedb_unicode_utf8_string_copy_from_utf16_stream(
+		          utf8_string,
+		          utf8_string_size,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          error );
 
-		if( result != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine UTF-8 string size of UTF-16 stream.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
 			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			result = libuna_utf8_string_copy_from_utf16_stream(
+				  utf8_string,
+				  utf8_string_size,
+				  uncompressed_data,
+				  uncompressed_data_size,
+				  LIBUNA_ENDIAN_LITTLE,
+				  error );
+
+			if( result != 1 )
 			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+				 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
 #endif
-			libcerror_error_free(
-			 error );
+				libcerror_error_free(
+				 error );
+			}
 		}
 	}
 	if( result != 1 )
 	{
-		result = libuna_utf8_string_size_from_utf8_stream(
+		result = libuna_utf8_string_copy_from_utf8_stream(
+			  utf8_string,
+			  utf8_string_size,
 			  uncompressed_data,
 			  uncompressed_data_size,
-			  utf8_string_size,
 			  error );
 
 		if( result != 1 )
@@ -909,27 +2082,14 @@ int libesedb_compression_get_utf8_string_size(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine UTF-8 string size of UTF-8 stream.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 stream to UTF-8 string.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	memory_free(
-	 uncompressed_data );
-
-	uncompressed_data = NULL;
-
 	return( 1 );
-
-on_error:
-	if( uncompressed_data != NULL )
-	{
-		memory_free(
-		 uncompressed_data );
-	}
-	return( -1 );
 }
 
 /* Copies compressed-data to an UTF-8 string
@@ -980,88 +2140,134 @@ int libesedb_compression_copy_to_utf8_string(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
+	result = libesedb_compression_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
+	if( result != 1 )
 	{
-		result = libesedb_compression_xpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve uncompressed data size.",
+		 function );
+
+		goto on_error;
 	}
-	else
+	uncompressed_data = (uint8_t *) memory_allocate(
+					 sizeof( uint8_t ) * uncompressed_data_size );
+
+	if( uncompressed_data == NULL )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
 	}
+	result = libesedb_compression_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable decompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_compression_copy_uncompressed_data_to_utf8_string(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable retrieve uncompressed data size.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy uncompressed data to UTF-8 string.",
 		 function );
 
 		goto on_error;
 	}
-	uncompressed_data = (uint8_t *) memory_allocate(
-					 sizeof( uint8_t ) * uncompressed_data_size );
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
 
-	if( uncompressed_data == NULL )
+/* Retrieves the UTF-16 string size of uncompressed data
+ * The compressed data is used to determine the encoding of the uncompressed data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_get_utf16_string_size_from_uncompressed_data";
+	int result            = 0;
+
+	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create uncompressed data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
 		 function );
 
-		goto on_error;
-	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
+		return( -1 );
 	}
-	if( result != 1 )
+	if( compressed_data_size < 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-		 "%s: unable decompressed data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = 0;
-
 	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	 && ( ( compressed_data[ 0 ] >> 3 ) != LIBESEDB_COMPRESSION_SCHEME_7BIT_UNICODE ) )
 	{
-		result = libuna_utf8_string_copy_from_utf16_stream(
-			  utf8_string,
-			  utf8_string_size,
+		result = libuna_utf16_string_size_from_utf16_stream(
 			  uncompressed_data,
 			  uncompressed_data_size,
 			  LIBUNA_ENDIAN_LITTLE,
+			  utf16_string_size,
 			  error );
 
 		if( result != 1 )
@@ -1069,8 +2275,8 @@ int libesedb_compression_copy_to_utf8_string(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-16 string size of UTF-16 stream.",
 			 function );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1087,11 +2293,10 @@ int libesedb_compression_copy_to_utf8_string(
 	}
 	if( result != 1 )
 	{
-		result = libuna_utf8_string_copy_from_utf8_stream(
-			  utf8_string,
-			  utf8_string_size,
+		result = libuna_utf16_string_size_from_utf8_stream(
 			  uncompressed_data,
 			  uncompressed_data_size,
+			  utf16_string_size,
 			  error );
 
 		if( result != 1 )
@@ -1099,27 +2304,14 @@ int libesedb_compression_copy_to_utf8_string(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-8 stream to UTF-8 string.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-16 string size of UTF-8 stream.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	memory_free(
-	 uncompressed_data );
-
-	uncompressed_data = NULL;
-
 	return( 1 );
-
-on_error:
-	if( uncompressed_data != NULL )
-	{
-		memory_free(
-		 uncompressed_data );
-	}
-	return( -1 );
 }
 
 /* Retrieves the UTF-16 string size of compressed-data
@@ -1169,22 +2361,12 @@ int libesedb_compression_get_utf16_string_size(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
+	result = libesedb_compression_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -1210,24 +2392,13 @@ int libesedb_compression_get_utf16_string_size(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
+	result = libesedb_compression_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -1239,17 +2410,86 @@ int libesedb_compression_get_utf16_string_size(
 
 		goto on_error;
 	}
-	result = 0;
+	if( libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-16 string size of uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Copies uncompressed data to an UTF-16 string
+ * The compressed data is used to determine the encoding of the uncompressed data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_copy_uncompressed_data_to_utf16_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_copy_uncompressed_data_to_utf16_string";
+	int result            = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
 
+		return( -1 );
+	}
 	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	 && ( ( compressed_data[ 0 ] >> 3 ) != LIBESEDB_COMPRESSION_SCHEME_7BIT_UNICODE ) )
 	{
-		result = libuna_utf16_string_size_from_utf16_stream(
+		result = libuna_utf16_string_copy_from_utf16_stream(
+			  utf16_string,
+			  utf16_string_size,
 			  uncompressed_data,
 			  uncompressed_data_size,
 			  LIBUNA_ENDIAN_LITTLE,
-			  utf16_string_size,
 			  error );
 
 		if( result != 1 )
@@ -1257,8 +2497,8 @@ int libesedb_compression_get_utf16_string_size(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine UTF-16 string size of UTF-16 stream.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 stream to UTF-16 string.",
 			 function );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1275,10 +2515,11 @@ int libesedb_compression_get_utf16_string_size(
 	}
 	if( result != 1 )
 	{
-		result = libuna_utf16_string_size_from_utf8_stream(
+		result = libuna_utf16_string_copy_from_utf8_stream(
+			  utf16_string,
+			  utf16_string_size,
 			  uncompressed_data,
 			  uncompressed_data_size,
-			  utf16_string_size,
 			  error );
 
 		if( result != 1 )
@@ -1286,27 +2527,14 @@ int libesedb_compression_get_utf16_string_size(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine UTF-16 string size of UTF-8 stream.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	memory_free(
-	 uncompressed_data );
-
-	uncompressed_data = NULL;
-
 	return( 1 );
-
-on_error:
-	if( uncompressed_data != NULL )
-	{
-		memory_free(
-		 uncompressed_data );
-	}
-	return( -1 );
 }
 
 /* Copies compressed-data to an UTF-16 string
@@ -1357,22 +2585,12 @@ int libesedb_compression_copy_to_utf16_string(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
+	result = libesedb_compression_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -1398,24 +2616,13 @@ int libesedb_compression_copy_to_utf16_string(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_xpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
+	result = libesedb_compression_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -1427,61 +2634,23 @@ int libesedb_compression_copy_to_utf16_string(
 
 		goto on_error;
 	}
-	result = 0;
-
-	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
-	{
-		result = libuna_utf16_string_copy_from_utf16_stream(
-			  utf16_string,
-			  utf16_string_size,
-			  uncompressed_data,
-			  uncompressed_data_size,
-			  LIBUNA_ENDIAN_LITTLE,
-			  error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-16 stream to UTF-16 string.",
-			 function );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			libcerror_error_free(
-			 error );
-		}
-	}
-	if( result != 1 )
+	if( libesedb_compression_copy_uncompressed_data_to_utf16_string(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
 	{
-		result = libuna_utf16_string_copy_from_utf8_stream(
-			  utf16_string,
-			  utf16_string_size,
-			  uncompressed_data,
-			  uncompressed_data_size,
-			  error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy uncompressed data to UTF-16 string.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
 	memory_free(
 	 uncompressed_data );
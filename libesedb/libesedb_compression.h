@@ -31,6 +31,32 @@
 extern "C" {
 #endif
 
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#if defined( __clang__ ) || ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) )
+#define HAVE_LIBESEDB_COMPRESSION_X86_SIMD	1
+#endif
+#endif
+
+/* The compression instruction sets
+ */
+enum LIBESEDB_COMPRESSION_INSTRUCTION_SETS
+{
+	LIBESEDB_COMPRESSION_INSTRUCTION_SET_NONE	= 0,
+	LIBESEDB_COMPRESSION_INSTRUCTION_SET_SSSE3	= 1
+};
+
+int libesedb_compression_get_supported_instruction_set(
+     int *instruction_set,
+     libcerror_error_t **error );
+
+int libesedb_compression_get_instruction_set(
+     int *instruction_set,
+     libcerror_error_t **error );
+
+int libesedb_compression_set_instruction_set(
+     int instruction_set,
+     libcerror_error_t **error );
+
 int libesedb_compression_7bit_decompress_get_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -57,6 +83,26 @@ int libesedb_compression_xpress_decompress(
      size_t uncompressed_data_size,
      libcerror_error_t **error );
 
+int libesedb_compression_xpress_huffman_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+int libesedb_compression_xpress10_decompress_get_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int libesedb_compression_xpress10_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_decompress_get_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -70,12 +116,29 @@ int libesedb_compression_decompress(
      size_t uncompressed_data_size,
      libcerror_error_t **error );
 
+int libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_get_utf8_string_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *utf8_string_size,
      libcerror_error_t **error );
 
+int libesedb_compression_copy_uncompressed_data_to_utf8_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_copy_to_utf8_string(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -83,12 +146,29 @@ int libesedb_compression_copy_to_utf8_string(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_get_utf16_string_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *utf16_string_size,
      libcerror_error_t **error );
 
+int libesedb_compression_copy_uncompressed_data_to_utf16_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_copy_to_utf16_string(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
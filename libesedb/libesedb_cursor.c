@@ -0,0 +1,4861 @@
+/*
+ * Cursor functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_cursor.h"
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_filter.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_key.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page.h"
+#include "libesedb_page_value.h"
+#include "libesedb_record.h"
+#include "libesedb_record_layout.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_types.h"
+
+/* Creates a cursor
+ * Make sure the value cursor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_initialize(
+     libesedb_cursor_t **cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     uint32_t root_page_number,
+     libfdata_btree_t *long_values_tree,
+     libfcache_cache_t *long_values_cache,
+     libcerror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_initialize";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( root_page_number == 0 )
+	 || ( root_page_number > io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid root page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = memory_allocate_structure(
+	                   libesedb_internal_cursor_t );
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cursor,
+	     0,
+	     sizeof( libesedb_internal_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cursor.",
+		 function );
+
+		memory_free(
+		 internal_cursor );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_initialize(
+	     &( internal_cursor->data_definition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data definition.",
+		 function );
+
+		goto on_error;
+	}
+	internal_cursor->file_io_handle            = file_io_handle;
+	internal_cursor->io_handle                 = io_handle;
+	internal_cursor->table_definition          = table_definition;
+	internal_cursor->template_table_definition = template_table_definition;
+	internal_cursor->pages_vector              = pages_vector;
+	internal_cursor->pages_cache               = pages_cache;
+	internal_cursor->long_values_tree          = long_values_tree;
+	internal_cursor->long_values_cache         = long_values_cache;
+	internal_cursor->root_page_number          = root_page_number;
+
+	*cursor = (libesedb_cursor_t *) internal_cursor;
+
+	return( 1 );
+
+on_error:
+	if( internal_cursor != NULL )
+	{
+		memory_free(
+		 internal_cursor );
+	}
+	return( -1 );
+}
+
+/* Frees a cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_free(
+     libesedb_cursor_t **cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_free";
+	int result                                  = 1;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cursor != NULL )
+	{
+		internal_cursor = (libesedb_internal_cursor_t *) *cursor;
+		*cursor         = NULL;
+
+		/* The file_io_handle, io_handle, table_definition, template_table_definition,
+		 * pages_vector, pages_cache, long_values_tree and long_values_cache references are freed elsewhere
+		 */
+		if( libesedb_data_definition_free(
+		     &( internal_cursor->data_definition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data definition.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_cursor->table_cursor != NULL )
+		{
+			if( libesedb_cursor_free(
+			     &( internal_cursor->table_cursor ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free table cursor.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_cursor->upper_bound_key != NULL )
+		{
+			if( libesedb_key_free(
+			     &( internal_cursor->upper_bound_key ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free upper bound key.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_cursor->filter != NULL )
+		{
+			if( libesedb_filter_free(
+			     &( internal_cursor->filter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free filter.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_cursor->key_data != NULL )
+		{
+			memory_free(
+			 internal_cursor->key_data );
+		}
+		if( internal_cursor->key_column_catalog_definitions != NULL )
+		{
+			memory_free(
+			 internal_cursor->key_column_catalog_definitions );
+		}
+		if( internal_cursor->filter_column_projection != NULL )
+		{
+			memory_free(
+			 internal_cursor->filter_column_projection );
+		}
+		memory_free(
+		 internal_cursor );
+	}
+	return( result );
+}
+
+/* Resets the cursor
+ * After a reset the next record is the first record and the previous record the last record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_reset(
+     libesedb_cursor_t *cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_reset";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	internal_cursor->current_page_number      = 0;
+	internal_cursor->current_page_value_index = 0;
+	internal_cursor->current_value_is_set     = 0;
+
+	return( 1 );
+}
+
+/* Retrieves a specific page and its number of values
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_page(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     uint16_t *number_of_page_values,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *safe_page  = NULL;
+	static char *function       = "libesedb_cursor_get_page";
+	off64_t element_data_offset = 0;
+	off64_t page_offset         = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( page_number > internal_cursor->io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_page_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of page values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The page offset is relative to the start of the pages data
+	 */
+	page_offset  = page_number - 1;
+	page_offset *= internal_cursor->io_handle->page_size;
+
+	if( libfdata_vector_get_element_value_at_offset(
+	     internal_cursor->pages_vector,
+	     (intptr_t *) internal_cursor->file_io_handle,
+	     internal_cursor->pages_cache,
+	     page_offset,
+	     &element_data_offset,
+	     (intptr_t **) &safe_page,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " at offset: 0x%08" PRIx64 ".",
+		 function,
+		 page_number,
+		 page_offset );
+
+		return( -1 );
+	}
+	if( safe_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	if( ( safe_page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+	{
+		*number_of_page_values = 0;
+	}
+	else if( libesedb_page_get_number_of_values(
+	          safe_page,
+	          number_of_page_values,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values of page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	*page = safe_page;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the key data that precedes the data of a page value
+ * The key data consists of an optional common key size, the local key size and the local key
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_value_key_size(
+     libesedb_page_t *page,
+     libesedb_page_value_t *page_value,
+     uint16_t *key_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libesedb_cursor_get_value_key_size";
+	uint16_t local_key_size = 0;
+	uint16_t value_offset   = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_value->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page value - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+	{
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page flags - root flag is set.",
+			 function );
+
+			return( -1 );
+		}
+		value_offset += 2;
+	}
+	if( ( page_value->size < 2 )
+	 || ( value_offset > ( page_value->size - 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( page_value->data[ value_offset ] ),
+	 local_key_size );
+
+	/* The upper 3 bits of the first key size value can contain the page tag flags
+	 */
+	local_key_size &= 0x1fff;
+
+	value_offset += 2;
+
+	if( local_key_size > ( page_value->size - value_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: local key size exceeds page value size.",
+		 function );
+
+		return( -1 );
+	}
+	*key_size = value_offset + local_key_size;
+
+	return( 1 );
+}
+
+/* Resizes the key data buffer
+ * The key data buffer only grows and is reused for subsequent keys
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_resize_key_data(
+     libesedb_internal_cursor_t *internal_cursor,
+     size_t key_data_size,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "libesedb_cursor_resize_key_data";
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size > internal_cursor->key_data_size )
+	{
+		reallocation = memory_reallocate(
+		                internal_cursor->key_data,
+		                sizeof( uint8_t ) * key_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize key data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_cursor->key_data      = (uint8_t *) reallocation;
+		internal_cursor->key_data_size = key_data_size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the key of a specific page value
+ * The key consists of the common key of the page, if any, and the local key of the page value
+ * The key data references the key data buffer of the cursor and is valid until the next call
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_value_key(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_page_t *page,
+     libesedb_page_value_t *page_value,
+     libesedb_key_t *key,
+     libcerror_error_t **error )
+{
+	libesedb_page_value_t *header_page_value = NULL;
+	static char *function                    = "libesedb_cursor_get_value_key";
+	size_t key_data_size                     = 0;
+	uint16_t common_key_size                 = 0;
+	uint16_t local_key_size                  = 0;
+	uint16_t value_offset                    = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_value->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page value - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+	{
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page flags - root flag is set.",
+			 function );
+
+			return( -1 );
+		}
+		if( page_value->size < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page value size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_page_get_value(
+		     page,
+		     0,
+		     &header_page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: 0.",
+			 function );
+
+			return( -1 );
+		}
+		if( header_page_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing page value: 0.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 page_value->data,
+		 common_key_size );
+
+		common_key_size &= 0x1fff;
+
+		if( common_key_size > header_page_value->size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: common key size exceeds header page value size.",
+			 function );
+
+			return( -1 );
+		}
+		value_offset += 2;
+	}
+	if( ( page_value->size < 2 )
+	 || ( value_offset > ( page_value->size - 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( page_value->data[ value_offset ] ),
+	 local_key_size );
+
+	/* The upper 3 bits of the first key size value can contain the page tag flags
+	 */
+	local_key_size &= 0x1fff;
+
+	value_offset += 2;
+
+	if( local_key_size > ( page_value->size - value_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: local key size exceeds page value size.",
+		 function );
+
+		return( -1 );
+	}
+	key_data_size = (size_t) common_key_size + (size_t) local_key_size;
+
+	if( libesedb_cursor_resize_key_data(
+	     internal_cursor,
+	     key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( common_key_size > 0 )
+	{
+		if( memory_copy(
+		     internal_cursor->key_data,
+		     header_page_value->data,
+		     sizeof( uint8_t ) * common_key_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy common key data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( local_key_size > 0 )
+	{
+		if( memory_copy(
+		     &( internal_cursor->key_data[ common_key_size ] ),
+		     &( page_value->data[ value_offset ] ),
+		     sizeof( uint8_t ) * local_key_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy local key data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+	{
+		key->type = LIBESEDB_KEY_TYPE_LEAF;
+	}
+	else
+	{
+		key->type = LIBESEDB_KEY_TYPE_BRANCH;
+	}
+	key->data      = internal_cursor->key_data;
+	key->data_size = key_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the page number of the first or last leaf page
+ * The leaf page is determined by following the first or last child page from the root page
+ * Returns 1 if successful, 0 if the tree contains no leaf pages or -1 on error
+ */
+int libesedb_cursor_get_leaf_page_number(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint8_t get_last,
+     uint32_t *leaf_page_number,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page             = NULL;
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_cursor_get_leaf_page_number";
+	uint32_t child_page_number        = 0;
+	uint32_t page_number              = 0;
+	uint16_t key_size                 = 0;
+	uint16_t number_of_page_values    = 0;
+	uint16_t page_value_index         = 0;
+	int tree_depth                    = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf page number.",
+		 function );
+
+		return( -1 );
+	}
+	page_number = internal_cursor->root_page_number;
+
+	for( tree_depth = 0;
+	     tree_depth < LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH;
+	     tree_depth++ )
+	{
+		if( libesedb_cursor_get_page(
+		     internal_cursor,
+		     page_number,
+		     &page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		{
+			*leaf_page_number = page_number;
+
+			return( 1 );
+		}
+		child_page_number = 0;
+
+		/* The first page value contains the page header and is not a child page reference
+		 */
+		for( page_value_index = 1;
+		     page_value_index < number_of_page_values;
+		     page_value_index++ )
+		{
+			if( libesedb_page_get_value(
+			     page,
+			     ( get_last == 0 ) ? page_value_index : number_of_page_values - page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+			{
+				continue;
+			}
+			if( libesedb_cursor_get_value_key_size(
+			     page,
+			     page_value,
+			     &key_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 " key size.",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( key_size > ( page_value->size - 4 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid page value: %" PRIu16 " size value out of bounds.",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( page_value->data[ key_size ] ),
+			 child_page_number );
+
+			if( ( child_page_number > 0 )
+			 && ( child_page_number <= internal_cursor->io_handle->last_page_number ) )
+			{
+				break;
+			}
+			child_page_number = 0;
+		}
+		if( child_page_number == 0 )
+		{
+			return( 0 );
+		}
+		page_number = child_page_number;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid page tree - depth value exceeds maximum.",
+	 function );
+
+	return( -1 );
+}
+
+/* Sets the data definition from a specific leaf page value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_set_data_definition(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libcerror_error_t **error )
+{
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_cursor_set_data_definition";
+	uint16_t key_size                 = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_value(
+	     page,
+	     page_value_index,
+	     &page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		return( -1 );
+	}
+	if( libesedb_cursor_get_value_key_size(
+	     page,
+	     page_value,
+	     &key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 " key size.",
+		 function,
+		 page_value_index );
+
+		return( -1 );
+	}
+	internal_cursor->data_definition->page_offset      = (off64_t) ( page->page_number - 1 ) * internal_cursor->io_handle->page_size;
+	internal_cursor->data_definition->page_number      = page->page_number;
+	internal_cursor->data_definition->page_value_index = page_value_index;
+	internal_cursor->data_definition->data_offset      = page_value->offset + key_size;
+	internal_cursor->data_definition->data_size        = page_value->size - key_size;
+
+	return( 1 );
+}
+
+/* Moves the cursor to the next leaf page value
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_cursor_read_next_value(
+     libesedb_internal_cursor_t *internal_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page             = NULL;
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_cursor_read_next_value";
+	uint32_t page_number              = 0;
+	uint32_t number_of_pages          = 0;
+	uint16_t number_of_page_values    = 0;
+	uint16_t page_value_index         = 0;
+	int result                        = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	page_number      = internal_cursor->current_page_number;
+	page_value_index = internal_cursor->current_page_value_index;
+
+	if( page_number == 0 )
+	{
+		result = libesedb_cursor_get_leaf_page_number(
+		          internal_cursor,
+		          0,
+		          &page_number,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve first leaf page number.",
+				 function );
+			}
+			return( result );
+		}
+		page_value_index = 0;
+	}
+	/* The number of pages is used to detect loops in the leaf page chain
+	 */
+	while( number_of_pages <= internal_cursor->io_handle->last_page_number )
+	{
+		if( libesedb_cursor_get_page(
+		     internal_cursor,
+		     page_number,
+		     &page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		while( ( page_value_index + 1 ) < number_of_page_values )
+		{
+			page_value_index++;
+
+			if( libesedb_page_get_value(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+			{
+				continue;
+			}
+			if( libesedb_cursor_set_data_definition(
+			     internal_cursor,
+			     page,
+			     page_value_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set data definition.",
+				 function );
+
+				return( -1 );
+			}
+			internal_cursor->current_page_number      = page_number;
+			internal_cursor->current_page_value_index = page_value_index;
+			internal_cursor->current_value_is_set     = 1;
+
+			return( 1 );
+		}
+		if( page->next_page_number == 0 )
+		{
+			/* Position the cursor after the last value
+			 */
+			internal_cursor->current_page_number      = page_number;
+			internal_cursor->current_page_value_index = number_of_page_values;
+			internal_cursor->current_value_is_set     = 0;
+
+			return( 0 );
+		}
+		page_number      = page->next_page_number;
+		page_value_index = 0;
+
+		number_of_pages++;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid leaf page chain - number of pages value exceeds maximum.",
+	 function );
+
+	return( -1 );
+}
+
+/* Moves the cursor to the previous leaf page value
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_cursor_read_previous_value(
+     libesedb_internal_cursor_t *internal_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page             = NULL;
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_cursor_read_previous_value";
+	uint32_t page_number              = 0;
+	uint32_t number_of_pages          = 0;
+	uint16_t number_of_page_values    = 0;
+	uint16_t page_value_index         = 0;
+	int result                        = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	page_number      = internal_cursor->current_page_number;
+	page_value_index = internal_cursor->current_page_value_index;
+
+	if( page_number == 0 )
+	{
+		result = libesedb_cursor_get_leaf_page_number(
+		          internal_cursor,
+		          1,
+		          &page_number,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve last leaf page number.",
+				 function );
+			}
+			return( result );
+		}
+		page_value_index = UINT16_MAX;
+	}
+	/* The number of pages is used to detect loops in the leaf page chain
+	 */
+	while( number_of_pages <= internal_cursor->io_handle->last_page_number )
+	{
+		if( libesedb_cursor_get_page(
+		     internal_cursor,
+		     page_number,
+		     &page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( page_value_index > number_of_page_values )
+		{
+			page_value_index = number_of_page_values;
+		}
+		/* The first page value contains the page header and is not a leaf value
+		 */
+		while( page_value_index > 1 )
+		{
+			page_value_index--;
+
+			if( libesedb_page_get_value(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+			{
+				continue;
+			}
+			if( libesedb_cursor_set_data_definition(
+			     internal_cursor,
+			     page,
+			     page_value_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set data definition.",
+				 function );
+
+				return( -1 );
+			}
+			internal_cursor->current_page_number      = page_number;
+			internal_cursor->current_page_value_index = page_value_index;
+			internal_cursor->current_value_is_set     = 1;
+
+			return( 1 );
+		}
+		if( page->previous_page_number == 0 )
+		{
+			/* Position the cursor before the first value
+			 */
+			internal_cursor->current_page_number      = page_number;
+			internal_cursor->current_page_value_index = 0;
+			internal_cursor->current_value_is_set     = 0;
+
+			return( 0 );
+		}
+		page_number      = page->previous_page_number;
+		page_value_index = UINT16_MAX;
+
+		number_of_pages++;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid leaf page chain - number of pages value exceeds maximum.",
+	 function );
+
+	return( -1 );
+}
+
+/* Moves the cursor to the first leaf page value with a key equal to or greater than the key
+ * The branch pages are descended by comparing the key against the key of the child page references,
+ * which are treated as the exclusive upper bound of the child page, hence a key equal to the key
+ * of a child page reference is found in the next child page. If the leaf page does not contain
+ * a greater or equal key the cursor continues with the next leaf page.
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_cursor_seek_key(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_key_t *key,
+     uint8_t *is_exact_match,
+     libcerror_error_t **error )
+{
+	libesedb_key_t page_value_key;
+
+	libesedb_page_t *page             = NULL;
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_cursor_seek_key";
+	uint32_t child_page_number        = 0;
+	uint32_t page_number              = 0;
+	uint16_t key_size                 = 0;
+	uint16_t number_of_page_values    = 0;
+	uint16_t page_value_index         = 0;
+	int compare_result                = 0;
+	int result                        = 0;
+	int tree_depth                    = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_exact_match == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is exact match.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &page_value_key,
+	     0,
+	     sizeof( libesedb_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page value key.",
+		 function );
+
+		return( -1 );
+	}
+	*is_exact_match = 0;
+
+	internal_cursor->current_page_number      = 0;
+	internal_cursor->current_page_value_index = 0;
+	internal_cursor->current_value_is_set     = 0;
+
+	page_number = internal_cursor->root_page_number;
+
+	for( tree_depth = 0;
+	     tree_depth < LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH;
+	     tree_depth++ )
+	{
+		if( libesedb_cursor_get_page(
+		     internal_cursor,
+		     page_number,
+		     &page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		{
+			break;
+		}
+		child_page_number = 0;
+
+		/* The first page value contains the page header and is not a child page reference
+		 */
+		for( page_value_index = 1;
+		     page_value_index < number_of_page_values;
+		     page_value_index++ )
+		{
+			if( libesedb_page_get_value(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+			{
+				continue;
+			}
+			if( libesedb_cursor_get_value_key_size(
+			     page,
+			     page_value,
+			     &key_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 " key size.",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( key_size > ( page_value->size - 4 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid page value: %" PRIu16 " size value out of bounds.",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( page_value->data[ key_size ] ),
+			 child_page_number );
+
+			if( ( child_page_number == 0 )
+			 || ( child_page_number > internal_cursor->io_handle->last_page_number ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid page value: %" PRIu16 " child page number value out of bounds.",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( libesedb_cursor_get_value_key(
+			     internal_cursor,
+			     page,
+			     page_value,
+			     &page_value_key,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 " key.",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			compare_result = libesedb_key_compare(
+			                  key,
+			                  &page_value_key,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key with page value: %" PRIu16 " key.",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			/* An empty key has no upper bound and is less than the key
+			 */
+			if( compare_result != LIBFDATA_COMPARE_GREATER )
+			{
+				break;
+			}
+		}
+		/* If the key is greater than all the keys the last child page is used
+		 * and if there are no child pages the tree is empty
+		 */
+		if( child_page_number == 0 )
+		{
+			return( 0 );
+		}
+		page_number = child_page_number;
+	}
+	if( tree_depth >= LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page tree - depth value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first page value contains the page header and is not a leaf value
+	 */
+	for( page_value_index = 1;
+	     page_value_index < number_of_page_values;
+	     page_value_index++ )
+	{
+		if( libesedb_page_get_value(
+		     page,
+		     page_value_index,
+		     &page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			return( -1 );
+		}
+		if( page_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			return( -1 );
+		}
+		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+		{
+			continue;
+		}
+		if( libesedb_cursor_get_value_key(
+		     internal_cursor,
+		     page,
+		     page_value,
+		     &page_value_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: %" PRIu16 " key.",
+			 function,
+			 page_value_index );
+
+			return( -1 );
+		}
+		compare_result = libesedb_key_compare(
+		                  key,
+		                  &page_value_key,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key with page value: %" PRIu16 " key.",
+			 function,
+			 page_value_index );
+
+			return( -1 );
+		}
+		if( compare_result != LIBFDATA_COMPARE_GREATER )
+		{
+			if( libesedb_cursor_set_data_definition(
+			     internal_cursor,
+			     page,
+			     page_value_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set data definition.",
+				 function );
+
+				return( -1 );
+			}
+			internal_cursor->current_page_number      = page_number;
+			internal_cursor->current_page_value_index = page_value_index;
+			internal_cursor->current_value_is_set     = 1;
+
+			if( compare_result == LIBFDATA_COMPARE_EQUAL )
+			{
+				*is_exact_match = 1;
+			}
+			return( 1 );
+		}
+	}
+	/* The key is greater than all the keys in the leaf page,
+	 * hence the first value of the next leaf page is equal to or greater than the key
+	 */
+	internal_cursor->current_page_number      = page_number;
+	internal_cursor->current_page_value_index = number_of_page_values;
+
+	result = libesedb_cursor_read_next_value(
+	          internal_cursor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read next value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		compare_result = libesedb_cursor_compare_current_key(
+		                  internal_cursor,
+		                  key,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key with current key.",
+			 function );
+
+			return( -1 );
+		}
+		if( compare_result == LIBFDATA_COMPARE_EQUAL )
+		{
+			*is_exact_match = 1;
+		}
+	}
+	return( result );
+}
+
+/* Moves the cursor before the first leaf page value that matches the key
+ * The match mode determines if the key of the value must be equal to, greater than or equal to,
+ * or greater than the key. The next value read from the cursor is the matching value.
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_cursor_seek(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_key_t *key,
+     int match_mode,
+     libcerror_error_t **error )
+{
+	static char *function  = "libesedb_cursor_seek";
+	uint8_t is_exact_match = 0;
+	int compare_result     = 0;
+	int result             = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( match_mode != LIBESEDB_KEY_MATCH_MODE_EQUAL )
+	 && ( match_mode != LIBESEDB_KEY_MATCH_MODE_GREATER_EQUAL )
+	 && ( match_mode != LIBESEDB_KEY_MATCH_MODE_GREATER ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported match mode.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_cursor_seek_key(
+	          internal_cursor,
+	          key,
+	          &is_exact_match,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek key.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( match_mode == LIBESEDB_KEY_MATCH_MODE_EQUAL )
+	{
+		if( is_exact_match == 0 )
+		{
+			return( 0 );
+		}
+	}
+	else if( match_mode == LIBESEDB_KEY_MATCH_MODE_GREATER )
+	{
+		while( is_exact_match != 0 )
+		{
+			result = libesedb_cursor_read_next_value(
+			          internal_cursor,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to read next value.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				return( 0 );
+			}
+			compare_result = libesedb_cursor_compare_current_key(
+			                  internal_cursor,
+			                  key,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key with current key.",
+				 function );
+
+				return( -1 );
+			}
+			if( compare_result != LIBFDATA_COMPARE_EQUAL )
+			{
+				is_exact_match = 0;
+			}
+		}
+	}
+	/* The matching value has a page value index of 1 or more,
+	 * position the cursor directly before it
+	 */
+	internal_cursor->current_page_value_index -= 1;
+	internal_cursor->current_value_is_set      = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the current leaf page value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_current_page_value(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_page_t **page,
+     libesedb_page_value_t **page_value,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *safe_page     = NULL;
+	static char *function          = "libesedb_cursor_get_current_page_value";
+	uint16_t number_of_page_values = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_cursor->current_page_number == 0 )
+	 || ( internal_cursor->current_value_is_set == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - not positioned on a value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_cursor_get_page(
+	     internal_cursor,
+	     internal_cursor->current_page_number,
+	     &safe_page,
+	     &number_of_page_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf page: %" PRIu32 ".",
+		 function,
+		 internal_cursor->current_page_number );
+
+		return( -1 );
+	}
+	if( ( internal_cursor->current_page_value_index == 0 )
+	 || ( internal_cursor->current_page_value_index >= number_of_page_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cursor - current page value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_value(
+	     safe_page,
+	     internal_cursor->current_page_value_index,
+	     page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 function,
+		 internal_cursor->current_page_value_index );
+
+		return( -1 );
+	}
+	*page = safe_page;
+
+	return( 1 );
+}
+
+/* Retrieves the key of the current leaf page value
+ * The key data references the key data buffer of the cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_current_key(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_key_t *key,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page             = NULL;
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_cursor_get_current_key";
+
+	if( libesedb_cursor_get_current_page_value(
+	     internal_cursor,
+	     &page,
+	     &page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current page value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_cursor_get_value_key(
+	     internal_cursor,
+	     page,
+	     page_value,
+	     key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 " key.",
+		 function,
+		 internal_cursor->current_page_value_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the key of the record of the current leaf page value
+ * For an index cursor this is the data of the index value, which references the page data,
+ * otherwise the key of the current leaf page value, which references the key data buffer of the cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_current_record_key(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint8_t **record_key_data,
+     size_t *record_key_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_key_t current_key;
+
+	static char *function = "libesedb_cursor_get_current_record_key";
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_key_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record key data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->current_value_is_set == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - not positioned on a value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->table_cursor != NULL )
+	{
+		if( libesedb_data_definition_read_data(
+		     internal_cursor->data_definition,
+		     internal_cursor->file_io_handle,
+		     internal_cursor->io_handle,
+		     internal_cursor->pages_vector,
+		     internal_cursor->pages_cache,
+		     record_key_data,
+		     record_key_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index data definition data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( memory_set(
+	     &current_key,
+	     0,
+	     sizeof( libesedb_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear current key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_cursor_get_current_key(
+	     internal_cursor,
+	     &current_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current key.",
+		 function );
+
+		return( -1 );
+	}
+	*record_key_data      = current_key.data;
+	*record_key_data_size = current_key.data_size;
+
+	return( 1 );
+}
+
+/* Compares a key with the key of the current leaf page value
+ * Returns LIBFDATA_COMPARE_LESS, LIBFDATA_COMPARE_EQUAL, LIBFDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libesedb_cursor_compare_current_key(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_key_t *key,
+     libcerror_error_t **error )
+{
+	libesedb_key_t current_key;
+
+	static char *function = "libesedb_cursor_compare_current_key";
+	int compare_result    = 0;
+
+	if( memory_set(
+	     &current_key,
+	     0,
+	     sizeof( libesedb_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear current key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_cursor_get_current_key(
+	     internal_cursor,
+	     &current_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current key.",
+		 function );
+
+		return( -1 );
+	}
+	compare_result = libesedb_key_compare(
+	                  key,
+	                  &current_key,
+	                  error );
+
+	if( compare_result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare key with current key.",
+		 function );
+
+		return( -1 );
+	}
+	return( compare_result );
+}
+
+/* Retrieves the number of leaf page values
+ * The number of values is determined by walking the chain of leaf pages
+ * and does not change the position of the cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_number_of_values(
+     libesedb_internal_cursor_t *internal_cursor,
+     int *number_of_values,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page             = NULL;
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_cursor_get_number_of_values";
+	uint32_t number_of_pages          = 0;
+	uint32_t page_number              = 0;
+	uint16_t number_of_page_values    = 0;
+	uint16_t page_value_index         = 0;
+	int result                        = 0;
+	int safe_number_of_values         = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_cursor_get_leaf_page_number(
+	          internal_cursor,
+	          0,
+	          &page_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first leaf page number.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of pages is used to detect loops in the leaf page chain
+	 */
+	while( ( page_number != 0 )
+	    && ( number_of_pages <= internal_cursor->io_handle->last_page_number ) )
+	{
+		if( libesedb_cursor_get_page(
+		     internal_cursor,
+		     page_number,
+		     &page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		/* The first page value contains the page header and is not a leaf value
+		 */
+		for( page_value_index = 1;
+		     page_value_index < number_of_page_values;
+		     page_value_index++ )
+		{
+			if( libesedb_page_get_value(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+			{
+				continue;
+			}
+			if( safe_number_of_values == INT_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of values value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			safe_number_of_values++;
+		}
+		page_number = page->next_page_number;
+
+		number_of_pages++;
+	}
+	if( page_number != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid leaf page chain - number of pages value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_values = safe_number_of_values;
+
+	return( 1 );
+}
+
+/* Retrieves the column projection used to read records
+ * The values of the columns of the filter are read in addition to the projected values,
+ * see libesedb_cursor_unset_filter_values
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_read_column_projection(
+     libesedb_internal_cursor_t *internal_cursor,
+     const uint8_t **column_projection,
+     libcerror_error_t **error )
+{
+	libesedb_record_layout_t *record_layout = NULL;
+	static char *function                   = "libesedb_cursor_get_read_column_projection";
+	int column_index                        = 0;
+	int predicate_index                     = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_projection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column projection.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_cursor->column_projection == NULL )
+	 || ( internal_cursor->filter == NULL )
+	 || ( internal_cursor->filter->number_of_predicates == 0 ) )
+	{
+		*column_projection = internal_cursor->column_projection;
+
+		return( 1 );
+	}
+	if( ( internal_cursor->table_definition == NULL )
+	 || ( internal_cursor->table_definition->record_layout == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing record layout.",
+		 function );
+
+		return( -1 );
+	}
+	record_layout = internal_cursor->table_definition->record_layout;
+
+	/* The number of columns of the record layout does not change
+	 * hence the filter column projection is allocated once
+	 */
+	if( internal_cursor->filter_column_projection == NULL )
+	{
+		if( record_layout->number_of_columns <= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record layout - number of columns value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		internal_cursor->filter_column_projection = (uint8_t *) memory_allocate(
+		                                                         sizeof( uint8_t ) * record_layout->number_of_columns );
+
+		if( internal_cursor->filter_column_projection == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filter column projection.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The column projection of the table can change after the cursor was created
+	 * hence the filter column projection is rebuilt for every record
+	 */
+	if( memory_copy(
+	     internal_cursor->filter_column_projection,
+	     internal_cursor->column_projection,
+	     sizeof( uint8_t ) * record_layout->number_of_columns ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy column projection.",
+		 function );
+
+		return( -1 );
+	}
+	for( predicate_index = 0;
+	     predicate_index < internal_cursor->filter->number_of_predicates;
+	     predicate_index++ )
+	{
+		column_index = internal_cursor->filter->predicates[ predicate_index ].column_index;
+
+		if( ( column_index < 0 )
+		 || ( column_index >= record_layout->number_of_columns ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid predicate: %d - column index value out of bounds.",
+			 function,
+			 predicate_index );
+
+			return( -1 );
+		}
+		internal_cursor->filter_column_projection[ column_index ] = 1;
+	}
+	*column_projection = internal_cursor->filter_column_projection;
+
+	return( 1 );
+}
+
+/* Unsets the values of the columns of the filter that are not projected
+ * The values are only read to match the filter and are not part of the record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_unset_filter_values(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_record_t *record,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_cursor_unset_filter_values";
+	int column_index      = 0;
+	int predicate_index   = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_cursor->column_projection == NULL )
+	 || ( internal_cursor->filter == NULL ) )
+	{
+		return( 1 );
+	}
+	for( predicate_index = 0;
+	     predicate_index < internal_cursor->filter->number_of_predicates;
+	     predicate_index++ )
+	{
+		column_index = internal_cursor->filter->predicates[ predicate_index ].column_index;
+
+		if( internal_cursor->column_projection[ column_index ] != 0 )
+		{
+			continue;
+		}
+		if( libesedb_record_unset_record_value(
+		     (libesedb_internal_record_t *) record,
+		     column_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to unset value: %d of predicate: %d.",
+			 function,
+			 column_index,
+			 predicate_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Creates a record from the current leaf page value
+ * If the record is already set the record is reused and its values are replaced
+ * If the cursor is an index cursor the record is retrieved from the table using the index value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_read_record(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_key_t record_key;
+
+	libesedb_internal_record_t *internal_record = NULL;
+	const uint8_t *column_projection            = NULL;
+	uint8_t *index_data                         = NULL;
+	static char *function                       = "libesedb_cursor_read_record";
+	size_t index_data_size                      = 0;
+	uint8_t is_exact_match                      = 0;
+	int result                                  = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->table_cursor != NULL )
+	{
+		/* The data of an index value contains the key of the record in the table
+		 */
+		if( libesedb_data_definition_read_data(
+		     internal_cursor->data_definition,
+		     internal_cursor->file_io_handle,
+		     internal_cursor->io_handle,
+		     internal_cursor->pages_vector,
+		     internal_cursor->pages_cache,
+		     &index_data,
+		     &index_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index data definition data.",
+			 function );
+
+			return( -1 );
+		}
+		if( index_data_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid index data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* The index data references the page data, which can be removed from the pages cache
+		 * while the table cursor is positioned, hence the index data is copied
+		 */
+		if( libesedb_cursor_resize_key_data(
+		     internal_cursor,
+		     index_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize key data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     internal_cursor->key_data,
+		     index_data,
+		     sizeof( uint8_t ) * index_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy index data.",
+			 function );
+
+			return( -1 );
+		}
+		record_key.type      = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+		record_key.data      = internal_cursor->key_data;
+		record_key.data_size = index_data_size;
+
+		result = libesedb_cursor_seek_key(
+		          (libesedb_internal_cursor_t *) internal_cursor->table_cursor,
+		          &record_key,
+		          &is_exact_match,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to seek record key in table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      || ( is_exact_match == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing record for index value in table.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_cursor_read_record(
+		     (libesedb_internal_cursor_t *) internal_cursor->table_cursor,
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record from table.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libesedb_cursor_get_read_column_projection(
+	     internal_cursor,
+	     &column_projection,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read column projection.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		internal_record = (libesedb_internal_record_t *) *record;
+
+		if( internal_record->table_definition != internal_cursor->table_definition )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid record - table definition mismatch.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_record_read(
+		     internal_record,
+		     internal_cursor->data_definition,
+		     column_projection,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libesedb_record_initialize(
+	     record,
+	     internal_cursor->file_io_handle,
+	     internal_cursor->io_handle,
+	     internal_cursor->table_definition,
+	     internal_cursor->template_table_definition,
+	     internal_cursor->pages_vector,
+	     internal_cursor->pages_cache,
+	     internal_cursor->pages_vector,
+	     internal_cursor->pages_cache,
+	     internal_cursor->data_definition,
+	     internal_cursor->long_values_tree,
+	     internal_cursor->long_values_cache,
+	     column_projection,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the key columns from the index catalog definition
+ * The key columns are used to decode the key values of the index values
+ * If a key column cannot be resolved the key values are not decoded
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_set_key_columns(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_catalog_definition_t *index_catalog_definition,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t **key_column_catalog_definitions = NULL;
+	static char *function                                          = "libesedb_cursor_set_key_columns";
+	uint32_t column_identifier                                     = 0;
+	int key_column_index                                           = 0;
+	int number_of_key_columns                                      = 0;
+	int result                                                     = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->key_column_catalog_definitions != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cursor - key column catalog definitions value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_get_number_of_key_columns(
+	     index_catalog_definition,
+	     &number_of_key_columns,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of key columns.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_key_columns == 0 )
+	{
+		return( 1 );
+	}
+	key_column_catalog_definitions = (libesedb_catalog_definition_t **) memory_allocate(
+	                                  sizeof( libesedb_catalog_definition_t * ) * number_of_key_columns );
+
+	if( key_column_catalog_definitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key column catalog definitions.",
+		 function );
+
+		goto on_error;
+	}
+	for( key_column_index = 0;
+	     key_column_index < number_of_key_columns;
+	     key_column_index++ )
+	{
+		if( libesedb_catalog_definition_get_key_column_identifier(
+		     index_catalog_definition,
+		     key_column_index,
+		     &column_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key column: %d identifier.",
+			 function,
+			 key_column_index );
+
+			goto on_error;
+		}
+		key_column_catalog_definitions[ key_column_index ] = NULL;
+
+		result = 0;
+
+		if( internal_cursor->template_table_definition != NULL )
+		{
+			result = libesedb_table_definition_get_column_catalog_definition_by_identifier(
+			          internal_cursor->template_table_definition,
+			          column_identifier,
+			          &( key_column_catalog_definitions[ key_column_index ] ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve template table column: %" PRIu32 " catalog definition.",
+				 function,
+				 column_identifier );
+
+				goto on_error;
+			}
+		}
+		if( result == 0 )
+		{
+			result = libesedb_table_definition_get_column_catalog_definition_by_identifier(
+			          internal_cursor->table_definition,
+			          column_identifier,
+			          &( key_column_catalog_definitions[ key_column_index ] ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve table column: %" PRIu32 " catalog definition.",
+				 function,
+				 column_identifier );
+
+				goto on_error;
+			}
+		}
+		if( result == 0 )
+		{
+			/* Without the column catalog definition the key cannot be decoded
+			 */
+			memory_free(
+			 key_column_catalog_definitions );
+
+			return( 1 );
+		}
+	}
+	internal_cursor->key_column_catalog_definitions = key_column_catalog_definitions;
+	internal_cursor->number_of_key_columns          = number_of_key_columns;
+
+	return( 1 );
+
+on_error:
+	if( key_column_catalog_definitions != NULL )
+	{
+		memory_free(
+		 key_column_catalog_definitions );
+	}
+	return( -1 );
+}
+
+/* Reads a specific key value from the key of the current leaf page value
+ * The key segments are read up to the requested key value, which requires
+ * all preceding key columns to be of a fixed-size column type
+ * The value is stored as in a record, a value size of 0 represents a NULL value
+ * Returns 1 if successful, 0 if the key value cannot be decoded or -1 on error
+ */
+int libesedb_cursor_read_key_value(
+     libesedb_internal_cursor_t *internal_cursor,
+     int key_value_index,
+     uint8_t *value_data,
+     size_t value_data_size,
+     size_t *value_size,
+     libcerror_error_t **error )
+{
+	libesedb_key_t current_key;
+	uint8_t segment_value_data[ 8 ];
+
+	static char *function     = "libesedb_cursor_read_key_value";
+	size_t key_data_offset    = 0;
+	size_t segment_value_size = 0;
+	uint32_t column_type      = 0;
+	int key_column_index      = 0;
+	int result                = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_value_index < 0 )
+	 || ( key_value_index >= internal_cursor->number_of_key_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &current_key,
+	     0,
+	     sizeof( libesedb_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear current key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_cursor_get_current_key(
+	     internal_cursor,
+	     &current_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current key.",
+		 function );
+
+		return( -1 );
+	}
+	for( key_column_index = 0;
+	     key_column_index <= key_value_index;
+	     key_column_index++ )
+	{
+		if( libesedb_catalog_definition_get_column_type(
+		     internal_cursor->key_column_catalog_definitions[ key_column_index ],
+		     &column_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key column: %d type.",
+			 function,
+			 key_column_index );
+
+			return( -1 );
+		}
+		result = libesedb_key_get_fixed_size_segment_value_size(
+		          column_type,
+		          &segment_value_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key column: %d segment value size.",
+			 function,
+			 key_column_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			/* Variable-size key segments, such as text, are stored in a lossy normalized form
+			 */
+			return( 0 );
+		}
+		/* The key is truncated to the maximum key size
+		 */
+		if( key_data_offset >= current_key.data_size )
+		{
+			return( 0 );
+		}
+		result = libesedb_key_read_fixed_size_segment(
+		          current_key.data,
+		          current_key.data_size,
+		          &key_data_offset,
+		          column_type,
+		          segment_value_data,
+		          8,
+		          &segment_value_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read key column: %d segment.",
+			 function,
+			 key_column_index );
+
+			return( -1 );
+		}
+	}
+	if( value_data != NULL )
+	{
+		if( value_data_size < segment_value_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid value data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( segment_value_size > 0 )
+		{
+			if( memory_copy(
+			     value_data,
+			     segment_value_data,
+			     segment_value_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy key value data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	*value_size = segment_value_size;
+
+	return( 1 );
+}
+
+/* Sets the upper bound key
+ * The key data contains the (normalized) key as stored in the leaf pages
+ * Once the key of the next record exceeds the upper bound key no next record is returned
+ * Use is_inclusive to indicate a record with a key equal to the upper bound key is returned
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_set_upper_bound(
+     libesedb_cursor_t *cursor,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint8_t is_inclusive,
+     libcerror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	libesedb_key_t *upper_bound_key             = NULL;
+	static char *function                       = "libesedb_cursor_set_upper_bound";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_data_size == 0 )
+	 || ( key_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_key_initialize(
+	     &upper_bound_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create upper bound key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_set_data(
+	     upper_bound_key,
+	     key_data,
+	     key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set upper bound key data.",
+		 function );
+
+		goto on_error;
+	}
+	upper_bound_key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+	if( internal_cursor->upper_bound_key != NULL )
+	{
+		if( libesedb_key_free(
+		     &( internal_cursor->upper_bound_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free upper bound key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_cursor->upper_bound_key          = upper_bound_key;
+	internal_cursor->upper_bound_is_inclusive = is_inclusive;
+
+	return( 1 );
+
+on_error:
+	if( upper_bound_key != NULL )
+	{
+		libesedb_key_free(
+		 &upper_bound_key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a filter predicate
+ * The column identifier is resolved to the column in the record layout of the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_append_filter_predicate(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint8_t predicate_type,
+     uint32_t column_identifier,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     const uint8_t *upper_value_data,
+     size_t upper_value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_record_layout_t *record_layout = NULL;
+	static char *function                   = "libesedb_cursor_append_filter_predicate";
+	size_t value_size                       = 0;
+	int column_index                        = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	record_layout = internal_cursor->table_definition->record_layout;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - invalid table definition - missing record layout.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_index = 0;
+	     column_index < record_layout->number_of_columns;
+	     column_index++ )
+	{
+		if( record_layout->columns[ column_index ].identifier == column_identifier )
+		{
+			break;
+		}
+	}
+	if( column_index >= record_layout->number_of_columns )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column identifier: %" PRIu32 " value out of bounds.",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	/* The value data of a fixed size column type must be of the size of the column type
+	 * otherwise the value data cannot be compared by its numeric value
+	 */
+	value_size = (size_t) record_layout->columns[ column_index ].value_size;
+
+	if( value_size != 0 )
+	{
+		if( predicate_type == LIBESEDB_FILTER_PREDICATE_TYPE_PREFIX )
+		{
+			if( value_data_size > value_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid prefix data size value exceeds column value size.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( ( ( value_data != NULL )
+		       && ( value_data_size != value_size ) )
+		      || ( ( upper_value_data != NULL )
+		       && ( upper_value_data_size != value_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value data size value does not match column value size: %" PRIzd ".",
+			 function,
+			 value_size );
+
+			return( -1 );
+		}
+	}
+	if( internal_cursor->filter == NULL )
+	{
+		if( libesedb_filter_initialize(
+		     &( internal_cursor->filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create filter.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_filter_append_predicate(
+	     internal_cursor->filter,
+	     predicate_type,
+	     column_index,
+	     record_layout->columns[ column_index ].column_catalog_definition->column_type,
+	     value_data,
+	     value_data_size,
+	     upper_value_data,
+	     upper_value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append predicate to filter.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an equal filter predicate
+ * Only records where the value of the column equals the value data are returned
+ * The value data is stored as in a record, values of numeric columns are compared
+ * by their numeric value. The value data size must match the size of a fixed size column type
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_append_filter_equal(
+     libesedb_cursor_t *cursor,
+     uint32_t column_identifier,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_cursor_append_filter_equal";
+
+	if( libesedb_cursor_append_filter_predicate(
+	     (libesedb_internal_cursor_t *) cursor,
+	     LIBESEDB_FILTER_PREDICATE_TYPE_EQUAL,
+	     column_identifier,
+	     value_data,
+	     value_data_size,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filter predicate.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a range filter predicate
+ * Only records where the value of the column is within the lower and upper bound,
+ * including the bounds, are returned. A NULL lower or upper bound value data represents
+ * an open bound, at least one of the bounds must be set. The value data sizes
+ * must match the size of a fixed size column type
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_append_filter_range(
+     libesedb_cursor_t *cursor,
+     uint32_t column_identifier,
+     const uint8_t *lower_value_data,
+     size_t lower_value_data_size,
+     const uint8_t *upper_value_data,
+     size_t upper_value_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_cursor_append_filter_range";
+
+	if( libesedb_cursor_append_filter_predicate(
+	     (libesedb_internal_cursor_t *) cursor,
+	     LIBESEDB_FILTER_PREDICATE_TYPE_RANGE,
+	     column_identifier,
+	     lower_value_data,
+	     lower_value_data_size,
+	     upper_value_data,
+	     upper_value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filter predicate.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an is NULL filter predicate
+ * Only records where the column has no value are returned
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_append_filter_is_null(
+     libesedb_cursor_t *cursor,
+     uint32_t column_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_cursor_append_filter_is_null";
+
+	if( libesedb_cursor_append_filter_predicate(
+	     (libesedb_internal_cursor_t *) cursor,
+	     LIBESEDB_FILTER_PREDICATE_TYPE_IS_NULL,
+	     column_identifier,
+	     NULL,
+	     0,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filter predicate.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an is not NULL filter predicate
+ * Only records where the column has a value are returned
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_append_filter_is_not_null(
+     libesedb_cursor_t *cursor,
+     uint32_t column_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_cursor_append_filter_is_not_null";
+
+	if( libesedb_cursor_append_filter_predicate(
+	     (libesedb_internal_cursor_t *) cursor,
+	     LIBESEDB_FILTER_PREDICATE_TYPE_IS_NOT_NULL,
+	     column_identifier,
+	     NULL,
+	     0,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filter predicate.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a prefix filter predicate
+ * Only records where the value data of the column starts with the prefix data are returned
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_append_filter_prefix(
+     libesedb_cursor_t *cursor,
+     uint32_t column_identifier,
+     const uint8_t *prefix_data,
+     size_t prefix_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_cursor_append_filter_prefix";
+
+	if( libesedb_cursor_append_filter_predicate(
+	     (libesedb_internal_cursor_t *) cursor,
+	     LIBESEDB_FILTER_PREDICATE_TYPE_PREFIX,
+	     column_identifier,
+	     prefix_data,
+	     prefix_data_size,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filter predicate.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Clears the filter
+ * After the filter is cleared all records are returned
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_clear_filter(
+     libesedb_cursor_t *cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_clear_filter";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	if( internal_cursor->filter != NULL )
+	{
+		if( libesedb_filter_free(
+		     &( internal_cursor->filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free filter.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Moves the cursor to the next value
+ * Once the key of the next value exceeds the upper bound key the cursor is not positioned on a value
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_cursor_move_to_next(
+     libesedb_cursor_t *cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_move_to_next";
+	int compare_result                          = 0;
+	int result                                  = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	result = libesedb_cursor_read_next_value(
+	          internal_cursor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read next value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( internal_cursor->upper_bound_key != NULL ) )
+	{
+		compare_result = libesedb_cursor_compare_current_key(
+		                  internal_cursor,
+		                  internal_cursor->upper_bound_key,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare upper bound key with current key.",
+			 function );
+
+			return( -1 );
+		}
+		/* The upper bound key is less than the current key
+		 */
+		if( ( compare_result == LIBFDATA_COMPARE_LESS )
+		 || ( ( compare_result == LIBFDATA_COMPARE_EQUAL )
+		  && ( internal_cursor->upper_bound_is_inclusive == 0 ) ) )
+		{
+			internal_cursor->current_value_is_set = 0;
+
+			result = 0;
+		}
+	}
+	return( result );
+}
+
+/* Moves the cursor to the previous value
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_cursor_move_to_previous(
+     libesedb_cursor_t *cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_move_to_previous";
+	int result                                  = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	result = libesedb_cursor_read_previous_value(
+	          internal_cursor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read previous value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the record of the current value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_record(
+     libesedb_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_get_record";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->current_value_is_set == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - not positioned on a value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_cursor_read_record(
+	     internal_cursor,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the key of the current value
+ * The key is the (normalized) key as stored in the leaf pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_key_size(
+     libesedb_cursor_t *cursor,
+     size_t *key_size,
+     libcerror_error_t **error )
+{
+	libesedb_key_t current_key;
+
+	static char *function = "libesedb_cursor_get_key_size";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &current_key,
+	     0,
+	     sizeof( libesedb_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear current key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_cursor_get_current_key(
+	     (libesedb_internal_cursor_t *) cursor,
+	     &current_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current key.",
+		 function );
+
+		return( -1 );
+	}
+	*key_size = current_key.data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the key of the current value
+ * The key is the (normalized) key as stored in the leaf pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_key(
+     libesedb_cursor_t *cursor,
+     uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error )
+{
+	libesedb_key_t current_key;
+
+	static char *function = "libesedb_cursor_get_key";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &current_key,
+	     0,
+	     sizeof( libesedb_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear current key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_cursor_get_current_key(
+	     (libesedb_internal_cursor_t *) cursor,
+	     &current_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size < current_key.data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid key size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_key.data_size > 0 )
+	{
+		if( memory_copy(
+		     key,
+		     current_key.data,
+		     current_key.data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the record key of the current value
+ * For an index cursor this is the key of the record in the table, as stored in the index value,
+ * which can be used without reading the record from the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_record_key_size(
+     libesedb_cursor_t *cursor,
+     size_t *record_key_size,
+     libcerror_error_t **error )
+{
+	uint8_t *record_key_data    = NULL;
+	static char *function       = "libesedb_cursor_get_record_key_size";
+	size_t record_key_data_size = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_key_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record key size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_cursor_get_current_record_key(
+	     (libesedb_internal_cursor_t *) cursor,
+	     &record_key_data,
+	     &record_key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current record key.",
+		 function );
+
+		return( -1 );
+	}
+	*record_key_size = record_key_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the record key of the current value
+ * For an index cursor this is the key of the record in the table, as stored in the index value,
+ * which can be used without reading the record from the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_record_key(
+     libesedb_cursor_t *cursor,
+     uint8_t *record_key,
+     size_t record_key_size,
+     libcerror_error_t **error )
+{
+	uint8_t *record_key_data    = NULL;
+	static char *function       = "libesedb_cursor_get_record_key";
+	size_t record_key_data_size = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record key.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_key_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record key size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_cursor_get_current_record_key(
+	     (libesedb_internal_cursor_t *) cursor,
+	     &record_key_data,
+	     &record_key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current record key.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_key_size < record_key_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid record key size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_key_data_size > 0 )
+	{
+		if( memory_copy(
+		     record_key,
+		     record_key_data,
+		     record_key_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy record key.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of key values
+ * The key values correspond with the key columns of the index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_number_of_key_values(
+     libesedb_cursor_t *cursor,
+     int *number_of_key_values,
+     libcerror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_get_number_of_key_values";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	if( number_of_key_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of key values.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_key_values = internal_cursor->number_of_key_columns;
+
+	return( 1 );
+}
+
+/* Retrieves the column identifier of a specific key value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_cursor_get_key_value_column_identifier(
+     libesedb_cursor_t *cursor,
+     int key_value_index,
+     uint32_t *column_identifier,
+     libcerror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_get_key_value_column_identifier";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	if( ( key_value_index < 0 )
+	 || ( key_value_index >= internal_cursor->number_of_key_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*column_identifier = internal_cursor->key_column_catalog_definitions[ key_value_index ]->identifier;
+
+	return( 1 );
+}
+
+/* Retrieves the data size of a specific key value of the current value
+ * The key value is decoded from the key without reading the record
+ * A data size of 0 represents a NULL value
+ * Returns 1 if successful, 0 if the key value cannot be decoded or -1 on error
+ */
+int libesedb_cursor_get_key_value_data_size(
+     libesedb_cursor_t *cursor,
+     int key_value_index,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_cursor_get_key_value_data_size";
+	int result            = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_cursor_read_key_value(
+	          (libesedb_internal_cursor_t *) cursor,
+	          key_value_index,
+	          NULL,
+	          0,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read key value: %d.",
+		 function,
+		 key_value_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the data of a specific key value of the current value
+ * The key value is decoded from the key without reading the record,
+ * the data is stored as in a record
+ * Returns 1 if successful, 0 if the key value cannot be decoded or -1 on error
+ */
+int libesedb_cursor_get_key_value_data(
+     libesedb_cursor_t *cursor,
+     int key_value_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_cursor_get_key_value_data";
+	size_t value_size     = 0;
+	int result            = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_cursor_read_key_value(
+	          (libesedb_internal_cursor_t *) cursor,
+	          key_value_index,
+	          data,
+	          data_size,
+	          &value_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read key value: %d.",
+		 function,
+		 key_value_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads the next or previous record that matches the filter
+ * If the record is not set a record is created, otherwise the record is reused
+ * Records that do not match the filter are read into the same record
+ * and skipped without creating their values
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_cursor_read_matching_record(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint8_t read_previous,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_cursor_read_matching_record";
+	uint8_t record_is_set = 0;
+	int result            = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	record_is_set = (uint8_t) ( *record != NULL );
+
+	do
+	{
+		if( read_previous == 0 )
+		{
+			result = libesedb_cursor_move_to_next(
+			          (libesedb_cursor_t *) internal_cursor,
+			          error );
+		}
+		else
+		{
+			result = libesedb_cursor_move_to_previous(
+			          (libesedb_cursor_t *) internal_cursor,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to move to %s value.",
+			 function,
+			 ( read_previous == 0 ) ? "next" : "previous" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libesedb_cursor_read_record(
+		     internal_cursor,
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_cursor->filter == NULL )
+		{
+			break;
+		}
+		result = libesedb_filter_match_record(
+		          internal_cursor->filter,
+		          (libesedb_internal_record_t *) *record,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if record matches filter.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( result == 0 );
+
+	if( result == 1 )
+	{
+		if( libesedb_cursor_unset_filter_values(
+		     internal_cursor,
+		     *record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to unset filter values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( result == 0 )
+	 && ( record_is_set == 0 )
+	 && ( *record != NULL ) )
+	{
+		/* A record created for a value that did not match the filter is not returned
+		 */
+		if( libesedb_record_free(
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( ( record_is_set == 0 )
+	 && ( *record != NULL ) )
+	{
+		libesedb_record_free(
+		 record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the next record
+ * Records that do not match the filter of the cursor are skipped
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_cursor_get_next_record(
+     libesedb_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_get_next_record";
+	int result                                  = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_cursor_read_matching_record(
+	          internal_cursor,
+	          0,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read next record.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the previous record
+ * Records that do not match the filter of the cursor are skipped
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_cursor_get_previous_record(
+     libesedb_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_get_previous_record";
+	int result                                  = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_cursor_read_matching_record(
+	          internal_cursor,
+	          1,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read previous record.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads the next record
+ * If the record is not set a record is created, otherwise the record is reused
+ * and its values are replaced by those of the next record
+ * A reused record must be retrieved from a cursor of the same table
+ * Records that do not match the filter of the cursor are skipped
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_cursor_read_next_record(
+     libesedb_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_read_next_record";
+	int result                                  = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_cursor_read_matching_record(
+	          internal_cursor,
+	          0,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read next record.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads the previous record
+ * If the record is not set a record is created, otherwise the record is reused
+ * and its values are replaced by those of the previous record
+ * A reused record must be retrieved from a cursor of the same table
+ * Records that do not match the filter of the cursor are skipped
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_cursor_read_previous_record(
+     libesedb_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_cursor_t *internal_cursor = NULL;
+	static char *function                       = "libesedb_cursor_read_previous_record";
+	int result                                  = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_cursor_t *) cursor;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_cursor_read_matching_record(
+	          internal_cursor,
+	          1,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read previous record.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
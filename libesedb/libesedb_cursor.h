@@ -0,0 +1,458 @@
+/*
+ * Cursor functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_INTERNAL_CURSOR_H )
+#define _LIBESEDB_INTERNAL_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_data_definition.h"
+#include "libesedb_extern.h"
+#include "libesedb_filter.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_key.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page.h"
+#include "libesedb_page_value.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_internal_cursor libesedb_internal_cursor_t;
+
+struct libesedb_internal_cursor
+{
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The IO handle
+	 */
+	libesedb_io_handle_t *io_handle;
+
+	/* The table definition
+	 */
+	libesedb_table_definition_t *table_definition;
+
+	/* The template table definition
+	 */
+	libesedb_table_definition_t *template_table_definition;
+
+	/* The pages vector
+	 * This is a reference to the pages vector of the file
+	 */
+	libfdata_vector_t *pages_vector;
+
+	/* The pages cache
+	 * This is a reference to the pages cache of the file
+	 */
+	libfcache_cache_t *pages_cache;
+
+	/* The long values tree
+	 * This is a reference to the long values tree of the table
+	 */
+	libfdata_btree_t *long_values_tree;
+
+	/* The long values cache
+	 * This is a reference to the long values cache of the table
+	 */
+	libfcache_cache_t *long_values_cache;
+
+	/* The root page number
+	 */
+	uint32_t root_page_number;
+
+	/* The current (leaf) page number
+	 * 0 represents the cursor is not positioned
+	 */
+	uint32_t current_page_number;
+
+	/* The current page value index
+	 * 0 represents before the first value of the current page
+	 * the number of page values represents after the last value of the current page
+	 */
+	uint16_t current_page_value_index;
+
+	/* Value to indicate the cursor is positioned on the current page value
+	 */
+	uint8_t current_value_is_set;
+
+	/* The data definition of the current record
+	 */
+	libesedb_data_definition_t *data_definition;
+
+	/* The key data
+	 * This buffer is used to compare the keys of the page values
+	 */
+	uint8_t *key_data;
+
+	/* The (allocated) key data size
+	 */
+	size_t key_data_size;
+
+	/* The table cursor
+	 * This cursor is used to read the records referenced by an index cursor
+	 */
+	libesedb_cursor_t *table_cursor;
+
+	/* The upper bound key
+	 */
+	libesedb_key_t *upper_bound_key;
+
+	/* Value to indicate the upper bound key is inclusive
+	 */
+	uint8_t upper_bound_is_inclusive;
+
+	/* The key column catalog definitions
+	 * These are references to the column catalog definitions of the table
+	 */
+	libesedb_catalog_definition_t **key_column_catalog_definitions;
+
+	/* The number of key columns
+	 */
+	int number_of_key_columns;
+
+	/* The column projection
+	 * This is a reference to the column projection of the table
+	 */
+	const uint8_t *column_projection;
+
+	/* The filter
+	 * Records that do not match the filter are skipped
+	 */
+	libesedb_filter_t *filter;
+
+	/* The filter column projection
+	 * This is the column projection of the table extended with the columns of the filter
+	 */
+	uint8_t *filter_column_projection;
+};
+
+int libesedb_cursor_initialize(
+     libesedb_cursor_t **cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     uint32_t root_page_number,
+     libfdata_btree_t *long_values_tree,
+     libfcache_cache_t *long_values_cache,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_free(
+     libesedb_cursor_t **cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_reset(
+     libesedb_cursor_t *cursor,
+     libcerror_error_t **error );
+
+int libesedb_cursor_get_page(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     uint16_t *number_of_page_values,
+     libcerror_error_t **error );
+
+int libesedb_cursor_get_value_key_size(
+     libesedb_page_t *page,
+     libesedb_page_value_t *page_value,
+     uint16_t *key_size,
+     libcerror_error_t **error );
+
+int libesedb_cursor_resize_key_data(
+     libesedb_internal_cursor_t *internal_cursor,
+     size_t key_data_size,
+     libcerror_error_t **error );
+
+int libesedb_cursor_get_value_key(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_page_t *page,
+     libesedb_page_value_t *page_value,
+     libesedb_key_t *key,
+     libcerror_error_t **error );
+
+int libesedb_cursor_get_leaf_page_number(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint8_t get_last,
+     uint32_t *leaf_page_number,
+     libcerror_error_t **error );
+
+int libesedb_cursor_set_data_definition(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libcerror_error_t **error );
+
+int libesedb_cursor_read_next_value(
+     libesedb_internal_cursor_t *internal_cursor,
+     libcerror_error_t **error );
+
+int libesedb_cursor_read_previous_value(
+     libesedb_internal_cursor_t *internal_cursor,
+     libcerror_error_t **error );
+
+int libesedb_cursor_seek_key(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_key_t *key,
+     uint8_t *is_exact_match,
+     libcerror_error_t **error );
+
+int libesedb_cursor_seek(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_key_t *key,
+     int match_mode,
+     libcerror_error_t **error );
+
+int libesedb_cursor_get_current_page_value(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_page_t **page,
+     libesedb_page_value_t **page_value,
+     libcerror_error_t **error );
+
+int libesedb_cursor_get_current_key(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_key_t *key,
+     libcerror_error_t **error );
+
+int libesedb_cursor_get_current_record_key(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint8_t **record_key_data,
+     size_t *record_key_data_size,
+     libcerror_error_t **error );
+
+int libesedb_cursor_compare_current_key(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_key_t *key,
+     libcerror_error_t **error );
+
+int libesedb_cursor_get_number_of_values(
+     libesedb_internal_cursor_t *internal_cursor,
+     int *number_of_values,
+     libcerror_error_t **error );
+
+int libesedb_cursor_get_read_column_projection(
+     libesedb_internal_cursor_t *internal_cursor,
+     const uint8_t **column_projection,
+     libcerror_error_t **error );
+
+int libesedb_cursor_unset_filter_values(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_record_t *record,
+     libcerror_error_t **error );
+
+int libesedb_cursor_read_record(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+int libesedb_cursor_set_key_columns(
+     libesedb_internal_cursor_t *internal_cursor,
+     libesedb_catalog_definition_t *index_catalog_definition,
+     libcerror_error_t **error );
+
+int libesedb_cursor_read_key_value(
+     libesedb_internal_cursor_t *internal_cursor,
+     int key_value_index,
+     uint8_t *value_data,
+     size_t value_data_size,
+     size_t *value_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_set_upper_bound(
+     libesedb_cursor_t *cursor,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint8_t is_inclusive,
+     libcerror_error_t **error );
+
+int libesedb_cursor_append_filter_predicate(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint8_t predicate_type,
+     uint32_t column_identifier,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     const uint8_t *upper_value_data,
+     size_t upper_value_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_append_filter_equal(
+     libesedb_cursor_t *cursor,
+     uint32_t column_identifier,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_append_filter_range(
+     libesedb_cursor_t *cursor,
+     uint32_t column_identifier,
+     const uint8_t *lower_value_data,
+     size_t lower_value_data_size,
+     const uint8_t *upper_value_data,
+     size_t upper_value_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_append_filter_is_null(
+     libesedb_cursor_t *cursor,
+     uint32_t column_identifier,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_append_filter_is_not_null(
+     libesedb_cursor_t *cursor,
+     uint32_t column_identifier,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_append_filter_prefix(
+     libesedb_cursor_t *cursor,
+     uint32_t column_identifier,
+     const uint8_t *prefix_data,
+     size_t prefix_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_clear_filter(
+     libesedb_cursor_t *cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_move_to_next(
+     libesedb_cursor_t *cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_move_to_previous(
+     libesedb_cursor_t *cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_get_record(
+     libesedb_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_get_key_size(
+     libesedb_cursor_t *cursor,
+     size_t *key_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_get_key(
+     libesedb_cursor_t *cursor,
+     uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_get_record_key_size(
+     libesedb_cursor_t *cursor,
+     size_t *record_key_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_get_record_key(
+     libesedb_cursor_t *cursor,
+     uint8_t *record_key,
+     size_t record_key_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_get_number_of_key_values(
+     libesedb_cursor_t *cursor,
+     int *number_of_key_values,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_get_key_value_column_identifier(
+     libesedb_cursor_t *cursor,
+     int key_value_index,
+     uint32_t *column_identifier,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_get_key_value_data_size(
+     libesedb_cursor_t *cursor,
+     int key_value_index,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_get_key_value_data(
+     libesedb_cursor_t *cursor,
+     int key_value_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libesedb_cursor_read_matching_record(
+     libesedb_internal_cursor_t *internal_cursor,
+     uint8_t read_previous,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_get_next_record(
+     libesedb_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_get_previous_record(
+     libesedb_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_read_next_record(
+     libesedb_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_cursor_read_previous_record(
+     libesedb_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_INTERNAL_CURSOR_H ) */
+
@@ -36,10 +36,8 @@
 #include "libesedb_libcnotify.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
-#include "libesedb_libfvalue.h"
 #include "libesedb_page.h"
-#include "libesedb_table_definition.h"
-#include "libesedb_value_data_handle.h"
+#include "libesedb_record_layout.h"
 
 #include "esedb_page_values.h"
 
@@ -300,8 +298,150 @@ int libesedb_data_definition_read_data(
 	return( 1 );
 }
 
+/* Retrieves the offset and size of the tagged data type of a specific column identifier
+ * The tagged data type offsets array is sorted by column identifier and is searched using a binary search
+ * The tagged data type offset contains the (unmasked) offset relative to the start of the tagged data types
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libesedb_data_definition_get_tagged_data_type(
+     const uint8_t *tagged_data_type_offsets_data,
+     uint16_t number_of_tagged_data_types,
+     uint16_t tagged_data_type_offset_bitmask,
+     size_t tagged_data_types_size,
+     uint16_t column_identifier,
+     uint16_t *tagged_data_type_offset,
+     uint16_t *tagged_data_type_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *tagged_data_type_offset_data = NULL;
+	static char *function                       = "libesedb_data_definition_get_tagged_data_type";
+	size_t tagged_data_type_value_end_offset    = 0;
+	size_t tagged_data_type_value_offset        = 0;
+	uint16_t lower_index                        = 0;
+	uint16_t middle_index                       = 0;
+	uint16_t tagged_data_type_identifier        = 0;
+	uint16_t upper_index                        = 0;
+	uint16_t value_16bit                        = 0;
+
+	if( tagged_data_type_offsets_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tagged data type offsets data.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_tagged_data_types * 4 > tagged_data_types_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of tagged data types value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( tagged_data_type_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tagged data type offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( tagged_data_type_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tagged data type size.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = number_of_tagged_data_types;
+
+	while( lower_index < upper_index )
+	{
+		middle_index                 = lower_index + ( ( upper_index - lower_index ) / 2 );
+		tagged_data_type_offset_data = &( tagged_data_type_offsets_data[ middle_index * 4 ] );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 tagged_data_type_offset_data,
+		 tagged_data_type_identifier );
+
+		if( tagged_data_type_identifier == column_identifier )
+		{
+			break;
+		}
+		if( tagged_data_type_identifier < column_identifier )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	if( lower_index >= upper_index )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( tagged_data_type_offset_data[ 2 ] ),
+	 *tagged_data_type_offset );
+
+	tagged_data_type_value_offset = (size_t) ( *tagged_data_type_offset & tagged_data_type_offset_bitmask );
+
+	/* The value ends at the start of the next tagged data type value or at the end of the tagged data types
+	 */
+	if( ( middle_index + 1 ) < number_of_tagged_data_types )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( tagged_data_type_offset_data[ 6 ] ),
+		 value_16bit );
+
+		tagged_data_type_value_end_offset = (size_t) ( value_16bit & tagged_data_type_offset_bitmask );
+	}
+	else
+	{
+		tagged_data_type_value_end_offset = tagged_data_types_size;
+	}
+	if( ( tagged_data_type_value_offset < ( (size_t) number_of_tagged_data_types * 4 ) )
+	 || ( tagged_data_type_value_offset > tagged_data_type_value_end_offset )
+	 || ( tagged_data_type_value_end_offset > tagged_data_types_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tagged data type: %" PRIu16 " offset value out of bounds.",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	*tagged_data_type_size = (uint16_t) ( tagged_data_type_value_end_offset - tagged_data_type_value_offset );
+
+	return( 1 );
+}
+
 /* Reads the record
  * Uses the definition data in the catalog definitions
+ * The column projection contains a value per column that indicates if the column value is read,
+ * data type values of columns that are not projected are not set
+ * The data type values must contain an entry per column of the record layout and reference
+ * the values data, which is a copy of the record data
+ * The values data buffer is reused and only reallocated if the record data does not fit,
+ * the values data size contains the allocated size of the buffer
  * Returns 1 if successful or -1 on error
  */
 int libesedb_data_definition_read_record(
@@ -310,30 +450,32 @@ int libesedb_data_definition_read_record(
      libesedb_io_handle_t *io_handle,
      libfdata_vector_t *pages_vector,
      libfcache_cache_t *pages_cache,
-     libesedb_table_definition_t *table_definition,
-     libesedb_table_definition_t *template_table_definition,
-     libcdata_array_t *values_array,
+     libesedb_record_layout_t *record_layout,
+     const uint8_t *column_projection,
+     libesedb_data_type_value_t *data_type_values,
+     uint8_t **values_data,
+     size_t *values_data_size,
      uint8_t *record_flags,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *column_catalog_definition_list_element = NULL;
 	libesedb_catalog_definition_t *column_catalog_definition        = NULL;
+	libesedb_data_type_value_t *data_type_value                     = NULL;
 	libesedb_page_t *page                                           = NULL;
+	libesedb_record_layout_column_t *record_layout_column           = NULL;
 	libesedb_page_value_t *page_value                               = NULL;
-	libfvalue_data_handle_t *value_data_handle                      = NULL;
-	libfvalue_value_t *record_value                                 = NULL;
 	uint8_t *record_data                                            = NULL;
 	uint8_t *tagged_data_type_offset_data                           = NULL;
+	void *reallocation                                              = NULL;
 	static char *function                                           = "libesedb_data_definition_read_record";
 	off64_t element_data_offset                                     = 0;
 	size_t record_data_size                                         = 0;
 	size_t remaining_definition_data_size                           = 0;
+	size_t tagged_data_types_size                                   = 0;
 	uint16_t data_offset                                            = 0;
 	uint16_t fixed_size_data_type_value_offset                      = 0;
-	uint16_t masked_previous_tagged_data_type_offset                = 0;
-	uint16_t masked_tagged_data_type_offset                         = 0;
-	uint16_t previous_tagged_data_type_offset                       = 0;
+	uint16_t number_of_tagged_data_types                            = 0;
 	uint16_t previous_variable_size_data_type_size                  = 0;
+	uint16_t variable_size_data_type_index                          = 0;
 	uint16_t tagged_data_type_offset_data_size                      = 0;
 	uint16_t tagged_data_type_identifier                            = 0;
 	uint16_t tagged_data_type_offset                                = 0;
@@ -344,19 +486,15 @@ int libesedb_data_definition_read_record(
 	uint16_t variable_size_data_type_offset                         = 0;
 	uint16_t variable_size_data_type_size                           = 0;
 	uint16_t variable_size_data_type_value_offset                   = 0;
+	uint16_t variable_size_data_type_values_offset                  = 0;
 	uint16_t variable_size_data_types_offset                        = 0;
-	uint8_t current_variable_size_data_type                         = 0;
+	uint8_t column_is_projected                                     = 1;
 	uint8_t last_fixed_size_data_type                               = 0;
 	uint8_t last_variable_size_data_type                            = 0;
 	uint8_t number_of_variable_size_data_types                      = 0;
-	uint8_t record_value_type                                       = 0;
 	uint8_t tagged_data_types_format                                = LIBESEDB_TAGGED_DATA_TYPES_FORMAT_INDEX;
 	int column_catalog_definition_index                             = 0;
-	int encoding                                                    = 0;
-	int number_of_column_catalog_definitions                        = 0;
-	int number_of_table_column_catalog_definitions                  = 0;
-	int number_of_template_table_column_catalog_definitions         = 0;
-	int record_value_codepage                                       = 0;
+	int number_of_projected_column_catalog_definitions              = 0;
 	int result                                                      = 0;
 
 	if( data_definition == NULL )
@@ -381,47 +519,59 @@ int libesedb_data_definition_read_record(
 
 		return( -1 );
 	}
-	if( table_definition == NULL )
+	if( record_layout == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table definition.",
+		 "%s: invalid record layout.",
 		 function );
 
 		return( -1 );
 	}
-	if( table_definition->column_catalog_definition_list == NULL )
+	if( ( record_layout->number_of_columns > 0 )
+	 && ( record_layout->columns == NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid table definition - missing column catalog definition list.",
+		 "%s: invalid record layout - missing columns.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( template_table_definition != NULL )
-	 && ( template_table_definition->column_catalog_definition_list == NULL ) )
+	if( ( record_layout->number_of_columns > 0 )
+	 && ( data_type_values == NULL ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid template table definition - missing column catalog definition list.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data type values.",
 		 function );
 
 		return( -1 );
 	}
-	if( values_array == NULL )
+	if( values_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid values array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values data.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values data size.",
 		 function );
 
 		return( -1 );
@@ -536,6 +686,46 @@ int libesedb_data_definition_read_record(
 
 		goto on_error;
 	}
+	/* The values reference a single copy of the record data instead of
+	 * a copy per value, the page data can be removed from the pages cache
+	 */
+	if( ( *values_data == NULL )
+	 || ( record_data_size > *values_data_size ) )
+	{
+		reallocation = memory_reallocate(
+		                *values_data,
+		                sizeof( uint8_t ) * record_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize values data.",
+			 function );
+
+			goto on_error;
+		}
+		*values_data      = (uint8_t *) reallocation;
+		*values_data_size = record_data_size;
+	}
+	if( memory_copy(
+	     *values_data,
+	     record_data,
+	     sizeof( uint8_t ) * record_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy record data.",
+		 function );
+
+		goto on_error;
+	}
+	record_data = *values_data;
+
 	if( ( io_handle->format_version == 0x620 )
 	 && ( io_handle->format_revision <= 2 ) )
 	{
@@ -572,155 +762,74 @@ int libesedb_data_definition_read_record(
 		 variable_size_data_types_offset );
 	}
 #endif
-	if( ( template_table_definition != NULL )
-	 && ( template_table_definition->column_catalog_definition_list != NULL ) )
+	if( record_layout->number_of_columns > 0 )
 	{
-		if( libcdata_list_get_number_of_elements(
-		     template_table_definition->column_catalog_definition_list,
-		     &number_of_template_table_column_catalog_definitions,
-		     error ) != 1 )
+		if( memory_set(
+		     data_type_values,
+		     0,
+		     sizeof( libesedb_data_type_value_t ) * record_layout->number_of_columns ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of template table column catalog definitions.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear data type values.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	if( libcdata_list_get_number_of_elements(
-	     table_definition->column_catalog_definition_list,
-	     &number_of_table_column_catalog_definitions,
-	     error ) != 1 )
+	if( last_variable_size_data_type > 127 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of table column catalog definitions.",
-		 function );
-
-		goto on_error;
+		number_of_variable_size_data_types = last_variable_size_data_type - 127;
 	}
-	number_of_column_catalog_definitions = number_of_table_column_catalog_definitions;
+	/* The columns after the last projected column do not need to be read
+	 */
+	number_of_projected_column_catalog_definitions = record_layout->number_of_columns;
 
-	if( ( template_table_definition != NULL )
-	 && ( template_table_definition->column_catalog_definition_list != NULL ) )
+	if( column_projection != NULL )
 	{
-		if( number_of_table_column_catalog_definitions > number_of_template_table_column_catalog_definitions )
+		while( number_of_projected_column_catalog_definitions > 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid number of table column catalog definitions value exceeds number in template table.",
-			 function );
-
-			goto on_error;
+			if( column_projection[ number_of_projected_column_catalog_definitions - 1 ] != 0 )
+			{
+				break;
+			}
+			number_of_projected_column_catalog_definitions--;
 		}
-		number_of_column_catalog_definitions += number_of_template_table_column_catalog_definitions;
 	}
-	if( libcdata_array_resize(
-	     values_array,
-	     number_of_column_catalog_definitions,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize values array.",
-		 function );
+	variable_size_data_type_values_offset = variable_size_data_types_offset + ( number_of_variable_size_data_types * 2 );
 
-		goto on_error;
-	}
-	if( last_variable_size_data_type > 127 )
-	{
-		number_of_variable_size_data_types = last_variable_size_data_type - 127;
-	}
-	if( ( template_table_definition != NULL )
-	 && ( template_table_definition->column_catalog_definition_list != NULL ) )
-	{
-		result = libcdata_list_get_first_element(
-		          template_table_definition->column_catalog_definition_list,
-		          &column_catalog_definition_list_element,
-		          error );
-	}
-	else
-	{
-		result = libcdata_list_get_first_element(
-		          table_definition->column_catalog_definition_list,
-		          &column_catalog_definition_list_element,
-		          error );
-	}
-	if( result != 1 )
+	if( ( number_of_variable_size_data_types > 0 )
+	 && ( (size_t) variable_size_data_type_values_offset > record_data_size ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first column catalog definition list element.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid variable size data types offset value out of bounds.",
 		 function );
 
 		goto on_error;
 	}
 	fixed_size_data_type_value_offset    = (uint16_t) sizeof( esedb_data_definition_header_t );
-	current_variable_size_data_type      = 127;
-	variable_size_data_type_offset       = variable_size_data_types_offset;
-	variable_size_data_type_value_offset = variable_size_data_types_offset + ( number_of_variable_size_data_types * 2 );
+	variable_size_data_type_value_offset = variable_size_data_type_values_offset;
 
 	for( column_catalog_definition_index = 0;
-	     column_catalog_definition_index < number_of_column_catalog_definitions;
+	     column_catalog_definition_index < number_of_projected_column_catalog_definitions;
 	     column_catalog_definition_index++ )
 	{
-		if( libcdata_list_element_get_value(
-		     column_catalog_definition_list_element,
-		     (intptr_t **) &column_catalog_definition,
-		     error ) != 1 )
+		if( column_projection != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column catalog definition from list element: %d.",
-			 function,
-			 column_catalog_definition_index );
-
-			goto on_error;
-		}
-		if( column_catalog_definition == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing column catalog definition: %d.",
-			 function,
-			 column_catalog_definition_index );
-
-			goto on_error;
+			column_is_projected = column_projection[ column_catalog_definition_index ];
 		}
-		if( column_catalog_definition->type != LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported column catalog definition type: %" PRIu16 " for list element: %d.",
-			 function,
-			 column_catalog_definition->type,
-			 column_catalog_definition_index );
+		record_layout_column      = &( record_layout->columns[ column_catalog_definition_index ] );
+		column_catalog_definition = record_layout_column->column_catalog_definition;
 
-			goto on_error;
-		}
-		if( ( template_table_definition != NULL )
-		 && ( template_table_definition->column_catalog_definition_list != NULL )
-		 && ( column_catalog_definition_index == number_of_template_table_column_catalog_definitions ) )
+		if( ( record_layout->number_of_template_table_columns > 0 )
+		 && ( column_catalog_definition_index == record_layout->number_of_template_table_columns ) )
 		{
-			if( column_catalog_definition->identifier != 256 )
+			if( record_layout_column->identifier != 256 )
 			{
 				libcerror_error_set(
 				 error,
@@ -752,128 +861,46 @@ int libesedb_data_definition_read_record(
 			  column_catalog_definition->column_type ) );
 		}
 #endif
-/* TODO refactor to value type */
-
-		switch( column_catalog_definition->column_type )
-		{
-			case LIBESEDB_COLUMN_TYPE_NULL:
-				/* JET_coltypNil seems to be able to contain data */
-				record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
-				record_value_type = LIBFVALUE_VALUE_TYPE_BOOLEAN;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_16BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_CURRENCY:
-			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_64BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FILETIME;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_GUID:
-				record_value_type = LIBFVALUE_VALUE_TYPE_GUID;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
-			case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
-				record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_TEXT:
-			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_SUPER_LARGE_VALUE:
-/* TODO handle this value type */
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNDEFINED;
-				break;
-
-			default:
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported column type: %" PRIu32 ".",
-				 function,
-				 column_catalog_definition->column_type );
-
-				goto on_error;
-		}
-		if( libfvalue_data_handle_initialize(
-		     &value_data_handle,
-		     (int (*)(libfvalue_data_handle_t *, const uint8_t *, size_t, int, uint32_t, libcerror_error_t **)) &libesedb_value_data_handle_read_value_entries,
-		     error ) != 1 )
+		if( record_layout_column->value_type == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create value data handle.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column type: %" PRIu32 ".",
+			 function,
+			 column_catalog_definition->column_type );
 
 			goto on_error;
 		}
-		if( ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
-		 || ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
-		{
-			record_value_codepage = (int) column_catalog_definition->codepage;
+		/* The value of a column that is not projected is skipped
+		 * and its data type value is not set
+		 */
+		data_type_value = NULL;
 
-			/* If the codepage is not set use the default codepage
-			 */
-			if( record_value_codepage == 0 )
-			{
-				record_value_codepage = io_handle->ascii_codepage;
-			}
-			/* Codepage 1200 in the ESE database format is not strict UTF-16 little endian
-			 * it can be used for ASCII strings as well. This could be SCSU.
-			 */
-			if( record_value_codepage == 1200 )
-			{
-				record_value_codepage = LIBFVALUE_CODEPAGE_1200_MIXED;
-			}
-			encoding = record_value_codepage;
-		}
-		else
+		if( column_is_projected != 0 )
 		{
-			encoding = LIBFVALUE_ENDIAN_LITTLE;
+			data_type_value = &( data_type_values[ column_catalog_definition_index ] );
+
+			data_type_value->is_set = 1;
 		}
-		if( column_catalog_definition->identifier <= 127 )
+		if( record_layout_column->data_type_class == LIBESEDB_DATA_TYPE_CLASS_FIXED_SIZE )
 		{
-			if( column_catalog_definition->identifier <= last_fixed_size_data_type )
+			if( record_layout_column->identifier <= last_fixed_size_data_type )
 			{
+				fixed_size_data_type_value_offset = record_layout_column->fixed_size_data_type_value_offset;
+
+				if( ( (size_t) fixed_size_data_type_value_offset + record_layout_column->fixed_size_data_type_size ) > record_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid fixed size data type value offset value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
 #if defined( HAVE_DEBUG_OUTPUT )
 				if( libcnotify_verbose != 0 )
 				{
@@ -888,117 +915,144 @@ int libesedb_data_definition_read_record(
 					 0 );
 				}
 #endif
-				if( libfvalue_data_handle_set_data(
-				     value_data_handle,
-				     &( record_data[ fixed_size_data_type_value_offset ] ),
-				     column_catalog_definition->size,
-				     encoding,
-				     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-				     error ) != 1 )
+				if( data_type_value != NULL )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set data in fixed size data type definition.",
-					 function );
-
-					goto on_error;
+					data_type_value->data_offset = fixed_size_data_type_value_offset;
+					data_type_value->data_size   = record_layout_column->fixed_size_data_type_size;
 				}
-				if( column_catalog_definition->size > (uint32_t) UINT16_MAX )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-					 "%s: invalid common catalog definition size value exceeds maximum.",
-					 function );
-
-					goto on_error;
-				}
-				fixed_size_data_type_value_offset += (uint16_t) column_catalog_definition->size;
+				fixed_size_data_type_value_offset += record_layout_column->fixed_size_data_type_size;
 			}
 		}
-		else if( current_variable_size_data_type < last_variable_size_data_type )
+		else if( record_layout_column->data_type_class == LIBESEDB_DATA_TYPE_CLASS_VARIABLE_SIZE )
 		{
-			while( current_variable_size_data_type < column_catalog_definition->identifier )
+			/* The variable size data type is addressed directly by its identifier
+			 */
+			if( record_layout_column->identifier <= last_variable_size_data_type )
 			{
+				variable_size_data_type_index  = (uint16_t) ( record_layout_column->identifier - 128 );
+				variable_size_data_type_offset = variable_size_data_types_offset + ( variable_size_data_type_index * 2 );
+
 				byte_stream_copy_to_uint16_little_endian(
 				 &( record_data[ variable_size_data_type_offset ] ),
 				 variable_size_data_type_size );
 
-				variable_size_data_type_offset += 2;
-
-				current_variable_size_data_type++;
-
 #if defined( HAVE_DEBUG_OUTPUT )
 				if( libcnotify_verbose != 0 )
 				{
 					libcnotify_printf(
-					 "%s: (%03" PRIu16 ") variable size data type size\t: 0x%04" PRIx16 " (%" PRIu16 ")\n",
+					 "%s: (%03" PRIu32 ") variable size data type size\t: 0x%04" PRIx16 "\n",
 					 function,
-					 current_variable_size_data_type,
-					 variable_size_data_type_size,
-					 ( ( variable_size_data_type_size & 0x8000 ) != 0 ) ? 0 : ( variable_size_data_type_size & 0x7fff ) - previous_variable_size_data_type_size );
+					 record_layout_column->identifier,
+					 variable_size_data_type_size );
 				}
 #endif
-				if( current_variable_size_data_type == column_catalog_definition->identifier )
+				/* The MSB signifies that the variable size data type is empty
+				 */
+				if( ( variable_size_data_type_size & 0x8000 ) == 0 )
 				{
-					/* The MSB signifies that the variable size data type is empty
+					/* The variable size data type sizes are cumulative, the value starts
+					 * after the value of the previous non-empty variable size data type
 					 */
-					if( ( variable_size_data_type_size & 0x8000 ) == 0 )
+					previous_variable_size_data_type_size = 0;
+
+					while( variable_size_data_type_index > 0 )
 					{
-#if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
+						variable_size_data_type_index  -= 1;
+						variable_size_data_type_offset -= 2;
+
+						byte_stream_copy_to_uint16_little_endian(
+						 &( record_data[ variable_size_data_type_offset ] ),
+						 previous_variable_size_data_type_size );
+
+						if( ( previous_variable_size_data_type_size & 0x8000 ) == 0 )
 						{
-							libcnotify_printf(
-							 "%s: (%03" PRIu32 ") variable size data type:\n",
-							 function,
-							 column_catalog_definition->identifier );
-							libcnotify_print_data(
-							 &( record_data[ variable_size_data_type_value_offset ] ),
-							 variable_size_data_type_size - previous_variable_size_data_type_size,
-							 0 );
+							break;
 						}
-#endif
-						if( libfvalue_data_handle_set_data(
-						     value_data_handle,
-						     &( record_data[ variable_size_data_type_value_offset ] ),
-						     variable_size_data_type_size - previous_variable_size_data_type_size,
-						     encoding,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in variable size data type definition.",
-							 function );
+						previous_variable_size_data_type_size = 0;
+					}
+					variable_size_data_type_value_offset = variable_size_data_type_values_offset + previous_variable_size_data_type_size;
 
-							goto on_error;
-						}
-						variable_size_data_type_value_offset += variable_size_data_type_size - previous_variable_size_data_type_size;
-						previous_variable_size_data_type_size = variable_size_data_type_size;
+					if( ( previous_variable_size_data_type_size > variable_size_data_type_size )
+					 || ( ( (size_t) variable_size_data_type_values_offset + variable_size_data_type_size ) > record_data_size ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid variable size data type size value out of bounds.",
+						 function );
+
+						goto on_error;
 					}
 #if defined( HAVE_DEBUG_OUTPUT )
-					else if( libcnotify_verbose != 0 )
+					if( libcnotify_verbose != 0 )
 					{
 						libcnotify_printf(
-						 "%s: (%03" PRIu32 ") variable size data type\t\t: <NULL>\n",
+						 "%s: (%03" PRIu32 ") variable size data type:\n",
 						 function,
-						 column_catalog_definition->identifier );
+						 record_layout_column->identifier );
+						libcnotify_print_data(
+						 &( record_data[ variable_size_data_type_value_offset ] ),
+						 variable_size_data_type_size - previous_variable_size_data_type_size,
+						 0 );
 					}
 #endif
+					if( data_type_value != NULL )
+					{
+						data_type_value->data_offset = variable_size_data_type_value_offset;
+						data_type_value->data_size   = variable_size_data_type_size - previous_variable_size_data_type_size;
+					}
 				}
-				if( current_variable_size_data_type >= last_variable_size_data_type )
+#if defined( HAVE_DEBUG_OUTPUT )
+				else if( libcnotify_verbose != 0 )
 				{
-					break;
+					libcnotify_printf(
+					 "%s: (%03" PRIu32 ") variable size data type\t\t: <NULL>\n",
+					 function,
+					 record_layout_column->identifier );
 				}
+#endif
 			}
 		}
 		else
 		{
+			if( tagged_data_types_offset == 0 )
+			{
+				/* The tagged data types are stored after the value of the last
+				 * non-empty variable size data type
+				 */
+				variable_size_data_type_index        = number_of_variable_size_data_types;
+				variable_size_data_type_offset       = variable_size_data_type_values_offset;
+				variable_size_data_type_value_offset = variable_size_data_type_values_offset;
+
+				while( variable_size_data_type_index > 0 )
+				{
+					variable_size_data_type_index  -= 1;
+					variable_size_data_type_offset -= 2;
+
+					byte_stream_copy_to_uint16_little_endian(
+					 &( record_data[ variable_size_data_type_offset ] ),
+					 variable_size_data_type_size );
+
+					if( ( variable_size_data_type_size & 0x8000 ) == 0 )
+					{
+						variable_size_data_type_value_offset += variable_size_data_type_size;
+
+						break;
+					}
+				}
+				if( (size_t) variable_size_data_type_value_offset > record_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid tagged data types offset value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+			}
 			if( tagged_data_types_format == LIBESEDB_TAGGED_DATA_TYPES_FORMAT_LINEAR )
 			{
 				if( tagged_data_types_offset == 0 )
@@ -1067,19 +1121,9 @@ int libesedb_data_definition_read_record(
 							 "\n" );
 						}
 #endif
-						if( libfvalue_data_handle_set_data_flags(
-						     value_data_handle,
-						     (uint32_t) record_data[ tagged_data_type_value_offset ],
-						     error ) != 1 )
+						if( data_type_value != NULL )
 						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set tagged data type flags in tagged data type definition.",
-							 function );
-
-							goto on_error;
+							data_type_value->data_flags = record_data[ tagged_data_type_value_offset ];
 						}
 						tagged_data_type_value_offset  += 1;
 						tagged_data_type_size           = ( tagged_data_type_size & 0x5fff ) - 1;
@@ -1141,22 +1185,10 @@ int libesedb_data_definition_read_record(
 
 							goto on_error;
 						}
-						if( libfvalue_data_handle_set_data(
-						     value_data_handle,
-						     &( record_data[ tagged_data_type_value_offset ] ),
-						     tagged_data_type_size,
-						     encoding,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
+						if( data_type_value != NULL )
 						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in tagged data type definition.",
-							 function );
-
-							goto on_error;
+							data_type_value->data_offset = tagged_data_type_value_offset;
+							data_type_value->data_size   = tagged_data_type_size;
 						}
 						remaining_definition_data_size -= tagged_data_type_size;
 					}
@@ -1193,25 +1225,34 @@ int libesedb_data_definition_read_record(
 			{
 				if( tagged_data_types_offset == 0 )
 				{
-					tagged_data_types_offset       = variable_size_data_type_value_offset;
-					tagged_data_type_offset_data   = &( record_data[ tagged_data_types_offset ] );
-					remaining_definition_data_size = record_data_size - (size_t) tagged_data_types_offset;
+					tagged_data_types_offset = variable_size_data_type_value_offset;
+					tagged_data_types_size   = record_data_size - (size_t) tagged_data_types_offset;
 
-					if( remaining_definition_data_size > 0 )
+					if( tagged_data_types_size > 0 )
 					{
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_identifier );
+						if( tagged_data_types_size < 4 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid tagged data types size value out of bounds.",
+							 function );
 
-						tagged_data_type_offset_data += 2;
+							goto on_error;
+						}
+						tagged_data_type_offset_data = &( record_data[ tagged_data_types_offset ] );
 
+						/* The offset of the first tagged data type value is the size of the offsets array
+						 */
 						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
+						 &( tagged_data_type_offset_data[ 2 ] ),
 						 tagged_data_type_offset );
 
-						tagged_data_type_offset_data += 2;
+						tagged_data_type_offset_data_size = tagged_data_type_offset & tagged_data_type_offset_bitmask;
 
-						if( tagged_data_type_offset == 0 )
+						if( ( tagged_data_type_offset_data_size < 4 )
+						 || ( (size_t) tagged_data_type_offset_data_size > tagged_data_types_size ) )
 						{
 							libcerror_error_set(
 							 error,
@@ -1222,9 +1263,7 @@ int libesedb_data_definition_read_record(
 
 							goto on_error;
 						}
-						tagged_data_type_offset_data_size = ( tagged_data_type_offset & 0x3fff ) - 4;
-
-						remaining_definition_data_size -= 4;
+						number_of_tagged_data_types = tagged_data_type_offset_data_size / 4;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 						if( libcnotify_verbose != 0 )
@@ -1238,143 +1277,94 @@ int libesedb_data_definition_read_record(
 							 function );
 							libcnotify_print_data(
 							 tagged_data_type_offset_data,
-							 tagged_data_type_offset_data_size + 4,
+							 tagged_data_type_offset_data_size,
 							 0 );
 						}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 					}
 				}
-				if( ( remaining_definition_data_size > 0 )
-				 && ( column_catalog_definition->identifier == tagged_data_type_identifier ) )
+				/* The tagged data type of a column that is not projected is not looked up
+				 */
+				if( ( data_type_value != NULL )
+				 && ( number_of_tagged_data_types > 0 ) )
 				{
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: (%03" PRIu16 ") tagged data type identifier\t\t: %" PRIu16 "\n",
-						 function,
-						 column_catalog_definition->identifier,
-						 tagged_data_type_identifier );
-
-						libcnotify_printf(
-						 "%s: (%03" PRIu16 ") tagged data type offset\t\t: 0x%04" PRIx16 " (%" PRIu16 ")\n",
-						 function,
-						 column_catalog_definition->identifier,
-						 tagged_data_type_offset,
-						 tagged_data_type_offset & tagged_data_type_offset_bitmask );
-					}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-					previous_tagged_data_type_offset = tagged_data_type_offset;
-
-					if( tagged_data_type_offset_data_size > 0 )
-					{
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_identifier );
-
-						tagged_data_type_offset_data += 2;
-
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_offset );
-
-						tagged_data_type_offset_data += 2;
-
-						tagged_data_type_offset_data_size -= 4;
-						remaining_definition_data_size    -= 4;
-					}
-					masked_previous_tagged_data_type_offset = previous_tagged_data_type_offset & tagged_data_type_offset_bitmask;
-					masked_tagged_data_type_offset          = tagged_data_type_offset & tagged_data_type_offset_bitmask;
-
-					if( masked_previous_tagged_data_type_offset > masked_tagged_data_type_offset )
+					result = libesedb_data_definition_get_tagged_data_type(
+					          tagged_data_type_offset_data,
+					          number_of_tagged_data_types,
+					          tagged_data_type_offset_bitmask,
+					          tagged_data_types_size,
+					          (uint16_t) record_layout_column->identifier,
+					          &tagged_data_type_offset,
+					          &tagged_data_type_size,
+					          error );
+
+					if( result == -1 )
 					{
 						libcerror_error_set(
 						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid tagged data type offset value exceeds next tagged data type offset.",
-						 function );
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve tagged data type: %" PRIu32 ".",
+						 function,
+						 record_layout_column->identifier );
 
 						goto on_error;
 					}
-					if( masked_tagged_data_type_offset > masked_previous_tagged_data_type_offset )
-					{
-						tagged_data_type_size = masked_tagged_data_type_offset - masked_previous_tagged_data_type_offset;
-					}
-					else
+					else if( result != 0 )
 					{
-						tagged_data_type_size = (uint16_t) remaining_definition_data_size;
-					}
 #if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: (%03" PRIu16 ") tagged data type size\t\t: %" PRIu16 "\n",
-						 function,
-						 column_catalog_definition->identifier,
-						 tagged_data_type_size );
-					}
-#endif
-					tagged_data_type_value_offset = tagged_data_types_offset + masked_previous_tagged_data_type_offset;
-
-					if( tagged_data_type_size > 0 )
-					{
-						if( tagged_data_type_size > remaining_definition_data_size )
+						if( libcnotify_verbose != 0 )
 						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data type size value exceeds remaining data size.",
-							 function );
-
-							goto on_error;
+							libcnotify_printf(
+							 "%s: (%03" PRIu32 ") tagged data type offset\t\t: 0x%04" PRIx16 " (%" PRIu16 ")\n",
+							 function,
+							 record_layout_column->identifier,
+							 tagged_data_type_offset,
+							 tagged_data_type_offset & tagged_data_type_offset_bitmask );
+							libcnotify_printf(
+							 "%s: (%03" PRIu32 ") tagged data type size\t\t: %" PRIu16 "\n",
+							 function,
+							 record_layout_column->identifier,
+							 tagged_data_type_size );
 						}
-						remaining_definition_data_size -= tagged_data_type_size;
+#endif
+						tagged_data_type_value_offset = tagged_data_types_offset + ( tagged_data_type_offset & tagged_data_type_offset_bitmask );
 
-						if( ( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-						  &&  ( io_handle->page_size >= 16384 ) )
-						 || ( ( previous_tagged_data_type_offset & 0x4000 ) != 0 ) )
+						if( tagged_data_type_size > 0 )
 						{
-							if( tagged_data_type_value_offset >= record_data_size )
+							if( ( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+							  &&  ( io_handle->page_size >= 16384 ) )
+							 || ( ( tagged_data_type_offset & 0x4000 ) != 0 ) )
 							{
-								libcerror_error_set(
-								 error,
-								 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-								 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-								 "%s: invalid tagged data type offset value out of bounds.",
-								 function );
-
-								goto on_error;
-							}
-							if( libfvalue_data_handle_set_data_flags(
-							     value_data_handle,
-							     (uint32_t) record_data[ tagged_data_type_value_offset ],
-							     error ) != 1 )
-							{
-								libcerror_error_set(
-								 error,
-								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-								 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-								 "%s: unable to set tagged data type flags in tagged data type definition.",
-								 function );
-
-								goto on_error;
+#if defined( HAVE_DEBUG_OUTPUT )
+								if( libcnotify_verbose != 0 )
+								{
+									libcnotify_printf(
+									 "%s: (%03" PRIu32 ") tagged data type flags\t\t: 0x%02" PRIx8 "\n",
+									 function,
+									 record_layout_column->identifier,
+									 record_data[ tagged_data_type_value_offset ] );
+									libesedb_debug_print_tagged_data_type_flags(
+									 record_data[ tagged_data_type_value_offset ] );
+									libcnotify_printf(
+									 "\n" );
+								}
+#endif
+								data_type_value->data_flags = record_data[ tagged_data_type_value_offset ];
+
+								tagged_data_type_value_offset += 1;
+								tagged_data_type_size         -= 1;
 							}
-							tagged_data_type_value_offset += 1;
-							tagged_data_type_size         -= 1;
 						}
 #if defined( HAVE_DEBUG_OUTPUT )
 						if( libcnotify_verbose != 0 )
 						{
-							libcnotify_printf(
-							 "%s: (%03" PRIu16 ") tagged data type:\n",
-							 function,
-							 column_catalog_definition->identifier );
-
-							if( tagged_data_type_value_offset < record_data_size )
+							if( tagged_data_type_size > 0 )
 							{
+								libcnotify_printf(
+								 "%s: (%03" PRIu32 ") tagged data type:\n",
+								 function,
+								 record_layout_column->identifier );
 								libcnotify_print_data(
 								 &( record_data[ tagged_data_type_value_offset ] ),
 								 tagged_data_type_size,
@@ -1383,125 +1373,21 @@ int libesedb_data_definition_read_record(
 							else
 							{
 								libcnotify_printf(
-								 "<NULL>\n\n" );
+								 "%s: (%03" PRIu32 ") tagged data type\t\t\t: <NULL>\n",
+								 function,
+								 record_layout_column->identifier );
 							}
 						}
 #endif
-					}
-#if defined( HAVE_DEBUG_OUTPUT )
-					/* TODO are zero size tagged data type values handled correctly?
-					 */
-					else if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: (%03" PRIu32 ") tagged data type\t\t\t: <NULL>\n",
-						 function,
-						 column_catalog_definition->identifier );
-					}
-#endif
-					if( tagged_data_type_size > 0 )
-					{
-						if( tagged_data_type_value_offset >= record_data_size )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data type offset value out of bounds.",
-							 function );
-
-							goto on_error;
-						}
-						if( libfvalue_data_handle_set_data(
-						     value_data_handle,
-						     &( record_data[ tagged_data_type_value_offset ] ),
-						     tagged_data_type_size,
-						     encoding,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
+						if( tagged_data_type_size > 0 )
 						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in tagged data type definition.",
-							 function );
-
-							goto on_error;
+							data_type_value->data_offset = tagged_data_type_value_offset;
+							data_type_value->data_size   = tagged_data_type_size;
 						}
 					}
 				}
 			}
 		}
-		if( libfvalue_value_type_initialize_with_data_handle(
-		     &record_value,
-		     record_value_type,
-		     value_data_handle,
-		     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create record value.",
-			 function );
-
-			goto on_error;
-		}
-		value_data_handle = NULL;
-
-		if( libcdata_array_set_entry_by_index(
-		     values_array,
-		     column_catalog_definition_index,
-		     (intptr_t *) record_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to set data type definition: %d.",
-			 function,
-			 column_catalog_definition_index );
-
-			goto on_error;
-		}
-		record_value = NULL;
-
-		if( libcdata_list_element_get_next_element(
-		     column_catalog_definition_list_element,
-		     &column_catalog_definition_list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next column catalog definition list element.",
-			 function );
-
-			goto on_error;
-		}
-		if( ( column_catalog_definition_list_element == NULL )
-		 && ( template_table_definition != NULL )
-		 && ( template_table_definition->column_catalog_definition_list != NULL ) )
-		{
-			if( libcdata_list_get_first_element(
-			     table_definition->column_catalog_definition_list,
-			     &column_catalog_definition_list_element,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve first column catalog definition list element.",
-				 function );
-
-				goto on_error;
-			}
-		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -1523,18 +1409,6 @@ int libesedb_data_definition_read_record(
 	return( 1 );
 
 on_error:
-	if( record_value != NULL )
-	{
-		libfvalue_value_free(
-		 &record_value,
-		 NULL );
-	}
-	if( value_data_handle != NULL )
-	{
-		libfvalue_data_handle_free(
-		 &value_data_handle,
-		 NULL );
-	}
 	return( -1 );
 }
 
@@ -31,7 +31,7 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
-#include "libesedb_table_definition.h"
+#include "libesedb_record_layout.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -62,6 +62,27 @@ struct libesedb_data_definition
 	uint16_t data_size;
 };
 
+typedef struct libesedb_data_type_value libesedb_data_type_value_t;
+
+struct libesedb_data_type_value
+{
+	/* The value data offset relative to the start of the record data
+	 */
+	uint16_t data_offset;
+
+	/* The value data size
+	 */
+	uint16_t data_size;
+
+	/* The value data flags
+	 */
+	uint8_t data_flags;
+
+	/* Value to indicate the value is set
+	 */
+	uint8_t is_set;
+};
+
 int libesedb_data_definition_initialize(
      libesedb_data_definition_t **data_definition,
      libcerror_error_t **error );
@@ -80,15 +101,27 @@ int libesedb_data_definition_read_data(
      size_t *data_size,
      libcerror_error_t **error );
 
+int libesedb_data_definition_get_tagged_data_type(
+     const uint8_t *tagged_data_type_offsets_data,
+     uint16_t number_of_tagged_data_types,
+     uint16_t tagged_data_type_offset_bitmask,
+     size_t tagged_data_types_size,
+     uint16_t column_identifier,
+     uint16_t *tagged_data_type_offset,
+     uint16_t *tagged_data_type_size,
+     libcerror_error_t **error );
+
 int libesedb_data_definition_read_record(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
      libfdata_vector_t *pages_vector,
      libfcache_cache_t *pages_cache,
-     libesedb_table_definition_t *table_definition,
-     libesedb_table_definition_t *template_table_definition,
-     libcdata_array_t *values_array,
+     libesedb_record_layout_t *record_layout,
+     const uint8_t *column_projection,
+     libesedb_data_type_value_t *data_type_values,
+     uint8_t **values_data,
+     size_t *values_data_size,
      uint8_t *record_flags,
      libcerror_error_t **error );
 
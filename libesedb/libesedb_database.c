@@ -169,6 +169,17 @@ int libesedb_database_read(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_page_tree_initialize(
 	     &database_page_tree,
 	     io_handle,
@@ -213,7 +224,7 @@ int libesedb_database_read(
 
 	if( libfcache_cache_initialize(
 	     &database_values_cache,
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_TREE_VALUES,
+	     io_handle->maximum_cache_entries[ LIBESEDB_CACHE_TYPE_TREE_VALUES ],
 	     error ) != 1 )
 	{
 		libcerror_error_set(
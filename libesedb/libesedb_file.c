@@ -26,6 +26,7 @@
 #include <wide_string.h>
 
 #include "libesedb_catalog.h"
+#include "libesedb_checksum.h"
 #include "libesedb_database.h"
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
@@ -265,6 +266,7 @@ int libesedb_file_open(
 	libesedb_internal_file_t *internal_file = NULL;
 	static char *function                   = "libesedb_file_open";
 	size_t filename_length                  = 0;
+	int file_is_mapped                      = 0;
 
 	if( file == NULL )
 	{
@@ -360,10 +362,32 @@ int libesedb_file_open(
 
 		goto on_error;
 	}
+	if( ( access_flags & LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		if( libesedb_io_handle_map_file(
+		     internal_file->io_handle,
+		     filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		file_is_mapped = 1;
+	}
+	/* The memory mapping is managed by the IO handle, hence the file IO handle
+	 * is opened without memory mapped access
+	 */
 	if( libesedb_file_open_file_io_handle(
 	     file,
 	     file_io_handle,
-	     access_flags,
+	     access_flags & ~( LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -381,6 +405,12 @@ int libesedb_file_open(
 	return( 1 );
 
 on_error:
+	if( file_is_mapped != 0 )
+	{
+		libesedb_io_handle_unmap_file(
+		 internal_file->io_handle,
+		 NULL );
+	}
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
@@ -453,6 +483,17 @@ int libesedb_file_open_wide(
 
 		return( -1 );
 	}
+	if( ( access_flags & LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory mapped access currently not supported for wide character filenames.",
+		 function );
+
+		return( -1 );
+	}
 	if( libbfio_file_initialize(
 	     &file_io_handle,
 	     error ) != 1 )
@@ -591,12 +632,31 @@ int libesedb_file_open_file_io_handle(
 
 		return( -1 );
 	}
+	if( ( access_flags & LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory mapped access currently not supported for file IO handles.",
+		 function );
+
+		return( -1 );
+	}
 	internal_file = (libesedb_internal_file_t *) file;
 
 	if( ( access_flags & LIBESEDB_ACCESS_FLAG_READ ) != 0 )
 	{
 		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
 	}
+	if( ( access_flags & LIBESEDB_ACCESS_FLAG_VERIFY_CHECKSUMS ) != 0 )
+	{
+		internal_file->io_handle->verify_checksums = 1;
+	}
+	else
+	{
+		internal_file->io_handle->verify_checksums = 0;
+	}
 	file_io_handle_is_open = libbfio_handle_is_open(
 	                          file_io_handle,
 	                          error );
@@ -846,6 +906,7 @@ int libesedb_file_open_read(
 	static char *function               = "libesedb_file_open_read";
 	size64_t file_size                  = 0;
 	off64_t file_offset                 = 0;
+	int instruction_set                 = 0;
 	int result                          = 0;
 	int segment_index                   = 0;
 
@@ -928,6 +989,22 @@ int libesedb_file_open_read(
 	}
 	internal_file->io_handle->abort = 0;
 
+	/* Determine the checksum instruction set before any page is verified
+	 * so that libesedb_file_verify_page_data can be called concurrently
+	 */
+	if( libesedb_checksum_get_instruction_set(
+	     &instruction_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checksum instruction set.",
+		 function );
+
+		goto on_error;
+	}
 	if( libbfio_handle_get_size(
 	     file_io_handle,
 	     &file_size,
@@ -1257,7 +1334,7 @@ int libesedb_file_open_read(
 	}
 	if( libfcache_cache_initialize(
 	     &( internal_file->pages_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	     internal_file->io_handle->maximum_cache_entries[ LIBESEDB_CACHE_TYPE_PAGES ],
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1662,6 +1739,242 @@ int libesedb_file_get_page_size(
 	return( 1 );
 }
 
+/* Retrieves the number of pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_number_of_pages(
+     libesedb_file_t *file,
+     uint32_t *number_of_pages,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_number_of_pages";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of pages.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_pages = internal_file->io_handle->last_page_number;
+
+	return( 1 );
+}
+
+/* Verifies the data of a page
+ * The page data must be page size bytes read from the page offset: ( page_number + 1 ) * page_size
+ * This function does not access the file and can be called concurrently from multiple threads
+ * once the file has been opened
+ * Returns 1 if the page is valid, 0 if the page is corrupt or -1 on error
+ */
+int libesedb_file_verify_page_data(
+     libesedb_file_t *file,
+     uint32_t page_number,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t *father_data_page_object_identifier,
+     uint32_t *corruption_flags,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_verify_page_data";
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( page_number > internal_file->io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_verify_data(
+	          internal_file->io_handle,
+	          page_number,
+	          page_data,
+	          page_data_size,
+	          father_data_page_object_identifier,
+	          corruption_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify page: %" PRIu32 " data.",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the maximum number of cache entries of a specific cache type
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_maximum_cache_entries(
+     libesedb_file_t *file,
+     int cache_type,
+     int *maximum_cache_entries,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_maximum_cache_entries";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( libesedb_io_handle_get_maximum_cache_entries(
+	     internal_file->io_handle,
+	     cache_type,
+	     maximum_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum cache entries from IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the maximum number of cache entries of a specific cache type
+ * If the file is open the pages cache of the file is resized, other caches use the new
+ * size when they are created
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_maximum_cache_entries(
+     libesedb_file_t *file,
+     int cache_type,
+     int maximum_cache_entries,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_maximum_cache_entries";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( libesedb_io_handle_set_maximum_cache_entries(
+	     internal_file->io_handle,
+	     cache_type,
+	     maximum_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum cache entries in IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_type == LIBESEDB_CACHE_TYPE_PAGES )
+	 && ( internal_file->pages_cache != NULL ) )
+	{
+		if( libfcache_cache_resize(
+		     internal_file->pages_cache,
+		     internal_file->io_handle->maximum_cache_entries[ LIBESEDB_CACHE_TYPE_PAGES ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize pages cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of tables
  * Returns 1 if successful or -1 on error
  */
@@ -1833,6 +2146,8 @@ int libesedb_file_get_table(
 	     internal_file->io_handle,
 	     table_definition,
 	     template_table_definition,
+	     internal_file->pages_vector,
+	     internal_file->pages_cache,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1965,6 +2280,8 @@ int libesedb_file_get_table_by_utf8_name(
 		     internal_file->io_handle,
 		     table_definition,
 		     template_table_definition,
+		     internal_file->pages_vector,
+		     internal_file->pages_cache,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -2098,6 +2415,8 @@ int libesedb_file_get_table_by_utf16_name(
 		     internal_file->io_handle,
 		     table_definition,
 		     template_table_definition,
+		     internal_file->pages_vector,
+		     internal_file->pages_cache,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -155,6 +155,36 @@ int libesedb_file_get_page_size(
      uint32_t *page_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_file_get_number_of_pages(
+     libesedb_file_t *file,
+     uint32_t *number_of_pages,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_verify_page_data(
+     libesedb_file_t *file,
+     uint32_t page_number,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t *father_data_page_object_identifier,
+     uint32_t *corruption_flags,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_maximum_cache_entries(
+     libesedb_file_t *file,
+     int cache_type,
+     int *maximum_cache_entries,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_maximum_cache_entries(
+     libesedb_file_t *file,
+     int cache_type,
+     int maximum_cache_entries,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_number_of_tables(
      libesedb_file_t *file,
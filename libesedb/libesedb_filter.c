@@ -0,0 +1,1140 @@
+/*
+ * Filter functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_filter.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_long_value.h"
+#include "libesedb_record.h"
+#include "libesedb_types.h"
+
+/* Creates a filter
+ * Make sure the value filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_initialize(
+     libesedb_filter_t **filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_filter_initialize";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*filter = memory_allocate_structure(
+	           libesedb_filter_t );
+
+	if( *filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *filter,
+	     0,
+	     sizeof( libesedb_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear filter.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *filter != NULL )
+	{
+		memory_free(
+		 *filter );
+
+		*filter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a filter
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_free(
+     libesedb_filter_t **filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_filter_free";
+	int predicate_index   = 0;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		if( ( *filter )->predicates != NULL )
+		{
+			for( predicate_index = 0;
+			     predicate_index < ( *filter )->number_of_predicates;
+			     predicate_index++ )
+			{
+				if( ( *filter )->predicates[ predicate_index ].value_data != NULL )
+				{
+					memory_free(
+					 ( *filter )->predicates[ predicate_index ].value_data );
+				}
+				if( ( *filter )->predicates[ predicate_index ].upper_value_data != NULL )
+				{
+					memory_free(
+					 ( *filter )->predicates[ predicate_index ].upper_value_data );
+				}
+			}
+			memory_free(
+			 ( *filter )->predicates );
+		}
+		if( ( *filter )->data != NULL )
+		{
+			memory_free(
+			 ( *filter )->data );
+		}
+		memory_free(
+		 *filter );
+
+		*filter = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a predicate
+ * The value data is copied, for a range predicate the value data contains the lower bound
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_append_predicate(
+     libesedb_filter_t *filter,
+     uint8_t predicate_type,
+     int column_index,
+     uint32_t column_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     const uint8_t *upper_value_data,
+     size_t upper_value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_filter_predicate_t *predicate = NULL;
+	void *reallocation                     = NULL;
+	static char *function                  = "libesedb_filter_append_predicate";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( predicate_type != LIBESEDB_FILTER_PREDICATE_TYPE_EQUAL )
+	 && ( predicate_type != LIBESEDB_FILTER_PREDICATE_TYPE_RANGE )
+	 && ( predicate_type != LIBESEDB_FILTER_PREDICATE_TYPE_IS_NULL )
+	 && ( predicate_type != LIBESEDB_FILTER_PREDICATE_TYPE_IS_NOT_NULL )
+	 && ( predicate_type != LIBESEDB_FILTER_PREDICATE_TYPE_PREFIX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported predicate type.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid column index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( predicate_type == LIBESEDB_FILTER_PREDICATE_TYPE_IS_NULL )
+	 || ( predicate_type == LIBESEDB_FILTER_PREDICATE_TYPE_IS_NOT_NULL ) )
+	{
+		value_data            = NULL;
+		value_data_size       = 0;
+		upper_value_data      = NULL;
+		upper_value_data_size = 0;
+	}
+	else if( predicate_type == LIBESEDB_FILTER_PREDICATE_TYPE_RANGE )
+	{
+		if( ( value_data == NULL )
+		 && ( upper_value_data == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid range - missing lower and upper bound value data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( value_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid value data.",
+			 function );
+
+			return( -1 );
+		}
+		upper_value_data      = NULL;
+		upper_value_data_size = 0;
+	}
+	if( ( value_data != NULL )
+	 && ( ( value_data_size == 0 )
+	  ||  ( value_data_size > (size_t) SSIZE_MAX ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( upper_value_data != NULL )
+	 && ( ( upper_value_data_size == 0 )
+	  ||  ( upper_value_data_size > (size_t) SSIZE_MAX ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid upper bound value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = memory_reallocate(
+	                filter->predicates,
+	                sizeof( libesedb_filter_predicate_t ) * ( filter->number_of_predicates + 1 ) );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize predicates.",
+		 function );
+
+		return( -1 );
+	}
+	filter->predicates = (libesedb_filter_predicate_t *) reallocation;
+
+	predicate = &( filter->predicates[ filter->number_of_predicates ] );
+
+	if( memory_set(
+	     predicate,
+	     0,
+	     sizeof( libesedb_filter_predicate_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear predicate.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data != NULL )
+	{
+		predicate->value_data = (uint8_t *) memory_allocate(
+		                                     sizeof( uint8_t ) * value_data_size );
+
+		if( predicate->value_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     predicate->value_data,
+		     value_data,
+		     sizeof( uint8_t ) * value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			goto on_error;
+		}
+		predicate->value_data_size = value_data_size;
+	}
+	if( upper_value_data != NULL )
+	{
+		predicate->upper_value_data = (uint8_t *) memory_allocate(
+		                                           sizeof( uint8_t ) * upper_value_data_size );
+
+		if( predicate->upper_value_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create upper bound value data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     predicate->upper_value_data,
+		     upper_value_data,
+		     sizeof( uint8_t ) * upper_value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy upper bound value data.",
+			 function );
+
+			goto on_error;
+		}
+		predicate->upper_value_data_size = upper_value_data_size;
+	}
+	predicate->type         = predicate_type;
+	predicate->column_index = column_index;
+	predicate->column_type  = column_type;
+
+	filter->number_of_predicates += 1;
+
+	return( 1 );
+
+on_error:
+	if( predicate->upper_value_data != NULL )
+	{
+		memory_free(
+		 predicate->upper_value_data );
+
+		predicate->upper_value_data = NULL;
+	}
+	if( predicate->value_data != NULL )
+	{
+		memory_free(
+		 predicate->value_data );
+
+		predicate->value_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Compares the value data of two values of a specific column type
+ * Values of numeric column types of equal size are compared by their numeric value,
+ * date and time values are compared as 64-bit unsigned integers, which preserves
+ * the order of both FILETIME and (positive) floating-point date and time values
+ * Other values are compared byte by byte, where a value that is a prefix of
+ * the other value is less
+ * Returns LIBFDATA_COMPARE_LESS, LIBFDATA_COMPARE_EQUAL, LIBFDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libesedb_filter_compare_value_data(
+     uint32_t column_type,
+     const uint8_t *first_value_data,
+     size_t first_value_data_size,
+     const uint8_t *second_value_data,
+     size_t second_value_data_size,
+     libcerror_error_t **error )
+{
+	byte_stream_float32_t first_value_float32;
+	byte_stream_float32_t second_value_float32;
+	byte_stream_float64_t first_value_float64;
+	byte_stream_float64_t second_value_float64;
+
+	static char *function       = "libesedb_filter_compare_value_data";
+	size_t compare_data_size    = 0;
+	size_t value_data_index     = 0;
+	uint64_t first_value_64bit  = 0;
+	uint64_t second_value_64bit = 0;
+	uint8_t is_signed           = 0;
+	int result                  = 0;
+
+	if( ( first_value_data == NULL )
+	 && ( first_value_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_value_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid first value data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( second_value_data == NULL )
+	 && ( second_value_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_value_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid second value data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_value_data_size == second_value_data_size )
+	{
+		switch( column_type )
+		{
+			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+				if( first_value_data_size != 4 )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint32_little_endian(
+				 first_value_data,
+				 first_value_float32.integer );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 second_value_data,
+				 second_value_float32.integer );
+
+				if( first_value_float32.floating_point < second_value_float32.floating_point )
+				{
+					return( LIBFDATA_COMPARE_LESS );
+				}
+				else if( first_value_float32.floating_point > second_value_float32.floating_point )
+				{
+					return( LIBFDATA_COMPARE_GREATER );
+				}
+				else if( first_value_float32.floating_point == second_value_float32.floating_point )
+				{
+					return( LIBFDATA_COMPARE_EQUAL );
+				}
+				/* Values that are not a number are compared byte by byte
+				 */
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+				if( first_value_data_size != 8 )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint64_little_endian(
+				 first_value_data,
+				 first_value_float64.integer );
+
+				byte_stream_copy_to_uint64_little_endian(
+				 second_value_data,
+				 second_value_float64.integer );
+
+				if( first_value_float64.floating_point < second_value_float64.floating_point )
+				{
+					return( LIBFDATA_COMPARE_LESS );
+				}
+				else if( first_value_float64.floating_point > second_value_float64.floating_point )
+				{
+					return( LIBFDATA_COMPARE_GREATER );
+				}
+				else if( first_value_float64.floating_point == second_value_float64.floating_point )
+				{
+					return( LIBFDATA_COMPARE_EQUAL );
+				}
+				/* Values that are not a number are compared byte by byte
+				 */
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_CURRENCY:
+				is_signed = 1;
+
+			/* Fall through */
+			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+				if( ( first_value_data_size != 1 )
+				 && ( first_value_data_size != 2 )
+				 && ( first_value_data_size != 4 )
+				 && ( first_value_data_size != 8 ) )
+				{
+					break;
+				}
+				for( value_data_index = first_value_data_size;
+				     value_data_index > 0;
+				     value_data_index-- )
+				{
+					first_value_64bit <<= 8;
+					first_value_64bit  |= first_value_data[ value_data_index - 1 ];
+
+					second_value_64bit <<= 8;
+					second_value_64bit  |= second_value_data[ value_data_index - 1 ];
+				}
+				if( is_signed != 0 )
+				{
+					/* Flipping the sign bit maps the signed values onto unsigned values of the same order
+					 */
+					first_value_64bit  ^= (uint64_t) 1 << ( ( first_value_data_size * 8 ) - 1 );
+					second_value_64bit ^= (uint64_t) 1 << ( ( first_value_data_size * 8 ) - 1 );
+				}
+				if( first_value_64bit < second_value_64bit )
+				{
+					return( LIBFDATA_COMPARE_LESS );
+				}
+				else if( first_value_64bit > second_value_64bit )
+				{
+					return( LIBFDATA_COMPARE_GREATER );
+				}
+				return( LIBFDATA_COMPARE_EQUAL );
+
+			default:
+				break;
+		}
+	}
+	if( first_value_data_size < second_value_data_size )
+	{
+		compare_data_size = first_value_data_size;
+	}
+	else
+	{
+		compare_data_size = second_value_data_size;
+	}
+	if( compare_data_size > 0 )
+	{
+		result = memory_compare(
+		          first_value_data,
+		          second_value_data,
+		          compare_data_size );
+
+		if( result < 0 )
+		{
+			return( LIBFDATA_COMPARE_LESS );
+		}
+		else if( result > 0 )
+		{
+			return( LIBFDATA_COMPARE_GREATER );
+		}
+	}
+	if( first_value_data_size < second_value_data_size )
+	{
+		return( LIBFDATA_COMPARE_LESS );
+	}
+	else if( first_value_data_size > second_value_data_size )
+	{
+		return( LIBFDATA_COMPARE_GREATER );
+	}
+	return( LIBFDATA_COMPARE_EQUAL );
+}
+
+/* Resizes the data
+ * The data is only reallocated if the data size exceeds the allocated data size
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_resize_data(
+     libesedb_filter_t *filter,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "libesedb_filter_resize_data";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > filter->data_size )
+	{
+		reallocation = memory_reallocate(
+		                filter->data,
+		                sizeof( uint8_t ) * data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data.",
+			 function );
+
+			return( -1 );
+		}
+		filter->data      = (uint8_t *) reallocation;
+		filter->data_size = data_size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the value data of a specific entry of the record
+ * Long values are read into the data of the filter, compressed values reference the cached
+ * uncompressed data of the record and other values reference the values data of the record.
+ * The value data is valid until the next call or until the record is read again
+ * Returns 1 if successful, 0 if the value is NULL or -1 on error
+ */
+int libesedb_filter_get_record_value_data(
+     libesedb_filter_t *filter,
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_data_type_value_t *data_type_value = NULL;
+	libesedb_long_value_t *long_value           = NULL;
+	static char *function                       = "libesedb_filter_get_record_value_data";
+	size64_t long_value_data_size               = 0;
+	int result                                  = 0;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->data_type_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing data type values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_entry < 0 )
+	 || ( internal_record->table_definition == NULL )
+	 || ( internal_record->table_definition->record_layout == NULL )
+	 || ( value_entry >= internal_record->table_definition->record_layout->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	data_type_value = &( internal_record->data_type_values[ value_entry ] );
+
+	/* Values of columns that are not projected are not read
+	 */
+	if( data_type_value->is_set == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - value: %d was not read.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( ( data_type_value->data_size == 0 )
+	 && ( data_type_value->data_flags == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( data_type_value->data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+	{
+		result = libesedb_record_get_long_value(
+		          (libesedb_record_t *) internal_record,
+		          value_entry,
+		          &long_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve long value: %d.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libesedb_long_value_get_data_size(
+		     long_value,
+		     &long_value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve long value data size.",
+			 function );
+
+			goto on_error;
+		}
+		if( long_value_data_size > (size64_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid long value data size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( long_value_data_size > 0 )
+		{
+			if( libesedb_filter_resize_data(
+			     filter,
+			     (size_t) long_value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize data.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_long_value_get_data(
+			     long_value,
+			     filter->data,
+			     (size_t) long_value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve long value data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libesedb_long_value_free(
+		     &long_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free long value.",
+			 function );
+
+			goto on_error;
+		}
+		*value_data      = filter->data;
+		*value_data_size = (size_t) long_value_data_size;
+	}
+	else if( ( data_type_value->data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+	{
+		if( data_type_value->data_size == 0 )
+		{
+			return( 0 );
+		}
+		/* The uncompressed data is cached in the record and is reused when
+		 * the value of a matching record is retrieved
+		 */
+		if( libesedb_record_get_uncompressed_value_data(
+		     internal_record,
+		     value_entry,
+		     value_data,
+		     value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve uncompressed data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		*value_data      = &( internal_record->values_data[ data_type_value->data_offset ] );
+		*value_data_size = (size_t) data_type_value->data_size;
+	}
+	return( 1 );
+
+on_error:
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if the record matches the filter
+ * The predicates are evaluated against the value data of the record, which does not
+ * require the values of the record to be created
+ * A NULL value only matches an is NULL predicate. Multi values are compared by their data
+ * Returns 1 if the record matches, 0 if not or -1 on error
+ */
+int libesedb_filter_match_record(
+     libesedb_filter_t *filter,
+     libesedb_internal_record_t *internal_record,
+     libcerror_error_t **error )
+{
+	libesedb_data_type_value_t *data_type_value = NULL;
+	libesedb_filter_predicate_t *predicate      = NULL;
+	const uint8_t *value_data                   = NULL;
+	static char *function                       = "libesedb_filter_match_record";
+	size_t value_data_size                      = 0;
+	int predicate_index                         = 0;
+	int result                                  = 0;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	for( predicate_index = 0;
+	     predicate_index < filter->number_of_predicates;
+	     predicate_index++ )
+	{
+		predicate = &( filter->predicates[ predicate_index ] );
+
+		if( ( predicate->type == LIBESEDB_FILTER_PREDICATE_TYPE_IS_NULL )
+		 || ( predicate->type == LIBESEDB_FILTER_PREDICATE_TYPE_IS_NOT_NULL ) )
+		{
+			/* Determine if the value is NULL without reading long values
+			 * or decompressing compressed values
+			 */
+			if( ( internal_record->data_type_values == NULL )
+			 || ( internal_record->table_definition == NULL )
+			 || ( internal_record->table_definition->record_layout == NULL )
+			 || ( predicate->column_index >= internal_record->table_definition->record_layout->number_of_columns ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid predicate: %d - column index value out of bounds.",
+				 function,
+				 predicate_index );
+
+				return( -1 );
+			}
+			data_type_value = &( internal_record->data_type_values[ predicate->column_index ] );
+
+			if( data_type_value->is_set == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid record - value: %d was not read.",
+				 function,
+				 predicate->column_index );
+
+				return( -1 );
+			}
+			if( ( data_type_value->data_size == 0 )
+			 && ( data_type_value->data_flags == 0 ) )
+			{
+				result = ( predicate->type == LIBESEDB_FILTER_PREDICATE_TYPE_IS_NULL );
+			}
+			else
+			{
+				result = ( predicate->type == LIBESEDB_FILTER_PREDICATE_TYPE_IS_NOT_NULL );
+			}
+			if( result == 0 )
+			{
+				return( 0 );
+			}
+			continue;
+		}
+		result = libesedb_filter_get_record_value_data(
+		          filter,
+		          internal_record,
+		          predicate->column_index,
+		          &value_data,
+		          &value_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value data of predicate: %d.",
+			 function,
+			 predicate_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( predicate->type == LIBESEDB_FILTER_PREDICATE_TYPE_PREFIX )
+		{
+			if( value_data_size < predicate->value_data_size )
+			{
+				return( 0 );
+			}
+			if( memory_compare(
+			     value_data,
+			     predicate->value_data,
+			     predicate->value_data_size ) != 0 )
+			{
+				return( 0 );
+			}
+			continue;
+		}
+		if( predicate->value_data != NULL )
+		{
+			result = libesedb_filter_compare_value_data(
+			          predicate->column_type,
+			          value_data,
+			          value_data_size,
+			          predicate->value_data,
+			          predicate->value_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare value data of predicate: %d.",
+				 function,
+				 predicate_index );
+
+				return( -1 );
+			}
+			if( predicate->type == LIBESEDB_FILTER_PREDICATE_TYPE_EQUAL )
+			{
+				if( result != LIBFDATA_COMPARE_EQUAL )
+				{
+					return( 0 );
+				}
+				continue;
+			}
+			if( result == LIBFDATA_COMPARE_LESS )
+			{
+				return( 0 );
+			}
+		}
+		if( predicate->upper_value_data != NULL )
+		{
+			result = libesedb_filter_compare_value_data(
+			          predicate->column_type,
+			          value_data,
+			          value_data_size,
+			          predicate->upper_value_data,
+			          predicate->upper_value_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare upper bound value data of predicate: %d.",
+				 function,
+				 predicate_index );
+
+				return( -1 );
+			}
+			if( result == LIBFDATA_COMPARE_GREATER )
+			{
+				return( 0 );
+			}
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,144 @@
+/*
+ * Filter functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_FILTER_H )
+#define _LIBESEDB_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_record.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_filter_predicate libesedb_filter_predicate_t;
+
+struct libesedb_filter_predicate
+{
+	/* The predicate type
+	 */
+	uint8_t type;
+
+	/* The column index
+	 * This is the index of the column in the record layout
+	 */
+	int column_index;
+
+	/* The column type
+	 */
+	uint32_t column_type;
+
+	/* The value data
+	 * This is the lower bound of a range predicate, NULL represents no lower bound
+	 */
+	uint8_t *value_data;
+
+	/* The value data size
+	 */
+	size_t value_data_size;
+
+	/* The upper bound value data
+	 * NULL represents no upper bound
+	 */
+	uint8_t *upper_value_data;
+
+	/* The upper bound value data size
+	 */
+	size_t upper_value_data_size;
+};
+
+typedef struct libesedb_filter libesedb_filter_t;
+
+struct libesedb_filter
+{
+	/* The predicates
+	 * A record matches the filter if it matches all the predicates
+	 */
+	libesedb_filter_predicate_t *predicates;
+
+	/* The number of predicates
+	 */
+	int number_of_predicates;
+
+	/* The data
+	 * This buffer is used to decompress values and to read long values
+	 */
+	uint8_t *data;
+
+	/* The (allocated) data size
+	 */
+	size_t data_size;
+};
+
+int libesedb_filter_initialize(
+     libesedb_filter_t **filter,
+     libcerror_error_t **error );
+
+int libesedb_filter_free(
+     libesedb_filter_t **filter,
+     libcerror_error_t **error );
+
+int libesedb_filter_append_predicate(
+     libesedb_filter_t *filter,
+     uint8_t predicate_type,
+     int column_index,
+     uint32_t column_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     const uint8_t *upper_value_data,
+     size_t upper_value_data_size,
+     libcerror_error_t **error );
+
+int libesedb_filter_compare_value_data(
+     uint32_t column_type,
+     const uint8_t *first_value_data,
+     size_t first_value_data_size,
+     const uint8_t *second_value_data,
+     size_t second_value_data_size,
+     libcerror_error_t **error );
+
+int libesedb_filter_resize_data(
+     libesedb_filter_t *filter,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libesedb_filter_get_record_value_data(
+     libesedb_filter_t *filter,
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+int libesedb_filter_match_record(
+     libesedb_filter_t *filter,
+     libesedb_internal_record_t *internal_record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_FILTER_H ) */
+
@@ -0,0 +1,455 @@
+/*
+ * Huffman tree functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_huffman_tree.h"
+#include "libesedb_libcerror.h"
+
+/* Creates a Huffman tree
+ * Make sure the value huffman_tree is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_huffman_tree_initialize(
+     libesedb_huffman_tree_t **huffman_tree,
+     int number_of_symbols,
+     uint8_t maximum_code_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_huffman_tree_initialize";
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *huffman_tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Huffman tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The symbol is stored in 12 bits of a lookup table entry
+	 */
+	if( ( number_of_symbols <= 0 )
+	 || ( number_of_symbols > 4096 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The code size is stored in 4 bits of a lookup table entry
+	 */
+	if( ( maximum_code_size == 0 )
+	 || ( maximum_code_size > 15 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum code size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*huffman_tree = memory_allocate_structure(
+	                 libesedb_huffman_tree_t );
+
+	if( *huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *huffman_tree,
+	     0,
+	     sizeof( libesedb_huffman_tree_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Huffman tree.",
+		 function );
+
+		memory_free(
+		 *huffman_tree );
+
+		*huffman_tree = NULL;
+
+		return( -1 );
+	}
+	( *huffman_tree )->lookup_table = (uint16_t *) memory_allocate(
+	                                                sizeof( uint16_t ) << maximum_code_size );
+
+	if( ( *huffman_tree )->lookup_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create lookup table.",
+		 function );
+
+		goto on_error;
+	}
+	( *huffman_tree )->number_of_symbols = number_of_symbols;
+	( *huffman_tree )->maximum_code_size = maximum_code_size;
+
+	return( 1 );
+
+on_error:
+	if( *huffman_tree != NULL )
+	{
+		memory_free(
+		 *huffman_tree );
+
+		*huffman_tree = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a Huffman tree
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_huffman_tree_free(
+     libesedb_huffman_tree_t **huffman_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_huffman_tree_free";
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *huffman_tree != NULL )
+	{
+		if( ( *huffman_tree )->lookup_table != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->lookup_table );
+		}
+		memory_free(
+		 *huffman_tree );
+
+		*huffman_tree = NULL;
+	}
+	return( 1 );
+}
+
+/* Builds the Huffman tree from the code sizes of the symbols
+ * The codes are assigned canonically, ordered by code size and then by symbol
+ * The lookup table is indexed by the next bits of a stream so that
+ * a symbol can be decoded with a single lookup
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_huffman_tree_build(
+     libesedb_huffman_tree_t *huffman_tree,
+     const uint8_t *code_sizes_array,
+     int number_of_code_sizes,
+     libcerror_error_t **error )
+{
+	int code_size_counts[ 16 ];
+
+	static char *function           = "libesedb_huffman_tree_build";
+	size_t entry_index              = 0;
+	size_t lookup_table_entry_index = 0;
+	size_t lookup_table_size        = 0;
+	size_t number_of_entries        = 0;
+	uint16_t lookup_table_entry     = 0;
+	uint8_t code_size               = 0;
+	uint8_t number_of_lookup_bits   = 0;
+	int symbol                      = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( huffman_tree->lookup_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid Huffman tree - missing lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes array.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_code_sizes <= 0 )
+	 || ( number_of_code_sizes > huffman_tree->number_of_symbols ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of code sizes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     code_size_counts,
+	     0,
+	     sizeof( int ) * 16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code size counts.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < number_of_code_sizes;
+	     symbol++ )
+	{
+		code_size = code_sizes_array[ symbol ];
+
+		if( code_size > huffman_tree->maximum_code_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid symbol: %d code size: %" PRIu8 " value out of bounds.",
+			 function,
+			 symbol,
+			 code_size );
+
+			return( -1 );
+		}
+		code_size_counts[ code_size ] += 1;
+
+		if( code_size > number_of_lookup_bits )
+		{
+			number_of_lookup_bits = code_size;
+		}
+	}
+	if( number_of_lookup_bits == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid code sizes array - missing codes.",
+		 function );
+
+		return( -1 );
+	}
+	/* The lookup table is only as large as needed for the longest code
+	 * which keeps rebuilding the tree cheap for small blocks of data
+	 */
+	lookup_table_size = (size_t) 1 << number_of_lookup_bits;
+
+	for( code_size = 1;
+	     code_size <= number_of_lookup_bits;
+	     code_size++ )
+	{
+		if( code_size_counts[ code_size ] == 0 )
+		{
+			continue;
+		}
+		number_of_entries = (size_t) 1 << ( number_of_lookup_bits - code_size );
+
+		for( symbol = 0;
+		     symbol < number_of_code_sizes;
+		     symbol++ )
+		{
+			if( code_sizes_array[ symbol ] != code_size )
+			{
+				continue;
+			}
+			if( number_of_entries > ( lookup_table_size - lookup_table_entry_index ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid code sizes array - too many codes.",
+				 function );
+
+				return( -1 );
+			}
+			lookup_table_entry = (uint16_t) ( ( symbol << 4 ) | code_size );
+
+			for( entry_index = 0;
+			     entry_index < number_of_entries;
+			     entry_index++ )
+			{
+				huffman_tree->lookup_table[ lookup_table_entry_index++ ] = lookup_table_entry;
+			}
+		}
+	}
+	/* Mark the codes that are not assigned to a symbol
+	 */
+	if( lookup_table_entry_index < lookup_table_size )
+	{
+		if( memory_set(
+		     &( huffman_tree->lookup_table[ lookup_table_entry_index ] ),
+		     0,
+		     sizeof( uint16_t ) * ( lookup_table_size - lookup_table_entry_index ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear lookup table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	huffman_tree->number_of_lookup_bits = number_of_lookup_bits;
+
+	return( 1 );
+}
+
+/* Retrieves a symbol from the Huffman tree
+ * The bits contain the next bits of a stream aligned to the most significant bit
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_huffman_tree_get_symbol(
+     libesedb_huffman_tree_t *huffman_tree,
+     uint32_t bits,
+     uint16_t *symbol,
+     uint8_t *code_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libesedb_huffman_tree_get_symbol";
+	uint16_t lookup_table_entry = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( huffman_tree->lookup_table == NULL )
+	 || ( huffman_tree->number_of_lookup_bits == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid Huffman tree - missing lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	if( symbol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code size.",
+		 function );
+
+		return( -1 );
+	}
+	lookup_table_entry = huffman_tree->lookup_table[ bits >> ( 32 - huffman_tree->number_of_lookup_bits ) ];
+
+	if( ( lookup_table_entry & 0x000f ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid code: 0x%08" PRIx32 ".",
+		 function,
+		 bits );
+
+		return( -1 );
+	}
+	*symbol    = lookup_table_entry >> 4;
+	*code_size = (uint8_t) ( lookup_table_entry & 0x000f );
+
+	return( 1 );
+}
+
@@ -0,0 +1,86 @@
+/*
+ * Huffman tree functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_HUFFMAN_TREE_H )
+#define _LIBESEDB_HUFFMAN_TREE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_huffman_tree libesedb_huffman_tree_t;
+
+struct libesedb_huffman_tree
+{
+	/* The number of symbols
+	 */
+	int number_of_symbols;
+
+	/* The maximum code size
+	 */
+	uint8_t maximum_code_size;
+
+	/* The number of bits used to index the lookup table
+	 * This is the size of the longest code in the tree
+	 */
+	uint8_t number_of_lookup_bits;
+
+	/* The lookup table
+	 * Every entry contains the symbol in the upper 12 bits and the code size in the lower 4 bits
+	 * A code size of 0 represents an unused code
+	 */
+	uint16_t *lookup_table;
+};
+
+int libesedb_huffman_tree_initialize(
+     libesedb_huffman_tree_t **huffman_tree,
+     int number_of_symbols,
+     uint8_t maximum_code_size,
+     libcerror_error_t **error );
+
+int libesedb_huffman_tree_free(
+     libesedb_huffman_tree_t **huffman_tree,
+     libcerror_error_t **error );
+
+int libesedb_huffman_tree_build(
+     libesedb_huffman_tree_t *huffman_tree,
+     const uint8_t *code_sizes_array,
+     int number_of_code_sizes,
+     libcerror_error_t **error );
+
+int libesedb_huffman_tree_get_symbol(
+     libesedb_huffman_tree_t *huffman_tree,
+     uint32_t bits,
+     uint16_t *symbol,
+     uint8_t *code_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_HUFFMAN_TREE_H ) */
+
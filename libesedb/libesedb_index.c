@@ -24,6 +24,7 @@
 #include <types.h>
 
 #include "libesedb_catalog_definition.h"
+#include "libesedb_cursor.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_definitions.h"
 #include "libesedb_io_handle.h"
@@ -86,6 +87,17 @@ int libesedb_index_initialize(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( table_definition == NULL )
 	{
 		libcerror_error_set(
@@ -187,7 +199,7 @@ int libesedb_index_initialize(
 	}
 	if( libfcache_cache_initialize(
 	     &( internal_index->index_values_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_INDEX_VALUES,
+	     io_handle->maximum_cache_entries[ LIBESEDB_CACHE_TYPE_INDEX_VALUES ],
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -792,6 +804,7 @@ int libesedb_index_get_record(
 	     record_data_definition,
 	     internal_index->long_values_tree,
 	     internal_index->long_values_cache,
+	     NULL,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -815,3 +828,327 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves a cursor positioned before the first index value that matches a specific key
+ * The key data contains the (normalized) key as stored in the index values tree
+ * The match mode determines if the key of the index value must be equal to (LIBESEDB_KEY_MATCH_MODE_EQUAL),
+ * greater than or equal to (LIBESEDB_KEY_MATCH_MODE_GREATER_EQUAL) or greater than (LIBESEDB_KEY_MATCH_MODE_GREATER) the key
+ * The next record read from the cursor is the record of the matching index value
+ * An empty key, with a key data size of 0, positions the cursor before the first index value
+ * regardless of the match mode, which allows all index values to be read in index order
+ * Returns 1 if successful, 0 if no such index value or -1 on error
+ */
+int libesedb_index_seek(
+     libesedb_index_t *index,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     int match_mode,
+     libesedb_cursor_t **cursor,
+     libcerror_error_t **error )
+{
+	libesedb_cursor_t *index_cursor           = NULL;
+	libesedb_internal_index_t *internal_index = NULL;
+	libesedb_key_t *key                       = NULL;
+	static char *function                     = "libesedb_index_seek";
+	int result                                = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( internal_index->index_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing index catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_data == NULL )
+	 && ( key_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size > 0 )
+	{
+		if( libesedb_key_initialize(
+		     &key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_key_set_data(
+		     key,
+		     key_data,
+		     key_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set key data.",
+			 function );
+
+			goto on_error;
+		}
+		key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+	}
+
+	if( libesedb_cursor_initialize(
+	     &index_cursor,
+	     internal_index->file_io_handle,
+	     internal_index->io_handle,
+	     internal_index->table_definition,
+	     internal_index->template_table_definition,
+	     internal_index->pages_vector,
+	     internal_index->pages_cache,
+	     internal_index->index_catalog_definition->father_data_page_number,
+	     internal_index->long_values_tree,
+	     internal_index->long_values_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_cursor_initialize(
+	     &( ( (libesedb_internal_cursor_t *) index_cursor )->table_cursor ),
+	     internal_index->file_io_handle,
+	     internal_index->io_handle,
+	     internal_index->table_definition,
+	     internal_index->template_table_definition,
+	     internal_index->pages_vector,
+	     internal_index->pages_cache,
+	     internal_index->table_definition->table_catalog_definition->father_data_page_number,
+	     internal_index->long_values_tree,
+	     internal_index->long_values_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_cursor_set_key_columns(
+	     (libesedb_internal_cursor_t *) index_cursor,
+	     internal_index->index_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set index cursor key columns.",
+		 function );
+
+		goto on_error;
+	}
+	if( key == NULL )
+	{
+		if( ( match_mode != LIBESEDB_KEY_MATCH_MODE_EQUAL )
+		 && ( match_mode != LIBESEDB_KEY_MATCH_MODE_GREATER_EQUAL )
+		 && ( match_mode != LIBESEDB_KEY_MATCH_MODE_GREATER ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported match mode.",
+			 function );
+
+			goto on_error;
+		}
+		/* The first index value is read to determine if the index contains values
+		 * after which the cursor is positioned before it
+		 */
+		result = libesedb_cursor_read_next_value(
+		          (libesedb_internal_cursor_t *) index_cursor,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read first value from index values tree.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libesedb_cursor_reset(
+			     index_cursor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to reset index cursor.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+	{
+		result = libesedb_cursor_seek(
+		          (libesedb_internal_cursor_t *) index_cursor,
+		          key,
+		          match_mode,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to seek key in index values tree.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_key_free(
+		     &key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
+	{
+		if( libesedb_cursor_free(
+		     &index_cursor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index cursor.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*cursor = index_cursor;
+
+	return( result );
+
+on_error:
+	if( index_cursor != NULL )
+	{
+		libesedb_cursor_free(
+		 &index_cursor,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -171,6 +171,15 @@ int libesedb_index_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_index_seek(
+     libesedb_index_t *index,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     int match_mode,
+     libesedb_cursor_t **cursor,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,6 +24,23 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <errno.h>
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "libesedb_checksum.h"
 #include "libesedb_codepage.h"
 #include "libesedb_debug.h"
@@ -39,6 +56,16 @@
 
 const uint8_t esedb_file_signature[ 4 ] = { 0xef, 0xcd, 0xab, 0x89 };
 
+/* The default maximum number of cache entries per cache type
+ */
+static const int libesedb_io_handle_default_maximum_cache_entries[ LIBESEDB_NUMBER_OF_CACHE_TYPES ] = {
+	LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	LIBESEDB_MAXIMUM_CACHE_ENTRIES_INDEX_VALUES,
+	LIBESEDB_MAXIMUM_CACHE_ENTRIES_LONG_VALUES,
+	LIBESEDB_MAXIMUM_CACHE_ENTRIES_LONG_VALUES_DATA,
+	LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_VALUES,
+	LIBESEDB_MAXIMUM_CACHE_ENTRIES_TREE_VALUES };
+
 /* Creates an IO handle
  * Make sure the value io_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -99,6 +126,20 @@ int libesedb_io_handle_initialize(
 
 		goto on_error;
 	}
+	if( memory_copy(
+	     ( *io_handle )->maximum_cache_entries,
+	     libesedb_io_handle_default_maximum_cache_entries,
+	     sizeof( int ) * LIBESEDB_NUMBER_OF_CACHE_TYPES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy default maximum cache entries.",
+		 function );
+
+		goto on_error;
+	}
 	( *io_handle )->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
 
 	return( 1 );
@@ -137,6 +178,19 @@ int libesedb_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( libesedb_io_handle_unmap_file(
+		     *io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *io_handle );
 
@@ -152,7 +206,10 @@ int libesedb_io_handle_clear(
      libesedb_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
+	int maximum_cache_entries[ LIBESEDB_NUMBER_OF_CACHE_TYPES ];
+
 	static char *function = "libesedb_io_handle_clear";
+	int cache_type        = 0;
 
 	if( io_handle == NULL )
 	{
@@ -165,6 +222,27 @@ int libesedb_io_handle_clear(
 
 		return( -1 );
 	}
+	if( libesedb_io_handle_unmap_file(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to unmap file.",
+		 function );
+
+		return( -1 );
+	}
+	/* The cache settings are retained
+	 */
+	for( cache_type = 0;
+	     cache_type < LIBESEDB_NUMBER_OF_CACHE_TYPES;
+	     cache_type++ )
+	{
+		maximum_cache_entries[ cache_type ] = io_handle->maximum_cache_entries[ cache_type ];
+	}
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -181,6 +259,326 @@ int libesedb_io_handle_clear(
 	}
 	io_handle->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
 
+	for( cache_type = 0;
+	     cache_type < LIBESEDB_NUMBER_OF_CACHE_TYPES;
+	     cache_type++ )
+	{
+		io_handle->maximum_cache_entries[ cache_type ] = maximum_cache_entries[ cache_type ];
+	}
+	return( 1 );
+}
+
+/* Maps a file into memory
+ * The file is mapped read-only, the page data is never modified
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_map_file(
+     libesedb_io_handle_t *io_handle,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_map_file";
+
+#if defined( HAVE_LIBESEDB_MEMORY_MAPPED_IO )
+	struct stat file_statistics;
+
+	void *mapped_data     = NULL;
+	int file_descriptor   = -1;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->mapped_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - mapped data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MEMORY_MAPPED_IO )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_statistics.st_size <= 0 )
+	 || ( (size64_t) file_statistics.st_size > (size64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	mapped_data = mmap(
+	               NULL,
+	               (size_t) file_statistics.st_size,
+	               PROT_READ,
+	               MAP_PRIVATE,
+	               file_descriptor,
+	               0 );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		mapped_data = NULL;
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file: %s.",
+		 function,
+		 filename );
+
+		file_descriptor = -1;
+
+		goto on_error;
+	}
+	io_handle->mapped_data      = (uint8_t *) mapped_data;
+	io_handle->mapped_data_size = (size64_t) file_statistics.st_size;
+
+	return( 1 );
+
+on_error:
+	if( mapped_data != NULL )
+	{
+		munmap(
+		 mapped_data,
+		 (size_t) file_statistics.st_size );
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory mapped access not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBESEDB_MEMORY_MAPPED_IO ) */
+}
+
+/* Unmaps a memory mapped file
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_unmap_file(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_unmap_file";
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MEMORY_MAPPED_IO )
+	if( io_handle->mapped_data != NULL )
+	{
+		if( munmap(
+		     io_handle->mapped_data,
+		     (size_t) io_handle->mapped_data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	io_handle->mapped_data      = NULL;
+	io_handle->mapped_data_size = 0;
+
+	return( result );
+}
+
+/* Retrieves the maximum number of cache entries of a specific cache type
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_get_maximum_cache_entries(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     int *maximum_cache_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_get_maximum_cache_entries";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_type < 0 )
+	 || ( cache_type >= LIBESEDB_NUMBER_OF_CACHE_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache type: %d.",
+		 function,
+		 cache_type );
+
+		return( -1 );
+	}
+	if( maximum_cache_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_cache_entries = io_handle->maximum_cache_entries[ cache_type ];
+
+	return( 1 );
+}
+
+/* Sets the maximum number of cache entries of a specific cache type
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_set_maximum_cache_entries(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     int maximum_cache_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_set_maximum_cache_entries";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_type < 0 )
+	 || ( cache_type >= LIBESEDB_NUMBER_OF_CACHE_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache type: %d.",
+		 function,
+		 cache_type );
+
+		return( -1 );
+	}
+	if( maximum_cache_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum cache entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->maximum_cache_entries[ cache_type ] = maximum_cache_entries;
+
 	return( 1 );
 }
 
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_definitions.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
@@ -34,6 +35,10 @@
 extern "C" {
 #endif
 
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( HAVE_SYS_MMAN_H )
+#define HAVE_LIBESEDB_MEMORY_MAPPED_IO	1
+#endif
+
 extern const uint8_t esedb_file_signature[ 4 ];
 
 typedef struct libesedb_io_handle libesedb_io_handle_t;
@@ -80,6 +85,22 @@ struct libesedb_io_handle
 	 */
 	int ascii_codepage;
 
+	/* Value to indicate the page checksums should be verified on read
+	 */
+	uint8_t verify_checksums;
+
+	/* The memory mapped file data
+	 */
+	uint8_t *mapped_data;
+
+	/* The memory mapped file data size
+	 */
+	size64_t mapped_data_size;
+
+	/* The maximum number of cache entries per cache type
+	 */
+	int maximum_cache_entries[ LIBESEDB_NUMBER_OF_CACHE_TYPES ];
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -97,6 +118,27 @@ int libesedb_io_handle_clear(
      libesedb_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libesedb_io_handle_map_file(
+     libesedb_io_handle_t *io_handle,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_unmap_file(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_get_maximum_cache_entries(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     int *maximum_cache_entries,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_set_maximum_cache_entries(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     int maximum_cache_entries,
+     libcerror_error_t **error );
+
 int libesedb_io_handle_set_pages_data_range(
      libesedb_io_handle_t *io_handle,
      size64_t file_size,
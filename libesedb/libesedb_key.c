@@ -558,10 +558,11 @@ int libesedb_key_compare(
 	{
 		if( first_key->type == LIBESEDB_KEY_TYPE_INDEX_VALUE )
 		{
-			/* If the key exactly matches the branch key,
+			/* If the key exactly matches the branch key, or is longer,
 			 * the leaf value is in the next branch node
 			 */
-			if( compare_result == 0 )
+			if( ( compare_result == 0 )
+			 && ( first_key->data_size >= second_key->data_size ) )
 			{
 				result = LIBFDATA_COMPARE_GREATER;
 			}
@@ -670,3 +671,295 @@ fprintf( stderr, "MARKER\n" );
 	return( result );
 }
 
+
+/* Retrieves the size of the value of a fixed-size key segment
+ * Returns 1 if successful, 0 if the column type has no fixed-size key segment or -1 on error
+ */
+int libesedb_key_get_fixed_size_segment_value_size(
+     uint32_t column_type,
+     size_t *value_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_key_get_fixed_size_segment_value_size";
+
+	if( value_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			*value_size = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			*value_size = 2;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			*value_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			*value_size = 8;
+			break;
+
+		default:
+			*value_size = 0;
+
+			return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads a fixed-size key segment
+ * The key segment is normalized to be compared bytewise, this function
+ * reverts the normalization and stores the value in little-endian as in a record
+ * On return key data offset points to the start of the next key segment
+ * Returns 1 if successful, 0 if the key segment contains a NULL value or -1 on error
+ */
+int libesedb_key_read_fixed_size_segment(
+     const uint8_t *key_data,
+     size_t key_data_size,
+     size_t *key_data_offset,
+     uint32_t column_type,
+     uint8_t *value_data,
+     size_t value_data_size,
+     size_t *value_size,
+     libcerror_error_t **error )
+{
+	uint8_t segment_data[ 8 ];
+
+	static char *function         = "libesedb_key_read_fixed_size_segment";
+	size_t segment_data_index     = 0;
+	size_t segment_data_size      = 0;
+	size_t safe_key_data_offset   = 0;
+	uint8_t is_descending         = 0;
+	int result                    = 0;
+
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_key_data_offset = *key_data_offset;
+
+	if( safe_key_data_offset >= key_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_key_get_fixed_size_segment_value_size(
+	          column_type,
+	          &segment_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment value size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_type );
+
+		return( -1 );
+	}
+	if( value_data_size < segment_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid value data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The key segment starts with a prefix byte that indicates
+	 * if the value is NULL and the sort order of the segment
+	 */
+	switch( key_data[ safe_key_data_offset ] )
+	{
+		case 0x00:
+		case 0x3f:
+		case 0xc0:
+		case 0xff:
+			*key_data_offset = safe_key_data_offset + 1;
+			*value_size      = 0;
+
+			return( 0 );
+
+		case 0x7f:
+			break;
+
+		case 0x80:
+			is_descending = 1;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported key segment prefix: 0x%02" PRIx8 ".",
+			 function,
+			 key_data[ safe_key_data_offset ] );
+
+			return( -1 );
+	}
+	safe_key_data_offset += 1;
+
+	if( segment_data_size > ( key_data_size - safe_key_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key segment size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_data_index = 0;
+	     segment_data_index < segment_data_size;
+	     segment_data_index++ )
+	{
+		segment_data[ segment_data_index ] = key_data[ safe_key_data_offset + segment_data_index ];
+
+		if( is_descending != 0 )
+		{
+			segment_data[ segment_data_index ] ^= 0xff;
+		}
+	}
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			/* Signed integers are stored with the sign bit flipped
+			 */
+			segment_data[ 0 ] ^= 0x80;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			/* Positive floating-point values are stored with the sign bit flipped
+			 * negative floating-point values are stored with all bits flipped
+			 */
+			if( ( segment_data[ 0 ] & 0x80 ) != 0 )
+			{
+				segment_data[ 0 ] &= 0x7f;
+			}
+			else
+			{
+				for( segment_data_index = 0;
+				     segment_data_index < segment_data_size;
+				     segment_data_index++ )
+				{
+					segment_data[ segment_data_index ] ^= 0xff;
+				}
+			}
+			break;
+
+		default:
+			break;
+	}
+	/* The key segment is stored in big-endian
+	 */
+	for( segment_data_index = 0;
+	     segment_data_index < segment_data_size;
+	     segment_data_index++ )
+	{
+		value_data[ segment_data_index ] = segment_data[ segment_data_size - segment_data_index - 1 ];
+	}
+	*key_data_offset = safe_key_data_offset + segment_data_size;
+	*value_size      = segment_data_size;
+
+	return( 1 );
+}
+
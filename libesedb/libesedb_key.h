@@ -73,6 +73,21 @@ int libesedb_key_compare(
      libesedb_key_t *second_key,
      libcerror_error_t **error );
 
+int libesedb_key_get_fixed_size_segment_value_size(
+     uint32_t column_type,
+     size_t *value_size,
+     libcerror_error_t **error );
+
+int libesedb_key_read_fixed_size_segment(
+     const uint8_t *key_data,
+     size_t key_data_size,
+     size_t *key_data_offset,
+     uint32_t column_type,
+     uint8_t *value_data,
+     size_t value_data_size,
+     size_t *value_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
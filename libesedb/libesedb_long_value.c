@@ -71,6 +71,17 @@ int libesedb_long_value_initialize(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( column_catalog_definition == NULL )
 	{
 		libcerror_error_set(
@@ -126,7 +137,7 @@ int libesedb_long_value_initialize(
 	}
 	if( libfcache_cache_initialize(
 	     &( internal_long_value->data_segments_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_LONG_VALUES_DATA,
+	     io_handle->maximum_cache_entries[ LIBESEDB_CACHE_TYPE_LONG_VALUES_DATA ],
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -138,10 +149,11 @@ int libesedb_long_value_initialize(
 
 		goto on_error;
 	}
-	internal_long_value->file_io_handle            = file_io_handle;
-	internal_long_value->io_handle                 = io_handle;
-	internal_long_value->column_catalog_definition = column_catalog_definition;
-	internal_long_value->data_segments_list        = data_segments_list;
+	internal_long_value->file_io_handle             = file_io_handle;
+	internal_long_value->io_handle                  = io_handle;
+	internal_long_value->column_catalog_definition  = column_catalog_definition;
+	internal_long_value->data_segments_list         = data_segments_list;
+	internal_long_value->current_data_segment_index = -1;
 
 	*long_value = (libesedb_long_value_t *) internal_long_value;
 
@@ -869,6 +881,353 @@ int libesedb_long_value_get_data_segment(
 	return( 1 );
 }
 
+/* Reads data at the current offset into a buffer
+ * The data segments are read on demand and stored in the data segments cache
+ * Returns the number of bytes read, 0 when no more data is available or -1 on error
+ */
+ssize_t libesedb_long_value_read_buffer(
+         libesedb_long_value_t *long_value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libesedb_data_segment_t *data_segment               = NULL;
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_read_buffer";
+	size64_t data_segments_size                         = 0;
+	size_t buffer_offset                                = 0;
+	size_t read_size                                    = 0;
+	off64_t data_segment_data_offset                    = 0;
+	int data_segment_index                              = 0;
+	int number_of_data_segments                         = 0;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( internal_long_value->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid long value - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_size(
+	     internal_long_value->data_segments_list,
+	     &data_segments_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size from data segments list.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) internal_long_value->current_offset >= data_segments_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( data_segments_size - internal_long_value->current_offset ) )
+	{
+		buffer_size = (size_t) ( data_segments_size - internal_long_value->current_offset );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     internal_long_value->data_segments_list,
+	     &number_of_data_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from data segments list.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		if( internal_long_value->current_data_segment_index < 0 )
+		{
+			if( libfdata_list_get_element_value_at_offset(
+			     internal_long_value->data_segments_list,
+			     (intptr_t *) internal_long_value->file_io_handle,
+			     internal_long_value->data_segments_cache,
+			     internal_long_value->current_offset,
+			     &data_segment_index,
+			     &data_segment_data_offset,
+			     (intptr_t **) &data_segment,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 internal_long_value->current_offset,
+				 internal_long_value->current_offset );
+
+				return( -1 );
+			}
+			internal_long_value->current_data_segment_index       = data_segment_index;
+			internal_long_value->current_data_segment_data_offset = (size_t) data_segment_data_offset;
+		}
+		else
+		{
+			data_segment_index = internal_long_value->current_data_segment_index;
+
+			if( data_segment_index >= number_of_data_segments )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid long value - current data segment index value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfdata_list_get_element_value_by_index(
+			     internal_long_value->data_segments_list,
+			     (intptr_t *) internal_long_value->file_io_handle,
+			     internal_long_value->data_segments_cache,
+			     data_segment_index,
+			     (intptr_t **) &data_segment,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data segment: %d.",
+				 function,
+				 data_segment_index );
+
+				return( -1 );
+			}
+		}
+		if( data_segment == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data segment: %d.",
+			 function,
+			 data_segment_index );
+
+			return( -1 );
+		}
+		if( internal_long_value->current_data_segment_data_offset > data_segment->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid long value - current data segment data offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		read_size = data_segment->data_size - internal_long_value->current_data_segment_data_offset;
+
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		if( read_size > 0 )
+		{
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( data_segment->data[ internal_long_value->current_data_segment_data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset                                         += read_size;
+			internal_long_value->current_offset                   += (off64_t) read_size;
+			internal_long_value->current_data_segment_data_offset += read_size;
+		}
+		if( internal_long_value->current_data_segment_data_offset >= data_segment->data_size )
+		{
+			internal_long_value->current_data_segment_index       += 1;
+			internal_long_value->current_data_segment_data_offset  = 0;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Seeks a certain offset of the data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libesedb_long_value_seek_offset(
+         libesedb_long_value_t *long_value,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_seek_offset";
+	size64_t data_segments_size                         = 0;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_long_value->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		if( libfdata_list_get_size(
+		     internal_long_value->data_segments_list,
+		     &data_segments_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size from data segments list.",
+			 function );
+
+			return( -1 );
+		}
+		offset += (off64_t) data_segments_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The current data segment is determined on the next read unless the offset is unchanged
+	 */
+	if( offset != internal_long_value->current_offset )
+	{
+		internal_long_value->current_offset                   = offset;
+		internal_long_value->current_data_segment_index       = -1;
+		internal_long_value->current_data_segment_data_offset = 0;
+	}
+	return( offset );
+}
+
+/* Retrieves the current offset of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_get_offset(
+     libesedb_long_value_t *long_value,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_get_offset";
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_long_value->current_offset;
+
+	return( 1 );
+}
+
 /* Retrieves the size of the data as an UTF-8 encoded string
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if value is NULL or -1 on error
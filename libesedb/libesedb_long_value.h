@@ -74,6 +74,19 @@ struct libesedb_internal_long_value
 	/* The record value
 	 */
 	libfvalue_value_t *record_value;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The current data segment index
+	 * -1 represents the data segment index needs to be determined from the current offset
+	 */
+	int current_data_segment_index;
+
+	/* The current data segment data offset
+	 */
+	size_t current_data_segment_data_offset;
 };
 
 int libesedb_long_value_initialize(
@@ -128,6 +141,26 @@ int libesedb_long_value_get_data_segment(
      size_t data_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+ssize_t libesedb_long_value_read_buffer(
+         libesedb_long_value_t *long_value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+off64_t libesedb_long_value_seek_offset(
+         libesedb_long_value_t *long_value,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_long_value_get_offset(
+     libesedb_long_value_t *long_value,
+     off64_t *offset,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_long_value_get_utf8_string_size(
      libesedb_long_value_t *long_value,
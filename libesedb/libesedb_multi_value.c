@@ -30,9 +30,11 @@
 #include "libesedb_libfvalue.h"
 #include "libesedb_multi_value.h"
 #include "libesedb_types.h"
+#include "libesedb_unicode.h"
 
 /* Creates a multi value
  * Make sure the value multi_value is referencing, is set to NULL
+ * The multi value takes over the management of the record value
  * Returns 1 if successful or -1 on error
  */
 int libesedb_multi_value_initialize(
@@ -139,7 +141,9 @@ int libesedb_multi_value_free(
      libesedb_multi_value_t **multi_value,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_multi_value_free";
+	libesedb_internal_multi_value_t *internal_multi_value = NULL;
+	static char *function                                 = "libesedb_multi_value_free";
+	int result                                            = 1;
 
 	if( multi_value == NULL )
 	{
@@ -154,14 +158,28 @@ int libesedb_multi_value_free(
 	}
 	if( *multi_value != NULL )
 	{
-		/* The column_catalog_definition and record_value references are freed elsewhere
+		internal_multi_value = (libesedb_internal_multi_value_t *) *multi_value;
+		*multi_value         = NULL;
+
+		/* The column_catalog_definition reference is freed elsewhere
 		 */
-		memory_free(
-		 *multi_value );
+		if( libfvalue_value_free(
+		     &( internal_multi_value->record_value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record value.",
+			 function );
 
-		*multi_value = NULL;
+			result = -1;
+		}
+		memory_free(
+		 internal_multi_value );
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the column type
@@ -978,27 +996,27 @@ int libesedb_multi_value_get_value_utf8_string_size(
 
 		return( -1 );
 	}
+	if( libfvalue_value_get_entry_data(
+	     internal_multi_value->record_value,
+	     multi_value_index,
+	     &entry_data,
+	     &entry_data_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value entry: %d data.",
+		 function,
+		 multi_value_index );
+
+		return( -1 );
+	}
 	if( ( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
 	 && ( multi_value_index == 0 ) )
 	{
-		if( libfvalue_value_get_entry_data(
-		     internal_multi_value->record_value,
-		     multi_value_index,
-		     &entry_data,
-		     &entry_data_size,
-		     &encoding,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record value entry: %d data.",
-			 function,
-			 multi_value_index );
-
-			return( -1 );
-		}
 		result = libesedb_compression_get_utf8_string_size(
 			  entry_data,
 			  entry_data_size,
@@ -1007,11 +1025,27 @@ int libesedb_multi_value_get_value_utf8_string_size(
 	}
 	else
 	{
-		result = libfvalue_value_get_utf8_string_size(
-			  internal_multi_value->record_value,
-			  multi_value_index,
-			  utf8_string_size,
-			  error );
+		/* Codepage 1200 strings are converted directly if they are UTF-16 little-endian
+		 * without surrogates, otherwise they are converted by libfvalue
+		 */
+		result = 0;
+
+		if( encoding == LIBFVALUE_CODEPAGE_1200_MIXED )
+		{
+			result = libesedb_unicode_utf8_string_size_from_utf16_stream(
+			          entry_data,
+			          entry_data_size,
+			          utf8_string_size,
+			          error );
+		}
+		if( result == 0 )
+		{
+			result = libfvalue_value_get_utf8_string_size(
+				  internal_multi_value->record_value,
+				  multi_value_index,
+				  utf8_string_size,
+				  error );
+		}
 	}
 	if( result != 1 )
 	{
@@ -1102,27 +1136,27 @@ int libesedb_multi_value_get_value_utf8_string(
 
 		return( -1 );
 	}
+	if( libfvalue_value_get_entry_data(
+	     internal_multi_value->record_value,
+	     multi_value_index,
+	     &entry_data,
+	     &entry_data_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value entry: %d data.",
+		 function,
+		 multi_value_index );
+
+		return( -1 );
+	}
 	if( ( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
 	 && ( multi_value_index == 0 ) )
 	{
-		if( libfvalue_value_get_entry_data(
-		     internal_multi_value->record_value,
-		     multi_value_index,
-		     &entry_data,
-		     &entry_data_size,
-		     &encoding,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record value entry: %d data.",
-			 function,
-			 multi_value_index );
-
-			return( -1 );
-		}
 		result = libesedb_compression_copy_to_utf8_string(
 			  entry_data,
 			  entry_data_size,
@@ -1132,12 +1166,29 @@ int libesedb_multi_value_get_value_utf8_string(
 	}
 	else
 	{
-		result = libfvalue_value_copy_to_utf8_string(
-			  internal_multi_value->record_value,
-			  multi_value_index,
-			  utf8_string,
-			  utf8_string_size,
-			  error );
+		/* Codepage 1200 strings are converted directly if they are UTF-16 little-endian
+		 * without surrogates, otherwise they are converted by libfvalue
+		 */
+		result = 0;
+
+		if( encoding == LIBFVALUE_CODEPAGE_1200_MIXED )
+		{
+			result = libesedb_unicode_utf8_string_copy_from_utf16_stream(
+			          utf8_string,
+			          utf8_string_size,
+			          entry_data,
+			          entry_data_size,
+			          error );
+		}
+		if( result == 0 )
+		{
+			result = libfvalue_value_copy_to_utf8_string(
+				  internal_multi_value->record_value,
+				  multi_value_index,
+				  utf8_string,
+				  utf8_string_size,
+				  error );
+		}
 	}
 	if( result != 1 )
 	{
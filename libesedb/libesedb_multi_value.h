@@ -44,6 +44,7 @@ struct libesedb_internal_multi_value
 	libesedb_catalog_definition_t *column_catalog_definition;
 
 	/* The record value
+	 * This is a copy of the record value that remains valid when the record is reused
 	 */
 	libfvalue_value_t *record_value;
 };
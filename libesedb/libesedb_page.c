@@ -263,7 +263,8 @@ int libesedb_page_free(
 
 			result = -1;
 		}
-		if( ( *page )->data != NULL )
+		if( ( ( *page )->data != NULL )
+		 && ( ( *page )->data_is_mapped == 0 ) )
 		{
 			memory_free(
 			 ( *page )->data );
@@ -276,6 +277,130 @@ int libesedb_page_free(
 	return( result );
 }
 
+/* Verifies the checksums of page data with an extended page header
+ * The page data is divided into 4 blocks that each have an ECC-32 and XOR-32 checksum.
+ * The checksum of the first block is stored at the start of the page header and is
+ * calculated from offset 8. The checksums of the other blocks are stored in the extended
+ * page header. The page number is the initial value of the XOR-32 of every block
+ * Returns 1 if the checksums match, 0 if not or -1 on error
+ */
+int libesedb_page_verify_extended_checksums(
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t page_number,
+     libcerror_error_t **error )
+{
+	const uint8_t *stored_checksum_data = NULL;
+	static char *function               = "libesedb_page_verify_extended_checksums";
+	size_t block_offset                 = 0;
+	size_t block_size                   = 0;
+	uint32_t calculated_ecc32_checksum  = 0;
+	uint32_t calculated_xor32_checksum  = 0;
+	uint32_t stored_ecc32_checksum      = 0;
+	uint32_t stored_xor32_checksum      = 0;
+	int block_index                     = 0;
+
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_data_size < ( sizeof( esedb_page_header_t ) + sizeof( esedb_extended_page_header_t ) ) )
+	 || ( page_data_size > (size_t) SSIZE_MAX )
+	 || ( ( page_data_size % 64 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	block_size = page_data_size / 4;
+
+	for( block_index = 0;
+	     block_index < 4;
+	     block_index++ )
+	{
+		if( block_index == 0 )
+		{
+			stored_checksum_data = page_data;
+		}
+		else if( block_index == 1 )
+		{
+			stored_checksum_data = ( (esedb_extended_page_header_t *) &( page_data[ sizeof( esedb_page_header_t ) ] ) )->checksum1;
+		}
+		else if( block_index == 2 )
+		{
+			stored_checksum_data = ( (esedb_extended_page_header_t *) &( page_data[ sizeof( esedb_page_header_t ) ] ) )->checksum2;
+		}
+		else
+		{
+			stored_checksum_data = ( (esedb_extended_page_header_t *) &( page_data[ sizeof( esedb_page_header_t ) ] ) )->checksum3;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 stored_checksum_data,
+		 stored_xor32_checksum );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( stored_checksum_data[ 4 ] ),
+		 stored_ecc32_checksum );
+
+		if( libesedb_checksum_calculate_little_endian_ecc32(
+		     &calculated_ecc32_checksum,
+		     &calculated_xor32_checksum,
+		     &( page_data[ block_offset ] ),
+		     block_size,
+		     ( block_index == 0 ) ? 8 : 0,
+		     page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unable to calculate block: %d ECC-32 and XOR-32 checksum.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( stored_xor32_checksum != calculated_xor32_checksum )
+			 || ( stored_ecc32_checksum != calculated_ecc32_checksum ) )
+			{
+				libcnotify_printf(
+				 "%s: mismatch in page: %" PRIu32 " block: %d ECC-32 and XOR-32 checksum ( 0x%08" PRIx32 "%08" PRIx32 " != 0x%08" PRIx32 "%08" PRIx32 " ).\n",
+				 function,
+				 page_number,
+				 block_index,
+				 stored_ecc32_checksum,
+				 stored_xor32_checksum,
+				 calculated_ecc32_checksum,
+				 calculated_xor32_checksum );
+			}
+		}
+#endif
+		if( ( stored_xor32_checksum != calculated_xor32_checksum )
+		 || ( stored_ecc32_checksum != calculated_ecc32_checksum ) )
+		{
+			return( 0 );
+		}
+		block_offset += block_size;
+	}
+	return( 1 );
+}
+
 /* Reads a page and its values
  * Returns 1 if successful or -1 on error
  */
@@ -286,24 +411,26 @@ int libesedb_page_read(
      off64_t file_offset,
      libcerror_error_t **error )
 {
-	libcdata_array_t *page_tags_array  = NULL;
-	uint8_t *page_values_data          = NULL;
-	static char *function              = "libesedb_page_read";
-	size_t page_values_data_offset     = 0;
-	size_t page_values_data_size       = 0;
-	ssize_t read_count                 = 0;
-	uint32_t calculated_ecc32_checksum = 0;
-	uint32_t calculated_page_number    = 0;
-	uint32_t calculated_xor32_checksum = 0;
-	uint32_t stored_ecc32_checksum     = 0;
-	uint32_t stored_page_number        = 0;
-	uint32_t stored_xor32_checksum     = 0;
-	uint16_t available_data_size       = 0;
-	uint16_t available_page_tag        = 0;
+	libcdata_array_t *page_tags_array    = NULL;
+	uint8_t *page_values_data            = NULL;
+	static char *function                = "libesedb_page_read";
+	size_t page_values_data_offset       = 0;
+	size_t page_values_data_size         = 0;
+	ssize_t read_count                   = 0;
+	uint64_t stored_extended_page_number = 0;
+	uint32_t calculated_ecc32_checksum   = 0;
+	uint32_t calculated_page_number      = 0;
+	uint32_t calculated_xor32_checksum   = 0;
+	uint32_t stored_ecc32_checksum       = 0;
+	uint32_t stored_page_number          = 0;
+	uint32_t stored_xor32_checksum       = 0;
+	uint16_t available_data_size         = 0;
+	uint16_t available_page_tag          = 0;
+	int result                           = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit               = 0;
-	uint16_t value_16bit               = 0;
+	uint64_t value_64bit                 = 0;
+	uint16_t value_16bit                 = 0;
 #endif
 
 	if( page == NULL )
@@ -354,54 +481,78 @@ int libesedb_page_read(
 		 page->offset );
 	}
 #endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     page->offset,
-	     SEEK_SET,
-	     error ) == -1 )
+#if defined( HAVE_LIBESEDB_MEMORY_MAPPED_IO )
+	if( io_handle->mapped_data != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek page offset: %" PRIi64 ".",
-		 function,
-		 page->offset );
+		if( ( page->offset < 0 )
+		 || ( (size64_t) page->offset > io_handle->mapped_data_size )
+		 || ( (size64_t) io_handle->page_size > ( io_handle->mapped_data_size - (size64_t) page->offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page offset value out of bounds.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		page->data           = &( io_handle->mapped_data[ page->offset ] );
+		page->data_size      = (size_t) io_handle->page_size;
+		page->data_is_mapped = 1;
 	}
-	page->data = (uint8_t *) memory_allocate(
-	                          (size_t) io_handle->page_size );
-
-	if( page->data == NULL )
+	else
+#endif /* defined( HAVE_LIBESEDB_MEMORY_MAPPED_IO ) */
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create page data.",
-		 function );
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     page->offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek page offset: %" PRIi64 ".",
+			 function,
+			 page->offset );
 
-		goto on_error;
-	}
-	page->data_size = (size_t) io_handle->page_size;
+			goto on_error;
+		}
+		page->data = (uint8_t *) memory_allocate(
+		                          (size_t) io_handle->page_size );
 
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              page->data,
-	              page->data_size,
-	              error );
+		if( page->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page data.",
+			 function );
 
-	if( read_count != (ssize_t) page->data_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read page data.",
-		 function );
+			goto on_error;
+		}
+		page->data_size = (size_t) io_handle->page_size;
 
-		goto on_error;
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              page->data,
+		              page->data_size,
+		              error );
+
+		if( read_count != (ssize_t) page->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page data.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	page_values_data      = page->data;
 	page_values_data_size = page->data_size;
@@ -447,7 +598,8 @@ int libesedb_page_read(
 	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
 	 && ( io_handle->page_size >= 16384 ) )
 	{
-		/* TODO handle checksum */
+		/* The block checksums are read by libesedb_page_verify_extended_checksums
+		 */
 	}
 	else
 	{
@@ -570,8 +722,8 @@ int libesedb_page_read(
 		 "\n" );
 	}
 #endif
-	/* TODO for now don't bother calculating a checksum for uninitialized pages */
-
+	/* TODO for now don't bother calculating a checksum for uninitialized pages
+	 */
 	if( ( page_values_data[ 0 ] != 0 )
 	 || ( page_values_data[ 1 ] != 0 )
 	 || ( page_values_data[ 2 ] != 0 )
@@ -580,7 +732,81 @@ int libesedb_page_read(
 		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
 		 && ( io_handle->page_size >= 16384 ) )
 		{
-			/* TODO handle checksum */
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (esedb_extended_page_header_t *) &( page_values_data[ sizeof( esedb_page_header_t ) ] ) )->page_number,
+			 stored_extended_page_number );
+
+			if( stored_extended_page_number != (uint64_t) calculated_page_number )
+			{
+				if( io_handle->verify_checksums != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_INPUT,
+					 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+					 "%s: mismatch in page: %" PRIu32 " page number ( %" PRIu64 " != %" PRIu32 " ).",
+					 function,
+					 calculated_page_number,
+					 stored_extended_page_number,
+					 calculated_page_number );
+
+					goto on_error;
+				}
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: mismatch in page number ( %" PRIu64 " != %" PRIu32 " ).\n",
+					 function,
+					 stored_extended_page_number,
+					 calculated_page_number );
+				}
+			}
+			/* The checksums of the blocks of a page with an extended page header are only
+			 * calculated when they are verified or reported
+			 */
+			if( ( io_handle->verify_checksums != 0 )
+			 || ( libcnotify_verbose != 0 ) )
+			{
+				result = libesedb_page_verify_extended_checksums(
+				          page_values_data,
+				          page_values_data_size,
+				          calculated_page_number,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unable to verify page: %" PRIu32 " block checksums.",
+					 function,
+					 calculated_page_number );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					if( io_handle->verify_checksums != 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_INPUT,
+						 LIBCERROR_INPUT_ERROR_CRC_MISMATCH,
+						 "%s: mismatch in page: %" PRIu32 " block ECC-32 and XOR-32 checksums.",
+						 function,
+						 calculated_page_number );
+
+						goto on_error;
+					}
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: mismatch in page block ECC-32 and XOR-32 checksums.\n",
+						 function );
+					}
+				}
+			}
 		}
 		else if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_NEW_RECORD_FORMAT )
 		      && ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT ) != 0 ) )
@@ -622,21 +848,50 @@ int libesedb_page_read(
 
 				goto on_error;
 			}
+			/* A page that was written at another offset can have a valid XOR-32
+			 */
+			if( stored_page_number != calculated_page_number )
+			{
+				if( io_handle->verify_checksums != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_INPUT,
+					 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+					 "%s: mismatch in page: %" PRIu32 " page number ( %" PRIu32 " != %" PRIu32 " ).",
+					 function,
+					 calculated_page_number,
+					 stored_page_number,
+					 calculated_page_number );
+
+					goto on_error;
+				}
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: mismatch in page number ( %" PRIu32 " != %" PRIu32 " ).\n",
+					 function,
+					 stored_page_number,
+					 calculated_page_number );
+				}
+			}
 		}
 		if( stored_xor32_checksum != calculated_xor32_checksum )
 		{
-#ifdef TODO
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_INPUT,
-			 LIBCERROR_INPUT_ERROR_CRC_MISMATCH,
-			 "%s: mismatch in page XOR-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
-			 function,
-			 stored_xor32_checksum,
-			 calculated_xor32_checksum );
+			if( io_handle->verify_checksums != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_CRC_MISMATCH,
+				 "%s: mismatch in page: %" PRIu32 " XOR-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+				 function,
+				 calculated_page_number,
+				 stored_xor32_checksum,
+				 calculated_xor32_checksum );
 
-			goto on_error;
-#else
+				goto on_error;
+			}
 			if( libcnotify_verbose != 0 )
 			{
 				libcnotify_printf(
@@ -645,22 +900,23 @@ int libesedb_page_read(
 				 stored_xor32_checksum,
 				 calculated_xor32_checksum );
 			}
-#endif
 		}
 		if( stored_ecc32_checksum != calculated_ecc32_checksum )
 		{
-#ifdef TODO
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_INPUT,
-			 LIBCERROR_INPUT_ERROR_CRC_MISMATCH,
-			 "%s: mismatch in page ECC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
-			 function,
-			 stored_ecc32_checksum,
-			 calculated_ecc32_checksum );
+			if( io_handle->verify_checksums != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_CRC_MISMATCH,
+				 "%s: mismatch in page: %" PRIu32 " ECC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+				 function,
+				 calculated_page_number,
+				 stored_ecc32_checksum,
+				 calculated_ecc32_checksum );
 
-			goto on_error;
-#else
+				goto on_error;
+			}
 			if( libcnotify_verbose != 0 )
 			{
 				libcnotify_printf(
@@ -669,7 +925,6 @@ int libesedb_page_read(
 				 stored_ecc32_checksum,
 				 calculated_ecc32_checksum );
 			}
-#endif
 		}
 	}
 	page_values_data        += sizeof( esedb_page_header_t );
@@ -821,10 +1076,349 @@ on_error:
 	}
 	if( page->data != NULL )
 	{
-		memory_free(
-		 page->data );
+		if( page->data_is_mapped == 0 )
+		{
+			memory_free(
+			 page->data );
+		}
+		page->data           = NULL;
+		page->data_is_mapped = 0;
+	}
+	return( -1 );
+}
+
+/* Verifies page data
+ * The page data is not modified and no file IO is done, which makes this function
+ * safe to call concurrently for different page data once the checksum instruction set
+ * has been initialized, see libesedb_file_open_read
+ * Returns 1 if the page is valid, 0 if the page is corrupt or -1 on error
+ */
+int libesedb_page_verify_data(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t *father_data_page_object_identifier,
+     uint32_t *corruption_flags,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *page_tags_array           = NULL;
+	libesedb_page_tags_value_t *page_tags_value = NULL;
+	static char *function                       = "libesedb_page_verify_data";
+	size_t page_values_data_size                = 0;
+	uint64_t stored_extended_page_number        = 0;
+	uint32_t calculated_ecc32_checksum          = 0;
+	uint32_t calculated_xor32_checksum          = 0;
+	uint32_t page_flags                         = 0;
+	uint32_t stored_ecc32_checksum              = 0;
+	uint32_t stored_page_number                 = 0;
+	uint32_t stored_xor32_checksum              = 0;
+	uint32_t safe_corruption_flags              = 0;
+	uint16_t available_page_tag                 = 0;
+	int page_tags_index                         = 0;
+	int result                                  = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->page_size == 0 )
+	 || ( page_data_size != (size_t) io_handle->page_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( father_data_page_object_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid father data page object identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( corruption_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid corruption flags.",
+		 function );
+
+		return( -1 );
+	}
+	*father_data_page_object_identifier = 0;
+	*corruption_flags                   = 0;
+
+	/* Uninitialized pages have no checksum, see libesedb_page_read
+	 */
+	if( ( page_data[ 0 ] == 0 )
+	 && ( page_data[ 1 ] == 0 )
+	 && ( page_data[ 2 ] == 0 )
+	 && ( page_data[ 3 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->father_data_page_object_identifier,
+	 *father_data_page_object_identifier );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_page_header_t *) page_data )->available_page_tag,
+	 available_page_tag );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->page_flags,
+	 page_flags );
+
+	page_values_data_size = page_data_size - sizeof( esedb_page_header_t );
+
+	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( io_handle->page_size >= 16384 ) )
+	{
+		result = libesedb_page_verify_extended_checksums(
+		          page_data,
+		          page_data_size,
+		          page_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unable to verify block checksums.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			safe_corruption_flags |= LIBESEDB_PAGE_CORRUPTION_FLAG_CHECKSUM_MISMATCH;
+		}
+		result = 0;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (esedb_extended_page_header_t *) &( page_data[ sizeof( esedb_page_header_t ) ] ) )->page_number,
+		 stored_extended_page_number );
+
+		if( stored_extended_page_number != (uint64_t) page_number )
+		{
+			safe_corruption_flags |= LIBESEDB_PAGE_CORRUPTION_FLAG_PAGE_NUMBER_MISMATCH;
+		}
+		page_values_data_size -= sizeof( esedb_extended_page_header_t );
+	}
+	else
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_page_header_t *) page_data )->xor_checksum,
+		 stored_xor32_checksum );
+
+		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_NEW_RECORD_FORMAT )
+		 && ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT ) != 0 ) )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (esedb_page_header_t *) page_data )->ecc_checksum,
+			 stored_ecc32_checksum );
+
+			/* The page number is part of the checksum
+			 */
+			if( libesedb_checksum_calculate_little_endian_ecc32(
+			     &calculated_ecc32_checksum,
+			     &calculated_xor32_checksum,
+			     page_data,
+			     page_data_size,
+			     8,
+			     page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unable to calculate ECC-32 and XOR-32 checksum.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (esedb_page_header_t *) page_data )->page_number,
+			 stored_page_number );
 
-		page->data = NULL;
+			if( stored_page_number != page_number )
+			{
+				safe_corruption_flags |= LIBESEDB_PAGE_CORRUPTION_FLAG_PAGE_NUMBER_MISMATCH;
+			}
+			if( libesedb_checksum_calculate_little_endian_xor32(
+			     &calculated_xor32_checksum,
+			     &( page_data[ 4 ] ),
+			     page_data_size - 4,
+			     0x89abcdef,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unable to calculate XOR-32 checksum.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( stored_xor32_checksum != calculated_xor32_checksum )
+		 || ( stored_ecc32_checksum != calculated_ecc32_checksum ) )
+		{
+			safe_corruption_flags |= LIBESEDB_PAGE_CORRUPTION_FLAG_CHECKSUM_MISMATCH;
+		}
+	}
+	if( available_page_tag > 0 )
+	{
+		if( libcdata_array_initialize(
+		     &page_tags_array,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create page tags array.",
+			 function );
+
+			goto on_error;
+		}
+		/* The page tags are stored at the end of the page values data
+		 */
+		if( ( 4 * (size_t) available_page_tag ) > page_values_data_size )
+		{
+			safe_corruption_flags |= LIBESEDB_PAGE_CORRUPTION_FLAG_INVALID_PAGE_TAGS;
+		}
+		else if( libesedb_page_read_tags(
+		          page_tags_array,
+		          io_handle,
+		          available_page_tag,
+		          (uint8_t *) page_data,
+		          page_data_size,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page tags.",
+			 function );
+
+			goto on_error;
+		}
+		else
+		{
+			page_values_data_size -= 4 * (size_t) available_page_tag;
+
+			/* The offsets in the page tags are relative after the page header
+			 */
+			for( page_tags_index = 0;
+			     page_tags_index < (int) available_page_tag;
+			     page_tags_index++ )
+			{
+				if( libcdata_array_get_entry_by_index(
+				     page_tags_array,
+				     page_tags_index,
+				     (intptr_t **) &page_tags_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve page tag: %d.",
+					 function,
+					 page_tags_index );
+
+					goto on_error;
+				}
+				if( page_tags_value == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing page tag: %d.",
+					 function,
+					 page_tags_index );
+
+					goto on_error;
+				}
+				if( ( (size_t) page_tags_value->offset > page_values_data_size )
+				 || ( (size_t) page_tags_value->size > ( page_values_data_size - page_tags_value->offset ) ) )
+				{
+					safe_corruption_flags |= LIBESEDB_PAGE_CORRUPTION_FLAG_INVALID_PAGE_TAGS;
+
+					break;
+				}
+			}
+		}
+		if( libcdata_array_free(
+		     &page_tags_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_tags_value_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free the page tags array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*corruption_flags = safe_corruption_flags;
+
+	if( safe_corruption_flags == 0 )
+	{
+		result = 1;
+	}
+	return( result );
+
+on_error:
+	if( page_tags_array != NULL )
+	{
+		libcdata_array_free(
+		 &page_tags_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_tags_value_free,
+		 NULL );
 	}
 	return( -1 );
 }
@@ -1251,11 +1845,11 @@ int libesedb_page_read_values(
 		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
 		 && ( io_handle->page_size >= 16384 ) )
 		{
-			/* The page tags flags are stored in the upper byte of the first 16-bit value
+			/* The page tags flags are stored in the upper 3 bits of the first 16-bit value.
+			 * The page values data is not modified since it can be shared by the memory map,
+			 * the readers of the key size mask the flags instead.
 			 */
 			page_tags_value->flags = page_values_data[ page_tags_value->offset + 1 ] >> 5;
-
-			page_values_data[ page_tags_value->offset + 1 ] &= 0x1f;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
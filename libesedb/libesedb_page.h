@@ -84,6 +84,10 @@ struct libesedb_page
 	 */
 	size_t data_size;
 
+	/* Value to indicate the page data references memory mapped file data
+	 */
+	uint8_t data_is_mapped;
+
 	/* The file offset of the page
 	 */
 	off64_t offset;
@@ -109,6 +113,12 @@ int libesedb_page_free(
      libesedb_page_t **page,
      libcerror_error_t **error );
 
+int libesedb_page_verify_extended_checksums(
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
 int libesedb_page_read(
      libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
@@ -116,6 +126,15 @@ int libesedb_page_read(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libesedb_page_verify_data(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t *father_data_page_object_identifier,
+     uint32_t *corruption_flags,
+     libcerror_error_t **error );
+
 int libesedb_page_read_tags(
      libcdata_array_t *page_tags_array,
      libesedb_io_handle_t *io_handle,
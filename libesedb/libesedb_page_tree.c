@@ -770,6 +770,10 @@ int libesedb_page_tree_read_space_tree_page(
 			 page_value_data,
 			 key_size );
 
+			/* The upper 3 bits of the first key size value can contain the page tag flags
+			 */
+			key_size &= 0x1fff;
+
 			page_value_data += 2;
 			page_value_size -= 2;
 
@@ -1314,6 +1318,10 @@ int libesedb_page_tree_read_page(
 			 page_value_data,
 			 common_key_size );
 
+			/* The upper 3 bits of the first key size value can contain the page tag flags
+			 */
+			common_key_size &= 0x1fff;
+
 			page_value_data   += 2;
 			page_value_offset += 2;
 			page_value_size   -= 2;
@@ -1385,6 +1393,8 @@ int libesedb_page_tree_read_page(
 		 page_value_data,
 		 local_key_size );
 
+		local_key_size &= 0x1fff;
+
 		page_value_data   += 2;
 		page_value_offset += 2;
 		page_value_size   -= 2;
@@ -39,12 +39,15 @@
 #include "libesedb_long_value.h"
 #include "libesedb_multi_value.h"
 #include "libesedb_record.h"
+#include "libesedb_record_layout.h"
 #include "libesedb_record_value.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
+#include "libesedb_value_data_handle.h"
 
 /* Creates a record
  * Make sure the value record is referencing, is set to NULL
+ * The column projection is optional, if set only the values of the projected columns are read
  * Returns 1 if successful or -1 on error
  */
 int libesedb_record_initialize(
@@ -60,6 +63,7 @@ int libesedb_record_initialize(
      libesedb_data_definition_t *data_definition,
      libfdata_btree_t *long_values_tree,
      libfcache_cache_t *long_values_cache,
+     const uint8_t *column_projection,
      libcerror_error_t **error )
 {
 	libesedb_internal_record_t *internal_record = NULL;
@@ -109,6 +113,17 @@ int libesedb_record_initialize(
 
 		return( -1 );
 	}
+	if( table_definition->record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing record layout.",
+		 function );
+
+		return( -1 );
+	}
 	internal_record = memory_allocate_structure(
 	                   libesedb_internal_record_t );
 
@@ -140,6 +155,18 @@ int libesedb_record_initialize(
 
 		return( -1 );
 	}
+	internal_record->file_io_handle            = file_io_handle;
+	internal_record->io_handle                 = io_handle;
+	internal_record->table_definition          = table_definition;
+	internal_record->template_table_definition = template_table_definition;
+	internal_record->pages_vector              = pages_vector;
+	internal_record->pages_cache               = pages_cache;
+	internal_record->long_values_pages_vector  = long_values_pages_vector;
+	internal_record->long_values_pages_cache   = long_values_pages_cache;
+	internal_record->long_values_tree          = long_values_tree;
+	internal_record->long_values_cache         = long_values_cache;
+	internal_record->uncompressed_value_entry  = -1;
+
 	if( libcdata_array_initialize(
 	     &( internal_record->values_array ),
 	     0,
@@ -154,38 +181,38 @@ int libesedb_record_initialize(
 
 		goto on_error;
 	}
-	if( libesedb_data_definition_read_record(
+	if( table_definition->record_layout->number_of_columns > 0 )
+	{
+		internal_record->data_type_values = (libesedb_data_type_value_t *) memory_allocate(
+		                                                                    sizeof( libesedb_data_type_value_t ) * table_definition->record_layout->number_of_columns );
+
+		if( internal_record->data_type_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data type values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_record_read(
+	     internal_record,
 	     data_definition,
-	     file_io_handle,
-	     io_handle,
-	     pages_vector,
-	     pages_cache,
-	     table_definition,
-	     template_table_definition,
-	     internal_record->values_array,
-	     &( internal_record->flags ),
+	     column_projection,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read data definition record.",
+		 "%s: unable to read record.",
 		 function );
 
 		goto on_error;
 	}
-	internal_record->file_io_handle            = file_io_handle;
-	internal_record->io_handle                 = io_handle;
-	internal_record->table_definition          = table_definition;
-	internal_record->template_table_definition = template_table_definition;
-	internal_record->pages_vector              = pages_vector;
-	internal_record->pages_cache               = pages_cache;
-	internal_record->long_values_pages_vector  = long_values_pages_vector;
-	internal_record->long_values_pages_cache   = long_values_pages_cache;
-	internal_record->long_values_tree          = long_values_tree;
-	internal_record->long_values_cache         = long_values_cache;
-
 	*record = (libesedb_record_t *) internal_record;
 
 	return( 1 );
@@ -197,9 +224,24 @@ on_error:
 		{
 			libcdata_array_free(
 			 &( internal_record->values_array ),
-			 NULL,
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
 			 NULL );
 		}
+		if( internal_record->data_type_values != NULL )
+		{
+			memory_free(
+			 internal_record->data_type_values );
+		}
+		if( internal_record->values_data != NULL )
+		{
+			memory_free(
+			 internal_record->values_data );
+		}
+		if( internal_record->uncompressed_data != NULL )
+		{
+			memory_free(
+			 internal_record->uncompressed_data );
+		}
 		memory_free(
 		 internal_record );
 	}
@@ -251,24 +293,45 @@ int libesedb_record_free(
 
 			result = -1;
 		}
+		if( internal_record->data_type_values != NULL )
+		{
+			memory_free(
+			 internal_record->data_type_values );
+		}
+		/* The values data is referenced by the values and is freed after the values array
+		 */
+		if( internal_record->values_data != NULL )
+		{
+			memory_free(
+			 internal_record->values_data );
+		}
+		if( internal_record->uncompressed_data != NULL )
+		{
+			memory_free(
+			 internal_record->uncompressed_data );
+		}
 		memory_free(
 		 internal_record );
 	}
 	return( result );
 }
 
-/* Retrieves the number of values in the record
+/* Reads the record from the data definition
+ * The values of a previously read record are freed, the values array, the data type values,
+ * the values data and the uncompressed data of the record are reused
+ * The column projection is optional, if set only the values of the projected columns are read
  * Returns 1 if successful or -1 on error
  */
-int libesedb_record_get_number_of_values(
-     libesedb_record_t *record,
-     int *number_of_values,
+int libesedb_record_read(
+     libesedb_internal_record_t *internal_record,
+     libesedb_data_definition_t *data_definition,
+     const uint8_t *column_projection,
      libcerror_error_t **error )
 {
-	libesedb_internal_record_t *internal_record = NULL;
-	static char *function                       = "libesedb_record_get_number_of_values";
+	libesedb_record_layout_t *record_layout = NULL;
+	static char *function                   = "libesedb_record_read";
 
-	if( record == NULL )
+	if( internal_record == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -279,18 +342,84 @@ int libesedb_record_get_number_of_values(
 
 		return( -1 );
 	}
-	internal_record = (libesedb_internal_record_t *) record;
+	if( internal_record->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing table definition.",
+		 function );
 
-	if( libcdata_array_get_number_of_entries(
+		return( -1 );
+	}
+	record_layout = internal_record->table_definition->record_layout;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - invalid table definition - missing record layout.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record->uncompressed_value_entry = -1;
+	internal_record->uncompressed_data_size   = 0;
+
+	/* Emptying and resizing the values array does not reallocate the entries
+	 * if the number of columns does not change
+	 */
+	if( libcdata_array_empty(
 	     internal_record->values_array,
-	     number_of_values,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from values array.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_resize(
+	     internal_record->values_array,
+	     record_layout->number_of_columns,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_read_record(
+	     data_definition,
+	     internal_record->file_io_handle,
+	     internal_record->io_handle,
+	     internal_record->pages_vector,
+	     internal_record->pages_cache,
+	     record_layout,
+	     column_projection,
+	     internal_record->data_type_values,
+	     &( internal_record->values_data ),
+	     &( internal_record->values_data_size ),
+	     &( internal_record->flags ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data definition record.",
 		 function );
 
 		return( -1 );
@@ -298,17 +427,24 @@ int libesedb_record_get_number_of_values(
 	return( 1 );
 }
 
-/* Retrieves the column catalog definition of the specific entry
- * Returns 1 if successful or -1 on error
+/* Creates the value of the specific entry from the data type value
+ * The value data flags determine if the value data is copied or references the values data
+ * Returns 1 if successful, 0 if the value is not set or -1 on error
  */
-int libesedb_record_get_column_catalog_definition(
+int libesedb_record_initialize_record_value(
      libesedb_internal_record_t *internal_record,
      int value_entry,
-     libesedb_catalog_definition_t **column_catalog_definition,
+     uint8_t value_data_flags,
+     libfvalue_value_t **record_value,
      libcerror_error_t **error )
 {
-	static char *function                = "libesedb_record_get_column_identifier";
-	int template_table_number_of_columns = 0;
+	libesedb_data_type_value_t *data_type_value           = NULL;
+	libesedb_record_layout_t *record_layout               = NULL;
+	libesedb_record_layout_column_t *record_layout_column = NULL;
+	libfvalue_data_handle_t *value_data_handle            = NULL;
+	libfvalue_value_t *safe_record_value                  = NULL;
+	static char *function                                 = "libesedb_record_initialize_record_value";
+	int encoding                                          = 0;
 
 	if( internal_record == NULL )
 	{
@@ -321,6 +457,17 @@ int libesedb_record_get_column_catalog_definition(
 
 		return( -1 );
 	}
+	if( internal_record->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_record->table_definition == NULL )
 	{
 		libcerror_error_set(
@@ -332,59 +479,712 @@ int libesedb_record_get_column_catalog_definition(
 
 		return( -1 );
 	}
-	if( internal_record->template_table_definition != NULL )
+	record_layout = internal_record->table_definition->record_layout;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - invalid table definition - missing record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_entry < 0 )
+	 || ( value_entry >= record_layout->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data type values contain an entry per column of the record layout
+	 */
+	data_type_value = &( internal_record->data_type_values[ value_entry ] );
+
+	/* Values of columns that are not projected are not set
+	 */
+	if( data_type_value->is_set == 0 )
+	{
+		return( 0 );
+	}
+	record_layout_column = &( record_layout->columns[ value_entry ] );
+
+	if( record_layout_column->value_type == LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM )
+	{
+		encoding = record_layout_column->codepage;
+
+		/* If the codepage is not set use the default codepage
+		 */
+		if( encoding == 0 )
+		{
+			encoding = internal_record->io_handle->ascii_codepage;
+
+			/* Codepage 1200 in the ESE database format is not strict UTF-16 little endian
+			 * it can be used for ASCII strings as well. This could be SCSU.
+			 */
+			if( encoding == 1200 )
+			{
+				encoding = LIBFVALUE_CODEPAGE_1200_MIXED;
+			}
+		}
+	}
+	else
+	{
+		encoding = LIBFVALUE_ENDIAN_LITTLE;
+	}
+	if( libfvalue_data_handle_initialize(
+	     &value_data_handle,
+	     (int (*)(libfvalue_data_handle_t *, const uint8_t *, size_t, int, uint32_t, libcerror_error_t **)) &libesedb_value_data_handle_read_value_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( data_type_value->data_size > 0 )
 	{
-		if( libcdata_list_get_number_of_elements(
-		     internal_record->template_table_definition->column_catalog_definition_list,
-		     &template_table_number_of_columns,
+		if( libfvalue_data_handle_set_data(
+		     value_data_handle,
+		     &( internal_record->values_data[ data_type_value->data_offset ] ),
+		     (size_t) data_type_value->data_size,
+		     encoding,
+		     value_data_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of columns from template table.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data in value data handle.",
 			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+	}
+	if( data_type_value->data_flags != 0 )
+	{
+		if( libfvalue_data_handle_set_data_flags(
+		     value_data_handle,
+		     (uint32_t) data_type_value->data_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data flags in value data handle.",
+			 function );
+
+			goto on_error;
 		}
 	}
-	if( value_entry < template_table_number_of_columns )
+	if( libfvalue_value_type_initialize_with_data_handle(
+	     &safe_record_value,
+	     record_layout_column->value_type,
+	     value_data_handle,
+	     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record value.",
+		 function );
+
+		goto on_error;
+	}
+	*record_value = safe_record_value;
+
+	return( 1 );
+
+on_error:
+	if( value_data_handle != NULL )
+	{
+		libfvalue_data_handle_free(
+		 &value_data_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the value of the specific entry
+ * The value is created from the data type value when first retrieved and references
+ * the values data of the record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_record_value(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error )
+{
+	libfvalue_value_t *safe_record_value = NULL;
+	static char *function                = "libesedb_record_get_record_value";
+	int result                           = 0;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_record->values_array,
+	     value_entry,
+	     (intptr_t **) &safe_record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from values array.",
+		 function,
+		 value_entry );
+
+		goto on_error;
+	}
+	if( safe_record_value == NULL )
+	{
+		result = libesedb_record_initialize_record_value(
+		          internal_record,
+		          value_entry,
+		          LIBFVALUE_VALUE_DATA_FLAG_NON_MANAGED,
+		          &safe_record_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create value: %d.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libcdata_array_set_entry_by_index(
+			     internal_record->values_array,
+			     value_entry,
+			     (intptr_t *) safe_record_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set value: %d in values array.",
+				 function,
+				 value_entry );
+
+				goto on_error;
+			}
+		}
+	}
+	*record_value = safe_record_value;
+
+	return( 1 );
+
+on_error:
+	if( safe_record_value != NULL )
+	{
+		libfvalue_value_free(
+		 &safe_record_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Unsets the value of the specific entry
+ * The value is handled as the value of a column that is not projected
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_unset_record_value(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libcerror_error_t **error )
+{
+	libesedb_record_layout_t *record_layout = NULL;
+	libfvalue_value_t *record_value         = NULL;
+	static char *function                   = "libesedb_record_unset_record_value";
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_record->table_definition == NULL )
+	 || ( internal_record->table_definition->record_layout == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - invalid table definition - missing record layout.",
+		 function );
+
+		return( -1 );
+	}
+	record_layout = internal_record->table_definition->record_layout;
+
+	if( ( value_entry < 0 )
+	 || ( value_entry >= record_layout->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_record->values_array,
+	     value_entry,
+	     (intptr_t **) &record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from values array.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( record_value != NULL )
+	{
+		if( libcdata_array_set_entry_by_index(
+		     internal_record->values_array,
+		     value_entry,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value: %d in values array.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+		if( libfvalue_value_free(
+		     &record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value: %d.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+	}
+	if( internal_record->uncompressed_value_entry == value_entry )
+	{
+		internal_record->uncompressed_value_entry = -1;
+		internal_record->uncompressed_data_size   = 0;
+	}
+	internal_record->data_type_values[ value_entry ].is_set = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the uncompressed data of the specific entry
+ * The uncompressed data of the most recently uncompressed value is cached in the record
+ * so that retrieving the size and the data of a compressed value decompresses it only once
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_uncompressed_value_data(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     const uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_data_type_value_t *data_type_value = NULL;
+	libesedb_record_layout_t *record_layout     = NULL;
+	uint8_t *compressed_data                    = NULL;
+	uint8_t *reallocation                       = NULL;
+	static char *function                       = "libesedb_record_get_uncompressed_value_data";
+	size_t allocated_size                       = 0;
+	size_t safe_uncompressed_data_size          = 0;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	record_layout = internal_record->table_definition->record_layout;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - invalid table definition - missing record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_entry < 0 )
+	 || ( value_entry >= record_layout->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_record->uncompressed_data == NULL )
+	 || ( internal_record->uncompressed_value_entry != value_entry ) )
+	{
+		data_type_value = &( internal_record->data_type_values[ value_entry ] );
+
+		if( data_type_value->is_set == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing value: %d.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+		if( ( data_type_value->data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value: %d data flags: 0x%02" PRIx8 ".",
+			 function,
+			 value_entry,
+			 data_type_value->data_flags );
+
+			return( -1 );
+		}
+		compressed_data = &( internal_record->values_data[ data_type_value->data_offset ] );
+
+		/* Invalidate the cached uncompressed data in case decompression fails
+		 */
+		internal_record->uncompressed_value_entry = -1;
+		internal_record->uncompressed_data_size   = 0;
+
+		if( libesedb_compression_decompress_get_size(
+		     compressed_data,
+		     (size_t) data_type_value->data_size,
+		     &safe_uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d uncompressed data size.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+		if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value: %d uncompressed data size value out of bounds.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+		/* The uncompressed data is reused and only reallocated when it needs to grow
+		 * at least 1 byte is allocated so that empty uncompressed data is not NULL
+		 */
+		if( ( internal_record->uncompressed_data == NULL )
+		 || ( safe_uncompressed_data_size > internal_record->allocated_uncompressed_data_size ) )
+		{
+			allocated_size = safe_uncompressed_data_size;
+
+			if( allocated_size == 0 )
+			{
+				allocated_size = 1;
+			}
+			reallocation = (uint8_t *) memory_reallocate(
+			                            internal_record->uncompressed_data,
+			                            sizeof( uint8_t ) * allocated_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize uncompressed data.",
+				 function );
+
+				return( -1 );
+			}
+			internal_record->uncompressed_data                = reallocation;
+			internal_record->allocated_uncompressed_data_size = allocated_size;
+		}
+		if( safe_uncompressed_data_size > 0 )
+		{
+			if( libesedb_compression_decompress(
+			     compressed_data,
+			     (size_t) data_type_value->data_size,
+			     internal_record->uncompressed_data,
+			     safe_uncompressed_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress value: %d data.",
+				 function,
+				 value_entry );
+
+				return( -1 );
+			}
+		}
+		internal_record->uncompressed_value_entry = value_entry;
+		internal_record->uncompressed_data_size   = safe_uncompressed_data_size;
+	}
+	*uncompressed_data      = internal_record->uncompressed_data;
+	*uncompressed_data_size = internal_record->uncompressed_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of values in the record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_number_of_values(
+     libesedb_record_t *record,
+     int *number_of_values,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	static char *function                       = "libesedb_record_get_number_of_values";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_record->values_array,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from values array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the column catalog definition of the specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_column_catalog_definition(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error )
+{
+	libesedb_record_layout_t *record_layout = NULL;
+	static char *function                   = "libesedb_record_get_column_catalog_definition";
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	record_layout = internal_record->table_definition->record_layout;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - invalid table definition - missing record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_entry < 0 )
+	 || ( value_entry >= record_layout->number_of_columns ) )
 	{
-		if( libcdata_list_get_value_by_index(
-		     internal_record->template_table_definition->column_catalog_definition_list,
-		     value_entry,
-		     (intptr_t **) column_catalog_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column catalog definition from template table.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value entry value out of bounds.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	else
+	if( column_catalog_definition == NULL )
 	{
-		if( libcdata_list_get_value_by_index(
-		     internal_record->table_definition->column_catalog_definition_list,
-		     value_entry - template_table_number_of_columns,
-		     (intptr_t **) column_catalog_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column catalog definition from table.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
+	*column_catalog_definition = record_layout->columns[ value_entry ].column_catalog_definition;
+
 	return( 1 );
 }
 
@@ -648,6 +1448,78 @@ int libesedb_record_get_utf8_column_name(
 	return( 1 );
 }
 
+/* Retrieves the value entry for the specific UTF-8 encoded column name
+ * The names are looked up in a hash table that is built once per table definition
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_record_get_value_entry_by_utf8_column_name(
+     libesedb_record_t *record,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *value_entry,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	static char *function                       = "libesedb_record_get_value_entry_by_utf8_column_name";
+	int result                                  = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( internal_record->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_record_layout_get_column_index_by_utf8_name(
+	          internal_record->table_definition->record_layout,
+	          utf8_string,
+	          utf8_string_length,
+	          internal_record->io_handle->ascii_codepage,
+	          value_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column index from record layout.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size of the UTF-16 encoded string of the column name of the specific entry
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -833,10 +1705,10 @@ int libesedb_record_get_value(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -924,10 +1796,10 @@ int libesedb_record_get_value_data_flags(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -986,10 +1858,10 @@ int libesedb_record_get_value_data_size(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1047,10 +1919,10 @@ int libesedb_record_get_value_data(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1082,6 +1954,108 @@ int libesedb_record_get_value_data(
 	return( 1 );
 }
 
+/* Retrieves a pointer to the value data of the specific entry
+ * The value data is the data as stored in the record, it is not copied
+ * and remains valid until the record is freed or reused
+ * Returns 1 if successful, 0 if the value is not set or -1 on error
+ */
+int libesedb_record_get_value_data_pointer(
+     libesedb_record_t *record,
+     int value_entry,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_data_type_value_t *data_type_value = NULL;
+	libesedb_internal_record_t *internal_record = NULL;
+	static char *function                       = "libesedb_record_get_value_data_pointer";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->table_definition->record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - invalid table definition - missing record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_entry < 0 )
+	 || ( value_entry >= internal_record->table_definition->record_layout->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The value data is retrieved from the data type value without creating the value
+	 */
+	data_type_value = &( internal_record->data_type_values[ value_entry ] );
+
+	/* Values of columns that are not projected are not set
+	 */
+	if( ( data_type_value->is_set == 0 )
+	 || ( data_type_value->data_size == 0 ) )
+	{
+		return( 0 );
+	}
+	*value_data      = &( internal_record->values_data[ data_type_value->data_offset ] );
+	*value_data_size = (size_t) data_type_value->data_size;
+
+	return( 1 );
+}
+
 /* Retrieves the boolean value of a specific entry
  * Returns 1 if successful, 0 if value is NULL or -1 on error
  */
@@ -1152,10 +2126,10 @@ int libesedb_record_get_value_boolean(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1275,10 +2249,10 @@ int libesedb_record_get_value_8bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1399,10 +2373,10 @@ int libesedb_record_get_value_16bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1523,10 +2497,10 @@ int libesedb_record_get_value_32bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1648,10 +2622,10 @@ int libesedb_record_get_value_64bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1771,10 +2745,10 @@ int libesedb_record_get_value_filetime(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1896,10 +2870,10 @@ int libesedb_record_get_value_floating_point_32bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2019,10 +2993,10 @@ int libesedb_record_get_value_floating_point_64bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2083,9 +3057,12 @@ int libesedb_record_get_value_utf8_string_size(
      libcerror_error_t **error )
 {
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_data_type_value_t *data_type_value              = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *uncompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf8_string_size";
+	size_t uncompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
 
@@ -2144,26 +3121,63 @@ int libesedb_record_get_value_utf8_string_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
-	     value_entry,
-	     (intptr_t **) &record_value,
-	     error ) != 1 )
+	data_type_value = &( internal_record->data_type_values[ value_entry ] );
+
+	/* The uncompressed data of a compressed value is cached in the record
+	 * so that retrieving the string size and the string decompresses the value only once
+	 */
+	if( ( data_type_value->is_set != 0 )
+	 && ( data_type_value->data_size > 0 )
+	 && ( ( data_type_value->data_flags & ( LIBESEDB_VALUE_FLAG_COMPRESSED | LIBESEDB_VALUE_FLAG_LONG_VALUE | LIBESEDB_VALUE_FLAG_MULTI_VALUE ) ) == LIBESEDB_VALUE_FLAG_COMPRESSED ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
-		 function,
-		 value_entry );
+		if( libesedb_record_get_uncompressed_value_data(
+		     internal_record,
+		     value_entry,
+		     &uncompressed_data,
+		     &uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d uncompressed data.",
+			 function,
+			 value_entry );
 
-		return( -1 );
+			return( -1 );
+		}
+		result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+		          &( internal_record->values_data[ data_type_value->data_offset ] ),
+		          (size_t) data_type_value->data_size,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          utf8_string_size,
+		          error );
+	}
+	else
+	{
+		if( libesedb_record_get_record_value(
+		     internal_record,
+		     value_entry,
+		     &record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from values array.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+		result = libesedb_record_value_get_utf8_string_size(
+		          record_value,
+		          utf8_string_size,
+		          error );
 	}
-	result = libesedb_record_value_get_utf8_string_size(
-	          record_value,
-	          utf8_string_size,
-	          error );
 
 	if( result == -1 )
 	{
@@ -2193,9 +3207,12 @@ int libesedb_record_get_value_utf8_string(
      libcerror_error_t **error )
 {
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_data_type_value_t *data_type_value              = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *uncompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf8_string";
+	size_t uncompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
 
@@ -2254,27 +3271,65 @@ int libesedb_record_get_value_utf8_string(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
-	     value_entry,
-	     (intptr_t **) &record_value,
-	     error ) != 1 )
+	data_type_value = &( internal_record->data_type_values[ value_entry ] );
+
+	/* The uncompressed data of a compressed value is cached in the record
+	 * so that retrieving the string size and the string decompresses the value only once
+	 */
+	if( ( data_type_value->is_set != 0 )
+	 && ( data_type_value->data_size > 0 )
+	 && ( ( data_type_value->data_flags & ( LIBESEDB_VALUE_FLAG_COMPRESSED | LIBESEDB_VALUE_FLAG_LONG_VALUE | LIBESEDB_VALUE_FLAG_MULTI_VALUE ) ) == LIBESEDB_VALUE_FLAG_COMPRESSED ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
-		 function,
-		 value_entry );
+		if( libesedb_record_get_uncompressed_value_data(
+		     internal_record,
+		     value_entry,
+		     &uncompressed_data,
+		     &uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d uncompressed data.",
+			 function,
+			 value_entry );
 
-		return( -1 );
+			return( -1 );
+		}
+		result = libesedb_compression_copy_uncompressed_data_to_utf8_string(
+		          &( internal_record->values_data[ data_type_value->data_offset ] ),
+		          (size_t) data_type_value->data_size,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
+	}
+	else
+	{
+		if( libesedb_record_get_record_value(
+		     internal_record,
+		     value_entry,
+		     &record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from values array.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+		result = libesedb_record_value_get_utf8_string(
+		          record_value,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
 	}
-	result = libesedb_record_value_get_utf8_string(
-	          record_value,
-	          utf8_string,
-	          utf8_string_size,
-	          error );
 
 	if( result == -1 )
 	{
@@ -2302,9 +3357,12 @@ int libesedb_record_get_value_utf16_string_size(
      libcerror_error_t **error )
 {
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_data_type_value_t *data_type_value              = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *uncompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf16_string_size";
+	size_t uncompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
 
@@ -2363,26 +3421,63 @@ int libesedb_record_get_value_utf16_string_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
-	     value_entry,
-	     (intptr_t **) &record_value,
-	     error ) != 1 )
+	data_type_value = &( internal_record->data_type_values[ value_entry ] );
+
+	/* The uncompressed data of a compressed value is cached in the record
+	 * so that retrieving the string size and the string decompresses the value only once
+	 */
+	if( ( data_type_value->is_set != 0 )
+	 && ( data_type_value->data_size > 0 )
+	 && ( ( data_type_value->data_flags & ( LIBESEDB_VALUE_FLAG_COMPRESSED | LIBESEDB_VALUE_FLAG_LONG_VALUE | LIBESEDB_VALUE_FLAG_MULTI_VALUE ) ) == LIBESEDB_VALUE_FLAG_COMPRESSED ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
-		 function,
-		 value_entry );
+		if( libesedb_record_get_uncompressed_value_data(
+		     internal_record,
+		     value_entry,
+		     &uncompressed_data,
+		     &uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d uncompressed data.",
+			 function,
+			 value_entry );
 
-		return( -1 );
+			return( -1 );
+		}
+		result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+		          &( internal_record->values_data[ data_type_value->data_offset ] ),
+		          (size_t) data_type_value->data_size,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          utf16_string_size,
+		          error );
+	}
+	else
+	{
+		if( libesedb_record_get_record_value(
+		     internal_record,
+		     value_entry,
+		     &record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from values array.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+		result = libesedb_record_value_get_utf16_string_size(
+		          record_value,
+		          utf16_string_size,
+		          error );
 	}
-	result = libesedb_record_value_get_utf16_string_size(
-	          record_value,
-	          utf16_string_size,
-	          error );
 
 	if( result == -1 )
 	{
@@ -2412,9 +3507,12 @@ int libesedb_record_get_value_utf16_string(
      libcerror_error_t **error )
 {
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_data_type_value_t *data_type_value              = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *uncompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf16_string";
+	size_t uncompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
 
@@ -2473,27 +3571,65 @@ int libesedb_record_get_value_utf16_string(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
-	     value_entry,
-	     (intptr_t **) &record_value,
-	     error ) != 1 )
+	data_type_value = &( internal_record->data_type_values[ value_entry ] );
+
+	/* The uncompressed data of a compressed value is cached in the record
+	 * so that retrieving the string size and the string decompresses the value only once
+	 */
+	if( ( data_type_value->is_set != 0 )
+	 && ( data_type_value->data_size > 0 )
+	 && ( ( data_type_value->data_flags & ( LIBESEDB_VALUE_FLAG_COMPRESSED | LIBESEDB_VALUE_FLAG_LONG_VALUE | LIBESEDB_VALUE_FLAG_MULTI_VALUE ) ) == LIBESEDB_VALUE_FLAG_COMPRESSED ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
-		 function,
-		 value_entry );
+		if( libesedb_record_get_uncompressed_value_data(
+		     internal_record,
+		     value_entry,
+		     &uncompressed_data,
+		     &uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d uncompressed data.",
+			 function,
+			 value_entry );
 
-		return( -1 );
+			return( -1 );
+		}
+		result = libesedb_compression_copy_uncompressed_data_to_utf16_string(
+		          &( internal_record->values_data[ data_type_value->data_offset ] ),
+		          (size_t) data_type_value->data_size,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          utf16_string,
+		          utf16_string_size,
+		          error );
+	}
+	else
+	{
+		if( libesedb_record_get_record_value(
+		     internal_record,
+		     value_entry,
+		     &record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from values array.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+		result = libesedb_record_value_get_utf16_string(
+		          record_value,
+		          utf16_string,
+		          utf16_string_size,
+		          error );
 	}
-	result = libesedb_record_value_get_utf16_string(
-	          record_value,
-	          utf16_string,
-	          utf16_string_size,
-	          error );
 
 	if( result == -1 )
 	{
@@ -2522,10 +3658,9 @@ int libesedb_record_get_value_binary_data_size(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
-	uint8_t *entry_data                                      = NULL;
+	const uint8_t *uncompressed_data                         = NULL;
 	uint8_t *value_data                                      = NULL;
 	static char *function                                    = "libesedb_record_get_value_binary_data_size";
-	size_t entry_data_size                                   = 0;
 	uint32_t column_type                                     = 0;
 	uint32_t data_flags                                      = 0;
 	int encoding                                             = 0;
@@ -2586,10 +3721,10 @@ int libesedb_record_get_value_binary_data_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2637,26 +3772,13 @@ int libesedb_record_get_value_binary_data_size(
 		}
 		if( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
 		{
-			if( libfvalue_value_get_entry_data(
-			     record_value,
-			     0,
-			     &entry_data,
-			     &entry_data_size,
-			     &encoding,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve record value entry data.",
-				 function );
-
-				return( -1 );
-			}
-			result = libesedb_compression_decompress_get_size(
-			          entry_data,
-			          entry_data_size,
+			/* The uncompressed data is cached in the record so that retrieving
+			 * the binary data afterwards does not decompress the value again
+			 */
+			result = libesedb_record_get_uncompressed_value_data(
+			          internal_record,
+			          value_entry,
+			          &uncompressed_data,
 			          binary_data_size,
 			          error );
 		}
@@ -2697,12 +3819,11 @@ int libesedb_record_get_value_binary_data(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
-	uint8_t *entry_data                                      = NULL;
+	const uint8_t *uncompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_binary_data";
-	size_t entry_data_size                                   = 0;
+	size_t uncompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
 	uint32_t data_flags                                      = 0;
-	int encoding                                             = 0;
 	int result                                               = 0;
 
 	if( record == NULL )
@@ -2760,10 +3881,10 @@ int libesedb_record_get_value_binary_data(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2811,29 +3932,57 @@ int libesedb_record_get_value_binary_data(
 		}
 		if( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
 		{
-			if( libfvalue_value_get_entry_data(
-			     record_value,
-			     0,
-			     &entry_data,
-			     &entry_data_size,
-			     &encoding,
+			if( libesedb_record_get_uncompressed_value_data(
+			     internal_record,
+			     value_entry,
+			     &uncompressed_data,
+			     &uncompressed_data_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve record value entry data.",
+				 "%s: unable to retrieve value: %d uncompressed data.",
+				 function,
+				 value_entry );
+
+				return( -1 );
+			}
+			if( binary_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+				 "%s: invalid binary data.",
 				 function );
 
 				return( -1 );
 			}
-			result = libesedb_compression_decompress(
-			          entry_data,
-			          entry_data_size,
-			          binary_data,
-			          binary_data_size,
-			          error );
+			if( binary_data_size < uncompressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid binary data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			result = 1;
+
+			if( uncompressed_data_size > 0 )
+			{
+				if( memory_copy(
+				     binary_data,
+				     uncompressed_data,
+				     uncompressed_data_size ) == NULL )
+				{
+					result = -1;
+				}
+			}
 		}
 		else
 		{
@@ -2884,10 +4033,10 @@ int libesedb_record_is_long_value(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2944,10 +4093,10 @@ int libesedb_record_is_multi_value(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3339,10 +4488,10 @@ int libesedb_record_get_long_value(
 
 		goto on_error;
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3569,21 +4718,39 @@ int libesedb_record_get_multi_value(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
-	     value_entry,
-	     (intptr_t **) &record_value,
-	     error ) != 1 )
+	/* The multi value is created with a copy of the value data so that it remains valid
+	 * when the record is reused
+	 */
+	result = libesedb_record_initialize_record_value(
+	          internal_record,
+	          value_entry,
+	          LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	          &record_value,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value: %d.",
 		 function,
 		 value_entry );
 
-		return( -1 );
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing value: %d.",
+		 function,
+		 value_entry );
+
+		goto on_error;
 	}
 	if( libfvalue_value_get_data_flags(
 	     record_value,
@@ -3598,7 +4765,7 @@ int libesedb_record_get_multi_value(
 		 function,
 		 value_entry );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( ( data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 )
 	{
@@ -3610,7 +4777,7 @@ int libesedb_record_get_multi_value(
 		 function,
 		 data_flags );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( ( ( data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
 	 || ( ( data_flags & 0x10 ) != 0 ) )
@@ -3623,7 +4790,7 @@ int libesedb_record_get_multi_value(
 		 function,
 		 data_flags );
 
-		return( -1 );
+		goto on_error;
 	}
 	result = libfvalue_value_has_data(
 	          record_value,
@@ -3639,7 +4806,7 @@ int libesedb_record_get_multi_value(
 		 function,
 		 value_entry );
 
-		return( -1 );
+		goto on_error;
 	}
 	else if( result != 0 )
 	{
@@ -3657,7 +4824,7 @@ int libesedb_record_get_multi_value(
 			 "%s: unable retrieve value data.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( value_data == NULL )
 		{
@@ -3668,7 +4835,7 @@ int libesedb_record_get_multi_value(
 			 "%s: missing value data.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( value_data_size > (size_t) UINT16_MAX )
 		{
@@ -3679,7 +4846,7 @@ int libesedb_record_get_multi_value(
 			 "%s: invalid value data size value out of bounds.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -3727,7 +4894,7 @@ int libesedb_record_get_multi_value(
 			 "%s: missing value entries.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		for( value_entry_offset_index = 1;
 		     value_entry_offset_index < number_of_value_entries;
@@ -3762,7 +4929,7 @@ int libesedb_record_get_multi_value(
 				 function,
 				 value_entry_offset_index );
 
-				return( -1 );
+				goto on_error;
 			}
 			value_entry_size = value_16bit - value_entry_offset;
 
@@ -3781,7 +4948,7 @@ int libesedb_record_get_multi_value(
 				 function,
 				 value_entry_offset_index - 1 );
 
-				return( -1 );
+				goto on_error;
 			}
 			value_entry_offset = value_16bit;
 		}
@@ -3802,7 +4969,7 @@ int libesedb_record_get_multi_value(
 			 function,
 			 value_entry_offset_index - 1 );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -3824,9 +4991,37 @@ int libesedb_record_get_multi_value(
 			 "%s: unable to create multi value.",
 			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		/* The multi value now manages the record value
+		 */
+		record_value = NULL;
+	}
+	else
+	{
+		if( libfvalue_value_free(
+		     &record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record value.",
+			 function );
+
+			goto on_error;
 		}
 	}
 	return( result );
+
+on_error:
+	if( record_value != NULL )
+	{
+		libfvalue_value_free(
+		 &record_value,
+		 NULL );
+	}
+	return( -1 );
 }
 
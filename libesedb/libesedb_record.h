@@ -33,6 +33,7 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_libfvalue.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -85,9 +86,42 @@ struct libesedb_internal_record
 	libfcache_cache_t *long_values_cache;
 
 	/* The values array
+	 * The values are created from the data type values when first retrieved
 	 */
 	libcdata_array_t *values_array;
 
+	/* The data type values
+	 * Contains a data type value per column of the record layout
+	 */
+	libesedb_data_type_value_t *data_type_values;
+
+	/* The values data
+	 * The data type values and the values in the values array reference this data
+	 */
+	uint8_t *values_data;
+
+	/* The (allocated) values data size
+	 */
+	size_t values_data_size;
+
+	/* The value entry of the uncompressed data
+	 * -1 represents that no value has been uncompressed
+	 */
+	int uncompressed_value_entry;
+
+	/* The uncompressed data
+	 * Contains the uncompressed data of the most recently uncompressed value
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The allocated uncompressed data size
+	 */
+	size_t allocated_uncompressed_data_size;
+
 	/* The (record) flags 
 	 */
 	uint8_t flags;
@@ -106,6 +140,7 @@ int libesedb_record_initialize(
      libesedb_data_definition_t *data_definition,
      libfdata_btree_t *long_values_tree,
      libfcache_cache_t *long_values_cache,
+     const uint8_t *column_projection,
      libcerror_error_t **error );
 
 LIBESEDB_EXTERN \
@@ -113,6 +148,37 @@ int libesedb_record_free(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+int libesedb_record_read(
+     libesedb_internal_record_t *internal_record,
+     libesedb_data_definition_t *data_definition,
+     const uint8_t *column_projection,
+     libcerror_error_t **error );
+
+int libesedb_record_initialize_record_value(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     uint8_t value_data_flags,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error );
+
+int libesedb_record_get_record_value(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error );
+
+int libesedb_record_unset_record_value(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libcerror_error_t **error );
+
+int libesedb_record_get_uncompressed_value_data(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     const uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_number_of_values(
      libesedb_record_t *record,
@@ -154,6 +220,14 @@ int libesedb_record_get_utf8_column_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_entry_by_utf8_column_name(
+     libesedb_record_t *record,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *value_entry,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_utf16_column_name_size(
      libesedb_record_t *record,
@@ -194,6 +268,14 @@ int libesedb_record_get_value_data(
      size_t value_data_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_data_pointer(
+     libesedb_record_t *record,
+     int value_entry,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_value_data_flags(
      libesedb_record_t *record,
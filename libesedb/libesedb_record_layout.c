@@ -0,0 +1,953 @@
+/*
+ * Record layout functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfvalue.h"
+#include "libesedb_record_layout.h"
+
+#include "esedb_page_values.h"
+
+/* Creates a record layout
+ * The record layout contains the column catalog definitions of the template table and table
+ * in the order in which they are stored in a record
+ * Make sure the value record_layout is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_layout_initialize(
+     libesedb_record_layout_t **record_layout,
+     libcdata_list_t *template_table_column_catalog_definition_list,
+     libcdata_list_t *table_column_catalog_definition_list,
+     libcerror_error_t **error )
+{
+	static char *function                                   = "libesedb_record_layout_initialize";
+	size_t columns_size                                     = 0;
+	uint16_t fixed_size_data_type_value_offset              = 0;
+	int number_of_table_column_catalog_definitions          = 0;
+	int number_of_template_table_column_catalog_definitions = 0;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_layout != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record layout value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_table_column_catalog_definition_list != NULL )
+	{
+		if( libcdata_list_get_number_of_elements(
+		     template_table_column_catalog_definition_list,
+		     &number_of_template_table_column_catalog_definitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of template table column catalog definitions.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_list_get_number_of_elements(
+	     table_column_catalog_definition_list,
+	     &number_of_table_column_catalog_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of table column catalog definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( template_table_column_catalog_definition_list != NULL )
+	 && ( number_of_table_column_catalog_definitions > number_of_template_table_column_catalog_definitions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of table column catalog definitions value exceeds number in template table.",
+		 function );
+
+		return( -1 );
+	}
+	*record_layout = memory_allocate_structure(
+	                  libesedb_record_layout_t );
+
+	if( *record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record layout.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_layout,
+	     0,
+	     sizeof( libesedb_record_layout_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record layout.",
+		 function );
+
+		memory_free(
+		 *record_layout );
+
+		*record_layout = NULL;
+
+		return( -1 );
+	}
+	( *record_layout )->number_of_columns                = number_of_template_table_column_catalog_definitions
+	                                                     + number_of_table_column_catalog_definitions;
+	( *record_layout )->number_of_template_table_columns = number_of_template_table_column_catalog_definitions;
+
+	if( ( *record_layout )->number_of_columns > 0 )
+	{
+		columns_size = sizeof( libesedb_record_layout_column_t ) * ( *record_layout )->number_of_columns;
+
+		( *record_layout )->columns = (libesedb_record_layout_column_t *) memory_allocate(
+		                                                                   columns_size );
+
+		if( ( *record_layout )->columns == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create columns.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *record_layout )->columns,
+		     0,
+		     columns_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear columns.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	fixed_size_data_type_value_offset = (uint16_t) sizeof( esedb_data_definition_header_t );
+
+	if( template_table_column_catalog_definition_list != NULL )
+	{
+		if( libesedb_record_layout_set_columns(
+		     *record_layout,
+		     template_table_column_catalog_definition_list,
+		     0,
+		     &fixed_size_data_type_value_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set template table columns.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_record_layout_set_columns(
+	     *record_layout,
+	     table_column_catalog_definition_list,
+	     number_of_template_table_column_catalog_definitions,
+	     &fixed_size_data_type_value_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set table columns.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *record_layout != NULL )
+	{
+		libesedb_record_layout_free(
+		 record_layout,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a record layout
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_layout_free(
+     libesedb_record_layout_t **record_layout,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_layout_free";
+	int column_index      = 0;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_layout != NULL )
+	{
+		/* The column catalog definitions are referenced and freed elsewhere
+		 */
+		if( ( *record_layout )->columns != NULL )
+		{
+			for( column_index = 0;
+			     column_index < ( *record_layout )->number_of_columns;
+			     column_index++ )
+			{
+				if( ( *record_layout )->columns[ column_index ].utf8_name != NULL )
+				{
+					memory_free(
+					 ( *record_layout )->columns[ column_index ].utf8_name );
+				}
+			}
+			memory_free(
+			 ( *record_layout )->columns );
+		}
+		if( ( *record_layout )->name_index != NULL )
+		{
+			memory_free(
+			 ( *record_layout )->name_index );
+		}
+		memory_free(
+		 *record_layout );
+
+		*record_layout = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the columns of a column catalog definition list starting at the column index
+ * The fixed size data type value offset is updated with the size of the fixed size columns
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_layout_set_columns(
+     libesedb_record_layout_t *record_layout,
+     libcdata_list_t *column_catalog_definition_list,
+     int column_index,
+     uint16_t *fixed_size_data_type_value_offset,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *column_catalog_definition_list_element = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition        = NULL;
+	libesedb_record_layout_column_t *column                         = NULL;
+	static char *function                                           = "libesedb_record_layout_set_columns";
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_index < 0 )
+	 || ( column_index > record_layout->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( fixed_size_data_type_value_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fixed size data type value offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_first_element(
+	     column_catalog_definition_list,
+	     &column_catalog_definition_list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first column catalog definition list element.",
+		 function );
+
+		return( -1 );
+	}
+	while( column_catalog_definition_list_element != NULL )
+	{
+		if( column_index >= record_layout->number_of_columns )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid column index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_list_element_get_value(
+		     column_catalog_definition_list_element,
+		     (intptr_t **) &column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from list element: %d.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		if( column_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column catalog definition: %d.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		if( column_catalog_definition->type != LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column catalog definition type: %" PRIu16 " for list element: %d.",
+			 function,
+			 column_catalog_definition->type,
+			 column_index );
+
+			return( -1 );
+		}
+		column = &( record_layout->columns[ column_index ] );
+
+		column->column_catalog_definition = column_catalog_definition;
+		column->identifier                = column_catalog_definition->identifier;
+
+/* TODO refactor to value type */
+
+		switch( column_catalog_definition->column_type )
+		{
+			case LIBESEDB_COLUMN_TYPE_NULL:
+				/* JET_coltypNil seems to be able to contain data */
+				column->value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+				column->value_type = LIBFVALUE_VALUE_TYPE_BOOLEAN;
+				column->value_size = 1;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+				column->value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT;
+				column->value_size = 1;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+				column->value_type = LIBFVALUE_VALUE_TYPE_INTEGER_16BIT;
+				column->value_size = 2;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+				column->value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT;
+				column->value_size = 2;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+				column->value_type = LIBFVALUE_VALUE_TYPE_INTEGER_32BIT;
+				column->value_size = 4;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+				column->value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT;
+				column->value_size = 4;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_CURRENCY:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+				column->value_type = LIBFVALUE_VALUE_TYPE_INTEGER_64BIT;
+				column->value_size = 8;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+				column->value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT;
+				column->value_size = 4;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+				column->value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT;
+				column->value_size = 8;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+				column->value_type = LIBFVALUE_VALUE_TYPE_FILETIME;
+				column->value_size = 8;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_GUID:
+				column->value_type = LIBFVALUE_VALUE_TYPE_GUID;
+				column->value_size = 16;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
+			case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
+				column->value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_TEXT:
+			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+				column->value_type = LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_SUPER_LARGE_VALUE:
+/* TODO handle this value type */
+				column->value_type = LIBFVALUE_VALUE_TYPE_UNDEFINED;
+				break;
+
+			default:
+				/* The unsupported column type is reported when a record is read
+				 */
+				column->value_type = -1;
+				break;
+		}
+		if( ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+		 || ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+		{
+			column->codepage = (int) column_catalog_definition->codepage;
+
+			/* Codepage 1200 in the ESE database format is not strict UTF-16 little endian
+			 * it can be used for ASCII strings as well. This could be SCSU.
+			 */
+			if( column->codepage == 1200 )
+			{
+				column->codepage = LIBFVALUE_CODEPAGE_1200_MIXED;
+			}
+		}
+		if( column_catalog_definition->identifier <= 127 )
+		{
+			if( column_catalog_definition->size > (uint32_t) UINT16_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid common catalog definition size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			if( column_catalog_definition->size > (uint32_t) ( UINT16_MAX - *fixed_size_data_type_value_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid fixed size data type value offset value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			column->data_type_class                   = LIBESEDB_DATA_TYPE_CLASS_FIXED_SIZE;
+			column->fixed_size_data_type_value_offset = *fixed_size_data_type_value_offset;
+			column->fixed_size_data_type_size         = (uint16_t) column_catalog_definition->size;
+
+			*fixed_size_data_type_value_offset += (uint16_t) column_catalog_definition->size;
+		}
+		else if( column_catalog_definition->identifier <= 255 )
+		{
+			column->data_type_class = LIBESEDB_DATA_TYPE_CLASS_VARIABLE_SIZE;
+		}
+		else
+		{
+			column->data_type_class = LIBESEDB_DATA_TYPE_CLASS_TAGGED;
+		}
+		column_index++;
+
+		if( libcdata_list_element_get_next_element(
+		     column_catalog_definition_list_element,
+		     &column_catalog_definition_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next column catalog definition list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-8 encoded name
+ * The hash is a 32-bit FNV-1a hash of the UTF-8 encoded name
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_layout_calculate_name_hash(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_layout_calculate_name_hash";
+	size_t string_index   = 0;
+	uint32_t hash         = 0x811c9dc5UL;
+
+	if( ( utf8_string == NULL )
+	 && ( utf8_string_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < utf8_string_length;
+	     string_index++ )
+	{
+		hash ^= (uint32_t) utf8_string[ string_index ];
+		hash *= 0x01000193UL;
+	}
+	*name_hash = hash;
+
+	return( 1 );
+}
+
+/* Builds the name index
+ * The name index is a hash table of the UTF-8 encoded column names, which is
+ * only rebuilt if the codepage differs from the one it was built with
+ * If multiple columns have the same name the first column is indexed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_layout_build_name_index(
+     libesedb_record_layout_t *record_layout,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libesedb_record_layout_column_t *column = NULL;
+	static char *function                   = "libesedb_record_layout_build_name_index";
+	size_t utf8_name_size                   = 0;
+	uint32_t name_index_mask                = 0;
+	uint32_t slot_index                     = 0;
+	int column_index                        = 0;
+	int indexed_column_index                = 0;
+	int name_index_size                     = 0;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_layout->name_index != NULL )
+	 && ( record_layout->name_index_codepage == ascii_codepage ) )
+	{
+		return( 1 );
+	}
+	if( record_layout->number_of_columns > ( INT_MAX / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record layout - number of columns value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_layout->name_index != NULL )
+	{
+		memory_free(
+		 record_layout->name_index );
+
+		record_layout->name_index      = NULL;
+		record_layout->name_index_size = 0;
+	}
+	/* The number of slots is a power of 2 of at least twice the number of columns
+	 */
+	name_index_size = 8;
+
+	while( name_index_size < ( record_layout->number_of_columns * 2 ) )
+	{
+		name_index_size *= 2;
+	}
+	name_index_mask = (uint32_t) name_index_size - 1;
+
+	record_layout->name_index = (int *) memory_allocate(
+	                                     sizeof( int ) * name_index_size );
+
+	if( record_layout->name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name index.",
+		 function );
+
+		goto on_error;
+	}
+	for( slot_index = 0;
+	     slot_index < (uint32_t) name_index_size;
+	     slot_index++ )
+	{
+		record_layout->name_index[ slot_index ] = -1;
+	}
+	for( column_index = 0;
+	     column_index < record_layout->number_of_columns;
+	     column_index++ )
+	{
+		column = &( record_layout->columns[ column_index ] );
+
+		if( column->utf8_name != NULL )
+		{
+			memory_free(
+			 column->utf8_name );
+
+			column->utf8_name = NULL;
+		}
+		column->utf8_name_length = 0;
+
+		if( libesedb_catalog_definition_get_utf8_name_size(
+		     column->column_catalog_definition,
+		     &utf8_name_size,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d name size.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		if( utf8_name_size > 0 )
+		{
+			column->utf8_name = (uint8_t *) memory_allocate(
+			                                 sizeof( uint8_t ) * utf8_name_size );
+
+			if( column->utf8_name == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create column: %d name.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+			if( libesedb_catalog_definition_get_utf8_name(
+			     column->column_catalog_definition,
+			     column->utf8_name,
+			     utf8_name_size,
+			     ascii_codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column: %d name.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+			column->utf8_name_length = utf8_name_size - 1;
+		}
+		if( libesedb_record_layout_calculate_name_hash(
+		     column->utf8_name,
+		     column->utf8_name_length,
+		     &( column->name_hash ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate column: %d name hash.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		slot_index = column->name_hash & name_index_mask;
+
+		while( record_layout->name_index[ slot_index ] != -1 )
+		{
+			indexed_column_index = record_layout->name_index[ slot_index ];
+
+			if( ( record_layout->columns[ indexed_column_index ].name_hash == column->name_hash )
+			 && ( record_layout->columns[ indexed_column_index ].utf8_name_length == column->utf8_name_length )
+			 && ( ( column->utf8_name_length == 0 )
+			  ||  ( memory_compare(
+			         record_layout->columns[ indexed_column_index ].utf8_name,
+			         column->utf8_name,
+			         column->utf8_name_length ) == 0 ) ) )
+			{
+				break;
+			}
+			slot_index = ( slot_index + 1 ) & name_index_mask;
+		}
+		if( record_layout->name_index[ slot_index ] == -1 )
+		{
+			record_layout->name_index[ slot_index ] = column_index;
+		}
+	}
+	record_layout->name_index_size     = name_index_size;
+	record_layout->name_index_codepage = ascii_codepage;
+
+	return( 1 );
+
+on_error:
+	if( record_layout->name_index != NULL )
+	{
+		memory_free(
+		 record_layout->name_index );
+
+		record_layout->name_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the index of the column with the specific UTF-8 encoded name
+ * The name index is built on first use
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_record_layout_get_column_index_by_utf8_name(
+     libesedb_record_layout_t *record_layout,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     int *column_index,
+     libcerror_error_t **error )
+{
+	libesedb_record_layout_column_t *column = NULL;
+	static char *function                   = "libesedb_record_layout_get_column_index_by_utf8_name";
+	uint32_t name_hash                      = 0;
+	uint32_t name_index_mask                = 0;
+	uint32_t slot_index                     = 0;
+	int number_of_probes                    = 0;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_layout_build_name_index(
+	     record_layout,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build name index.",
+		 function );
+
+		return( -1 );
+	}
+	/* The end-of-string character is not part of the name
+	 */
+	if( ( utf8_string_length > 0 )
+	 && ( utf8_string[ utf8_string_length - 1 ] == 0 ) )
+	{
+		utf8_string_length -= 1;
+	}
+	if( libesedb_record_layout_calculate_name_hash(
+	     utf8_string,
+	     utf8_string_length,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	name_index_mask = (uint32_t) record_layout->name_index_size - 1;
+	slot_index      = name_hash & name_index_mask;
+
+	for( number_of_probes = 0;
+	     number_of_probes < record_layout->name_index_size;
+	     number_of_probes++ )
+	{
+		if( record_layout->name_index[ slot_index ] == -1 )
+		{
+			break;
+		}
+		column = &( record_layout->columns[ record_layout->name_index[ slot_index ] ] );
+
+		if( ( column->name_hash == name_hash )
+		 && ( column->utf8_name_length == utf8_string_length )
+		 && ( ( utf8_string_length == 0 )
+		  ||  ( memory_compare(
+		         column->utf8_name,
+		         utf8_string,
+		         utf8_string_length ) == 0 ) ) )
+		{
+			*column_index = record_layout->name_index[ slot_index ];
+
+			return( 1 );
+		}
+		slot_index = ( slot_index + 1 ) & name_index_mask;
+	}
+	return( 0 );
+}
+
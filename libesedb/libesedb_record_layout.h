@@ -0,0 +1,163 @@
+/*
+ * Record layout functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_RECORD_LAYOUT_H )
+#define _LIBESEDB_RECORD_LAYOUT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_record_layout_column libesedb_record_layout_column_t;
+
+struct libesedb_record_layout_column
+{
+	/* The column catalog definition
+	 * This is a reference to a column catalog definition of the (template) table definition
+	 */
+	libesedb_catalog_definition_t *column_catalog_definition;
+
+	/* The column identifier
+	 */
+	uint32_t identifier;
+
+	/* The data type class
+	 */
+	uint8_t data_type_class;
+
+	/* The record value type
+	 * -1 represents an unsupported column type
+	 */
+	int value_type;
+
+	/* The codepage of a text column
+	 * 0 represents the default (ASCII) codepage
+	 */
+	int codepage;
+
+	/* The fixed size data type value offset
+	 */
+	uint16_t fixed_size_data_type_value_offset;
+
+	/* The fixed size data type size
+	 */
+	uint16_t fixed_size_data_type_size;
+
+	/* The value size of a fixed size column type
+	 * 0 represents a variable size column type
+	 */
+	uint8_t value_size;
+
+	/* The UTF-8 encoded name
+	 * This value is set when the name index is built
+	 */
+	uint8_t *utf8_name;
+
+	/* The UTF-8 encoded name length
+	 * The length does not include the end-of-string character
+	 */
+	size_t utf8_name_length;
+
+	/* The name hash
+	 */
+	uint32_t name_hash;
+};
+
+typedef struct libesedb_record_layout libesedb_record_layout_t;
+
+struct libesedb_record_layout
+{
+	/* The columns
+	 * The template table columns are stored before the table columns
+	 */
+	libesedb_record_layout_column_t *columns;
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The number of template table columns
+	 */
+	int number_of_template_table_columns;
+
+	/* The name index
+	 * This hash table contains the column indexes by name hash, -1 represents an unused slot
+	 */
+	int *name_index;
+
+	/* The number of slots in the name index
+	 */
+	int name_index_size;
+
+	/* The codepage of the names in the name index
+	 */
+	int name_index_codepage;
+};
+
+int libesedb_record_layout_initialize(
+     libesedb_record_layout_t **record_layout,
+     libcdata_list_t *template_table_column_catalog_definition_list,
+     libcdata_list_t *table_column_catalog_definition_list,
+     libcerror_error_t **error );
+
+int libesedb_record_layout_free(
+     libesedb_record_layout_t **record_layout,
+     libcerror_error_t **error );
+
+int libesedb_record_layout_set_columns(
+     libesedb_record_layout_t *record_layout,
+     libcdata_list_t *column_catalog_definition_list,
+     int column_index,
+     uint16_t *fixed_size_data_type_value_offset,
+     libcerror_error_t **error );
+
+int libesedb_record_layout_calculate_name_hash(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libesedb_record_layout_build_name_index(
+     libesedb_record_layout_t *record_layout,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libesedb_record_layout_get_column_index_by_utf8_name(
+     libesedb_record_layout_t *record_layout,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     int *column_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_RECORD_LAYOUT_H ) */
+
@@ -25,6 +25,7 @@
 #include "libesedb_compression.h"
 #include "libesedb_definitions.h"
 #include "libesedb_record_value.h"
+#include "libesedb_unicode.h"
 
 /* Retrieves the size of an UTF-8 string
  * The returned size includes the end of string character
@@ -96,25 +97,25 @@ int libesedb_record_value_get_utf8_string_size(
 
 			return( -1 );
 		}
-		if( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+		if( libfvalue_value_get_entry_data(
+		     record_value,
+		     0,
+		     &entry_data,
+		     &entry_data_size,
+		     &encoding,
+		     error ) != 1 )
 		{
-			if( libfvalue_value_get_entry_data(
-			     record_value,
-			     0,
-			     &entry_data,
-			     &entry_data_size,
-			     &encoding,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve record value entry data.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record value entry data.",
+			 function );
 
-				return( -1 );
-			}
+			return( -1 );
+		}
+		if( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+		{
 			result = libesedb_compression_get_utf8_string_size(
 			          entry_data,
 			          entry_data_size,
@@ -123,11 +124,27 @@ int libesedb_record_value_get_utf8_string_size(
 		}
 		else
 		{
-			result = libfvalue_value_get_utf8_string_size(
-			          record_value,
-			          0,
-			          utf8_string_size,
-			          error );
+			/* Codepage 1200 strings are converted directly if they are UTF-16 little-endian
+			 * without surrogates, otherwise they are converted by libfvalue
+			 */
+			result = 0;
+
+			if( encoding == LIBFVALUE_CODEPAGE_1200_MIXED )
+			{
+				result = libesedb_unicode_utf8_string_size_from_utf16_stream(
+				          entry_data,
+				          entry_data_size,
+				          utf8_string_size,
+				          error );
+			}
+			if( result == 0 )
+			{
+				result = libfvalue_value_get_utf8_string_size(
+				          record_value,
+				          0,
+				          utf8_string_size,
+				          error );
+			}
 		}
 		if( result != 1 )
 		{
@@ -215,25 +232,25 @@ int libesedb_record_value_get_utf8_string(
 
 			return( -1 );
 		}
-		if( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+		if( libfvalue_value_get_entry_data(
+		     record_value,
+		     0,
+		     &entry_data,
+		     &entry_data_size,
+		     &encoding,
+		     error ) != 1 )
 		{
-			if( libfvalue_value_get_entry_data(
-			     record_value,
-			     0,
-			     &entry_data,
-			     &entry_data_size,
-			     &encoding,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve record value entry data.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record value entry data.",
+			 function );
 
-				return( -1 );
-			}
+			return( -1 );
+		}
+		if( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+		{
 			result = libesedb_compression_copy_to_utf8_string(
 			          entry_data,
 			          entry_data_size,
@@ -243,12 +260,29 @@ int libesedb_record_value_get_utf8_string(
 		}
 		else
 		{
-			result = libfvalue_value_copy_to_utf8_string(
-			          record_value,
-			          0,
-			          utf8_string,
-			          utf8_string_size,
-			          error );
+			/* Codepage 1200 strings are converted directly if they are UTF-16 little-endian
+			 * without surrogates, otherwise they are converted by libfvalue
+			 */
+			result = 0;
+
+			if( encoding == LIBFVALUE_CODEPAGE_1200_MIXED )
+			{
+				result = libesedb_unicode_utf8_string_copy_from_utf16_stream(
+				          utf8_string,
+				          utf8_string_size,
+				          entry_data,
+				          entry_data_size,
+				          error );
+			}
+			if( result == 0 )
+			{
+				result = libfvalue_value_copy_to_utf8_string(
+				          record_value,
+				          0,
+				          utf8_string,
+				          utf8_string_size,
+				          error );
+			}
 		}
 		if( result != 1 )
 		{
@@ -19,15 +19,20 @@
  * along with this software.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <memory.h>
 #include <types.h>
 
+#include "libesedb_arrow.h"
+#include "libesedb_catalog_definition.h"
 #include "libesedb_column.h"
+#include "libesedb_cursor.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_definitions.h"
 #include "libesedb_index.h"
 #include "libesedb_io_handle.h"
+#include "libesedb_key.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
@@ -35,9 +40,11 @@
 #include "libesedb_libfdata.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_record.h"
+#include "libesedb_record_layout.h"
 #include "libesedb_table.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
+#include "libesedb_unused.h"
 
 /* Creates a table
  * Make sure the value table is referencing, is set to NULL
@@ -49,6 +56,8 @@ int libesedb_table_initialize(
      libesedb_io_handle_t *io_handle,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
      libcerror_error_t **error )
 {
 	libesedb_internal_table_t *internal_table   = NULL;
@@ -56,7 +65,6 @@ int libesedb_table_initialize(
 	libesedb_page_tree_t *table_page_tree       = NULL;
 	static char *function                       = "libesedb_table_initialize";
 	off64_t node_data_offset                    = 0;
-	int segment_index                           = 0;
 
 	if( table == NULL )
 	{
@@ -144,56 +152,16 @@ int libesedb_table_initialize(
 
 		return( -1 );
 	}
-	/* TODO add clone function ?
-	 */
-	if( libfdata_vector_initialize(
-	     &( internal_table->pages_vector ),
-	     (size64_t) io_handle->page_size,
-	     (intptr_t *) io_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages vector.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_append_segment(
-	     internal_table->pages_vector,
-	     &segment_index,
-	     0,
-	     io_handle->pages_data_offset,
-	     io_handle->pages_data_size,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to pages vector.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfcache_cache_initialize(
-	     &( internal_table->pages_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	if( libesedb_table_definition_initialize_record_layout(
+	     table_definition,
+	     template_table_definition,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages cache.",
+		 "%s: unable to initialize table definition record layout.",
 		 function );
 
 		goto on_error;
@@ -201,8 +169,8 @@ int libesedb_table_initialize(
 	if( libesedb_page_tree_initialize(
 	     &table_page_tree,
 	     io_handle,
-	     internal_table->pages_vector,
-	     internal_table->pages_cache,
+	     pages_vector,
+	     pages_cache,
 	     table_definition->table_catalog_definition->identifier,
 	     table_definition,
 	     template_table_definition,
@@ -244,7 +212,7 @@ int libesedb_table_initialize(
 	}
 	if( libfcache_cache_initialize(
 	     &( internal_table->table_values_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_VALUES,
+	     io_handle->maximum_cache_entries[ LIBESEDB_CACHE_TYPE_TABLE_VALUES ],
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -278,65 +246,11 @@ int libesedb_table_initialize(
 	}
 	if( table_definition->long_value_catalog_definition != NULL )
 	{
-		/* TODO add clone function ?
-		 */
-		if( libfdata_vector_initialize(
-		     &( internal_table->long_values_pages_vector ),
-		     (size64_t) io_handle->page_size,
-		     (intptr_t *) io_handle,
-		     NULL,
-		     NULL,
-		     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
-		     NULL,
-		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long values pages vector.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfdata_vector_append_segment(
-		     internal_table->long_values_pages_vector,
-		     &segment_index,
-		     0,
-		     io_handle->pages_data_offset,
-		     io_handle->pages_data_size,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append segment to long values pages vector.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfcache_cache_initialize(
-		     &( internal_table->long_values_pages_cache ),
-		     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long values pages cache.",
-			 function );
-
-			goto on_error;
-		}
 		if( libesedb_page_tree_initialize(
 		     &long_values_page_tree,
 		     io_handle,
-		     internal_table->long_values_pages_vector,
-		     internal_table->long_values_pages_cache,
+		     pages_vector,
+		     pages_cache,
 		     table_definition->long_value_catalog_definition->identifier,
 		     table_definition,
 		     template_table_definition,
@@ -378,7 +292,7 @@ int libesedb_table_initialize(
 		}
 		if( libfcache_cache_initialize(
 		     &( internal_table->long_values_cache ),
-		     LIBESEDB_MAXIMUM_CACHE_ENTRIES_LONG_VALUES,
+		     io_handle->maximum_cache_entries[ LIBESEDB_CACHE_TYPE_LONG_VALUES ],
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -415,6 +329,8 @@ int libesedb_table_initialize(
 	internal_table->file_io_handle            = file_io_handle;
 	internal_table->table_definition          = table_definition;
 	internal_table->template_table_definition = template_table_definition;
+	internal_table->pages_vector              = pages_vector;
+	internal_table->pages_cache               = pages_cache;
 
 	*table = (libesedb_table_t *) internal_table;
 
@@ -435,18 +351,6 @@ on_error:
 			 &( internal_table->long_values_tree ),
 			 NULL );
 		}
-		if( internal_table->long_values_pages_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &( internal_table->long_values_pages_cache ),
-			 NULL );
-		}
-		if( internal_table->long_values_pages_vector != NULL )
-		{
-			libfdata_vector_free(
-			 &( internal_table->long_values_pages_vector ),
-			 NULL );
-		}
 		if( internal_table->table_values_cache != NULL )
 		{
 			libfcache_cache_free(
@@ -459,18 +363,6 @@ on_error:
 			 &( internal_table->table_values_tree ),
 			 NULL );
 		}
-		if( internal_table->pages_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &( internal_table->pages_cache ),
-			 NULL );
-		}
-		if( internal_table->pages_vector != NULL )
-		{
-			libfdata_vector_free(
-			 &( internal_table->pages_vector ),
-			 NULL );
-		}
 		memory_free(
 		 internal_table );
 	}
@@ -504,67 +396,9 @@ int libesedb_table_free(
 		internal_table = (libesedb_internal_table_t *) *table;
 		*table         = NULL;
 
-		/* The io_handle, file_io_handle and table_definition references
-		 * are freed elsewhere
+		/* The io_handle, file_io_handle, table_definition, pages_vector
+		 * and pages_cache references are freed elsewhere
 		 */
-		if( libfdata_vector_free(
-		     &( internal_table->pages_vector ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free pages vector.",
-			 function );
-
-			result = -1;
-		}
-		if( libfcache_cache_free(
-		     &( internal_table->pages_cache ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free pages cache.",
-			 function );
-
-			result = -1;
-		}
-		if( internal_table->long_values_pages_vector != NULL )
-		{
-			if( libfdata_vector_free(
-			     &( internal_table->long_values_pages_vector ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values pages vector.",
-				 function );
-
-				result = -1;
-			}
-		}
-		if( internal_table->long_values_pages_cache != NULL )
-		{
-			if( libfcache_cache_free(
-			     &( internal_table->long_values_pages_cache ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values pages cache.",
-				 function );
-
-				result = -1;
-			}
-		}
 		if( libfdata_btree_free(
 		     &( internal_table->table_values_tree ),
 		     error ) != 1 )
@@ -623,6 +457,11 @@ int libesedb_table_free(
 				result = -1;
 			}
 		}
+		if( internal_table->column_projection != NULL )
+		{
+			memory_free(
+			 internal_table->column_projection );
+		}
 		memory_free(
 		 internal_table );
 	}
@@ -1492,6 +1331,79 @@ int libesedb_table_get_column(
 	return( 1 );
 }
 
+/* Retrieves the column entry for the specific UTF-8 encoded name
+ * The column entry includes the columns of the template table
+ * The names are looked up in a hash table that is built once per table definition
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_table_get_column_entry_by_utf8_name(
+     libesedb_table_t *table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *column_entry,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_column_entry_by_utf8_name";
+	int result                                = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_record_layout_get_column_index_by_utf8_name(
+	          internal_table->table_definition->record_layout,
+	          utf8_string,
+	          utf8_string_length,
+	          internal_table->io_handle->ascii_codepage,
+	          column_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column index from record layout.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the number of indexes
  * Returns 1 if successful or -1 on error
  */
@@ -1638,8 +1550,8 @@ int libesedb_table_get_index(
 	     index_catalog_definition,
 	     internal_table->pages_vector,
 	     internal_table->pages_cache,
-	     internal_table->long_values_pages_vector,
-	     internal_table->long_values_pages_cache,
+	     internal_table->pages_vector,
+	     internal_table->pages_cache,
 	     internal_table->table_values_tree,
 	     internal_table->table_values_cache,
 	     internal_table->long_values_tree,
@@ -1659,6 +1571,8 @@ int libesedb_table_get_index(
 }
 
 /* Retrieves the number of records in the table
+ * The number of records is determined by walking the chain of leaf pages
+ * and is cached for subsequent calls
  * Returns 1 if successful or -1 on error
  */
 int libesedb_table_get_number_of_records(
@@ -1666,6 +1580,7 @@ int libesedb_table_get_number_of_records(
      int *number_of_records,
      libcerror_error_t **error )
 {
+	libesedb_cursor_t *cursor                 = NULL;
 	libesedb_internal_table_t *internal_table = NULL;
 	static char *function                     = "libesedb_table_get_number_of_records";
 
@@ -1682,38 +1597,89 @@ int libesedb_table_get_number_of_records(
 	}
 	internal_table = (libesedb_internal_table_t *) table;
 
-	if( libfdata_btree_get_number_of_leaf_values(
-	     internal_table->table_values_tree,
-	     (intptr_t *) internal_table->file_io_handle,
-	     internal_table->table_values_cache,
-	     number_of_records,
-	     0,
-	     error ) != 1 )
+	if( number_of_records == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of leaf values from table values tree.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
 		 function );
 
 		return( -1 );
 	}
+	if( internal_table->number_of_records_is_set == 0 )
+	{
+		if( libesedb_table_get_cursor(
+		     table,
+		     &cursor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create cursor.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_cursor_get_number_of_values(
+		     (libesedb_internal_cursor_t *) cursor,
+		     &( internal_table->number_of_records ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of leaf values.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_cursor_free(
+		     &cursor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cursor.",
+			 function );
+
+			goto on_error;
+		}
+		internal_table->number_of_records_is_set = 1;
+	}
+	*number_of_records = internal_table->number_of_records;
+
 	return( 1 );
+
+on_error:
+	if( cursor != NULL )
+	{
+		libesedb_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	internal_table->number_of_records = 0;
+
+	return( -1 );
 }
 
-/* Retrieves a specific record
- * Returns 1 if successful or -1 on error
+/* Retrieves the number of records in the table if it is already known
+ * This function does not read any pages
+ * Returns 1 if successful, 0 if the number of records is not yet known or -1 on error
  */
-int libesedb_table_get_record(
+int libesedb_table_get_known_number_of_records(
      libesedb_table_t *table,
-     int record_entry,
-     libesedb_record_t **record,
+     int *number_of_records,
      libcerror_error_t **error )
 {
-	libesedb_data_definition_t *record_data_definition = NULL;
-	libesedb_internal_table_t *internal_table          = NULL;
-	static char *function                              = "libesedb_table_get_record";
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_known_number_of_records";
 
 	if( table == NULL )
 	{
@@ -1728,29 +1694,232 @@ int libesedb_table_get_record(
 	}
 	internal_table = (libesedb_internal_table_t *) table;
 
-	if( record == NULL )
+	if( number_of_records == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid number of records.",
 		 function );
 
 		return( -1 );
 	}
-	if( *record != NULL )
+	if( internal_table->number_of_records_is_set == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record value already set.",
-		 function );
-
-		return( -1 );
+		return( 0 );
 	}
-	if( libfdata_btree_get_leaf_value_by_index(
+	*number_of_records = internal_table->number_of_records;
+
+	return( 1 );
+}
+
+/* Sets the column projection
+ * The column projection restricts the column values that are read from records
+ * of the table to the specified column entries, other columns are skipped without
+ * creating values. Retrieving a value of a column that is not projected fails.
+ * Use a number of column entries of 0 to read all column values
+ * If a column entry is invalid the column projection is not changed
+ * The column projection applies to records retrieved after it was set
+ * and to cursors retrieved after it was first set
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_set_column_projection(
+     libesedb_table_t *table,
+     const int *column_entries,
+     int number_of_column_entries,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_set_column_projection";
+	int column_entry_index                    = 0;
+	int number_of_columns                     = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( number_of_column_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of column entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_entries == NULL )
+	 && ( number_of_column_entries > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->column_projection == NULL )
+	{
+		if( number_of_column_entries == 0 )
+		{
+			return( 1 );
+		}
+		if( libesedb_table_get_number_of_columns(
+		     table,
+		     &number_of_columns,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of columns.",
+			 function );
+
+			return( -1 );
+		}
+		if( number_of_columns <= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of columns value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		number_of_columns = internal_table->number_of_projection_columns;
+	}
+	/* The column entries are validated before the column projection is changed
+	 */
+	for( column_entry_index = 0;
+	     column_entry_index < number_of_column_entries;
+	     column_entry_index++ )
+	{
+		if( ( column_entries[ column_entry_index ] < 0 )
+		 || ( column_entries[ column_entry_index ] >= number_of_columns ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid column entry: %d value out of bounds.",
+			 function,
+			 column_entry_index );
+
+			return( -1 );
+		}
+	}
+	if( internal_table->column_projection == NULL )
+	{
+		/* The column projection is not reallocated since cursors reference it
+		 */
+		internal_table->column_projection = (uint8_t *) memory_allocate(
+		                                                 sizeof( uint8_t ) * number_of_columns );
+
+		if( internal_table->column_projection == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create column projection.",
+			 function );
+
+			return( -1 );
+		}
+		internal_table->number_of_projection_columns = number_of_columns;
+	}
+	if( memory_set(
+	     internal_table->column_projection,
+	     ( number_of_column_entries == 0 ) ? 1 : 0,
+	     sizeof( uint8_t ) * internal_table->number_of_projection_columns ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column projection.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_entry_index = 0;
+	     column_entry_index < number_of_column_entries;
+	     column_entry_index++ )
+	{
+		internal_table->column_projection[ column_entries[ column_entry_index ] ] = 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_record(
+     libesedb_table_t *table,
+     int record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_internal_table_t *internal_table          = NULL;
+	static char *function                              = "libesedb_table_get_record";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_btree_get_leaf_value_by_index(
 	     internal_table->table_values_tree,
 	     (intptr_t *) internal_table->file_io_handle,
 	     internal_table->table_values_cache,
@@ -1777,11 +1946,12 @@ int libesedb_table_get_record(
 	     internal_table->template_table_definition,
 	     internal_table->pages_vector,
 	     internal_table->pages_cache,
-	     internal_table->long_values_pages_vector,
-	     internal_table->long_values_pages_cache,
+	     internal_table->pages_vector,
+	     internal_table->pages_cache,
 	     record_data_definition,
 	     internal_table->long_values_tree,
 	     internal_table->long_values_cache,
+	     internal_table->column_projection,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1796,3 +1966,1636 @@ int libesedb_table_get_record(
 	return( 1 );
 }
 
+/* Retrieves the record for a specific key
+ * The key data contains the (normalized) key as stored in the table values tree
+ * The branch pages are descended using the key and the table is not scanned
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_table_get_record_by_key(
+     libesedb_table_t *table,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_cursor_t *cursor = NULL;
+	libesedb_key_t *key       = NULL;
+	static char *function     = "libesedb_table_get_record_by_key";
+	uint8_t is_exact_match    = 0;
+	int result                = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_data_size == 0 )
+	 || ( key_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_key_initialize(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_set_data(
+	     key,
+	     key_data,
+	     key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key data.",
+		 function );
+
+		goto on_error;
+	}
+	key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+	if( libesedb_table_get_cursor(
+	     table,
+	     &cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cursor.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_cursor_seek_key(
+	          (libesedb_internal_cursor_t *) cursor,
+	          key,
+	          &is_exact_match,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek key.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( is_exact_match == 0 ) )
+	{
+		result = 0;
+	}
+	if( result != 0 )
+	{
+		if( libesedb_cursor_read_record(
+		     (libesedb_internal_cursor_t *) cursor,
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_cursor_free(
+	     &cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_free(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( *record != NULL )
+	{
+		libesedb_record_free(
+		 record,
+		 NULL );
+	}
+	if( cursor != NULL )
+	{
+		libesedb_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a cursor to sequentially read the records of the table
+ * The cursor walks the chain of leaf pages and does not read the whole table values tree
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_cursor(
+     libesedb_table_t *table,
+     libesedb_cursor_t **cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_cursor";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_cursor_initialize(
+	     cursor,
+	     internal_table->file_io_handle,
+	     internal_table->io_handle,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     internal_table->pages_vector,
+	     internal_table->pages_cache,
+	     internal_table->table_definition->table_catalog_definition->father_data_page_number,
+	     internal_table->long_values_tree,
+	     internal_table->long_values_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cursor.",
+		 function );
+
+		return( -1 );
+	}
+	( (libesedb_internal_cursor_t *) *cursor )->column_projection = internal_table->column_projection;
+
+	return( 1 );
+}
+
+/* Retrieves the value size of a specific column as stored in a column vector
+ * The value size is 0 if the column type has no fixed size
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_column_value_size(
+     libesedb_table_t *table,
+     int column_entry,
+     size_t *value_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	libesedb_record_layout_t *record_layout   = NULL;
+	static char *function                     = "libesedb_table_get_column_value_size";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	record_layout = internal_table->table_definition->record_layout;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - invalid table definition - missing record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_entry < 0 )
+	 || ( column_entry >= record_layout->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value size.",
+		 function );
+
+		return( -1 );
+	}
+	*value_size = (size_t) record_layout->columns[ column_entry ].value_size;
+
+	return( 1 );
+}
+
+/* Creates a cursor to read a batch of records
+ * The cursor reads the records with the column projection and is positioned
+ * before the first record of the batch
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_batch_cursor(
+     libesedb_internal_table_t *internal_table,
+     int first_record_entry,
+     const uint8_t *column_projection,
+     libesedb_cursor_t **cursor,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_get_batch_cursor";
+	int record_index      = 0;
+	int result            = 0;
+
+	if( internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first record entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_get_cursor(
+	     (libesedb_table_t *) internal_table,
+	     cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cursor.",
+		 function );
+
+		goto on_error;
+	}
+	( (libesedb_internal_cursor_t *) *cursor )->column_projection = column_projection;
+
+	/* The records before the batch are skipped by walking the leaf page values
+	 * without reading their record data
+	 */
+	for( record_index = 0;
+	     record_index < first_record_entry;
+	     record_index++ )
+	{
+		result = libesedb_cursor_read_next_value(
+		          (libesedb_internal_cursor_t *) *cursor,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to skip record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *cursor != NULL )
+	{
+		libesedb_cursor_free(
+		 cursor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Copies a 16-bit little-endian value into a column vector
+ */
+static void libesedb_table_copy_batch_value_16bit(
+             uint8_t *vector_value,
+             const uint8_t *value_data,
+             size_t value_size LIBESEDB_ATTRIBUTE_UNUSED )
+{
+	uint16_t value_16bit = 0;
+
+	LIBESEDB_UNREFERENCED_PARAMETER( value_size )
+
+	byte_stream_copy_to_uint16_little_endian(
+	 value_data,
+	 value_16bit );
+
+	*( (uint16_t *) vector_value ) = value_16bit;
+}
+
+/* Copies a 32-bit little-endian value into a column vector
+ */
+static void libesedb_table_copy_batch_value_32bit(
+             uint8_t *vector_value,
+             const uint8_t *value_data,
+             size_t value_size LIBESEDB_ATTRIBUTE_UNUSED )
+{
+	uint32_t value_32bit = 0;
+
+	LIBESEDB_UNREFERENCED_PARAMETER( value_size )
+
+	byte_stream_copy_to_uint32_little_endian(
+	 value_data,
+	 value_32bit );
+
+	*( (uint32_t *) vector_value ) = value_32bit;
+}
+
+/* Copies a 64-bit little-endian value into a column vector
+ */
+static void libesedb_table_copy_batch_value_64bit(
+             uint8_t *vector_value,
+             const uint8_t *value_data,
+             size_t value_size LIBESEDB_ATTRIBUTE_UNUSED )
+{
+	uint64_t value_64bit = 0;
+
+	LIBESEDB_UNREFERENCED_PARAMETER( value_size )
+
+	byte_stream_copy_to_uint64_little_endian(
+	 value_data,
+	 value_64bit );
+
+	*( (uint64_t *) vector_value ) = value_64bit;
+}
+
+/* Copies a value that is stored as-is into a column vector
+ */
+static void libesedb_table_copy_batch_value_data(
+             uint8_t *vector_value,
+             const uint8_t *value_data,
+             size_t value_size )
+{
+	memory_copy(
+	 vector_value,
+	 value_data,
+	 value_size );
+}
+
+/* Reads the values of specific columns of a batch of records
+ * The values of a column are stored consecutively in its column vector, which must
+ * contain the number of records multiplied by the value size of the column
+ * The values are stored in host byte order, a GUID value is stored as-is
+ * The column vectors must be aligned to the value size of their column
+ * The null bitmap of a column contains a bit per record, least significant bit first,
+ * that is set if the value is not NULL. The value of a NULL value is set to 0
+ * The null bitmaps are optional and must contain ( number of records + 7 ) / 8 bytes
+ * Only columns with a fixed size column type are supported
+ * The records are read in order from the chain of leaf pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_read_batch(
+     libesedb_table_t *table,
+     int first_record_entry,
+     int number_of_records,
+     const int *column_entries,
+     int number_of_column_entries,
+     uint8_t **column_vectors,
+     const size_t *column_vector_sizes,
+     uint8_t **null_bitmaps,
+     size_t null_bitmap_size,
+     libcerror_error_t **error )
+{
+	void (**copy_value_functions)(uint8_t *, const uint8_t *, size_t) = NULL;
+	libesedb_cursor_t *cursor                                          = NULL;
+	libesedb_data_type_value_t *data_type_value                        = NULL;
+	libesedb_internal_record_t *internal_record                        = NULL;
+	libesedb_internal_table_t *internal_table                          = NULL;
+	libesedb_record_layout_t *record_layout                            = NULL;
+	libesedb_record_t *record                                          = NULL;
+	uint8_t *column_projection                                         = NULL;
+	uint8_t *vector_value                                              = NULL;
+	static char *function                                              = "libesedb_table_read_batch";
+	size_t value_size                                                  = 0;
+	int column_entry                                                   = 0;
+	int column_entry_index                                             = 0;
+	int number_of_table_records                                        = 0;
+	int record_index                                                   = 0;
+	int result                                                         = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	record_layout = internal_table->table_definition->record_layout;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - invalid table definition - missing record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_column_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of column entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_vectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column vectors.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_vector_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column vector sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( null_bitmaps != NULL )
+	 && ( null_bitmap_size < ( ( (size_t) number_of_records + 7 ) / 8 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid null bitmap size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_get_number_of_records(
+	     table,
+	     &number_of_table_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_record_entry < 0 )
+	 || ( first_record_entry > number_of_table_records )
+	 || ( number_of_records > ( number_of_table_records - first_record_entry ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_entry_index = 0;
+	     column_entry_index < number_of_column_entries;
+	     column_entry_index++ )
+	{
+		column_entry = column_entries[ column_entry_index ];
+
+		if( ( column_entry < 0 )
+		 || ( column_entry >= record_layout->number_of_columns ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid column entry: %d value out of bounds.",
+			 function,
+			 column_entry_index );
+
+			return( -1 );
+		}
+		value_size = (size_t) record_layout->columns[ column_entry ].value_size;
+
+		if( value_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column entry: %d column type.",
+			 function,
+			 column_entry_index );
+
+			return( -1 );
+		}
+		if( ( column_vectors[ column_entry_index ] == NULL )
+		 || ( column_vector_sizes[ column_entry_index ] < ( (size_t) number_of_records * value_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid column vector: %d.",
+			 function,
+			 column_entry_index );
+
+			return( -1 );
+		}
+		if( null_bitmaps != NULL )
+		{
+			if( null_bitmaps[ column_entry_index ] == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+				 "%s: invalid null bitmap: %d.",
+				 function,
+				 column_entry_index );
+
+				return( -1 );
+			}
+			if( memory_set(
+			     null_bitmaps[ column_entry_index ],
+			     0,
+			     null_bitmap_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear null bitmap: %d.",
+				 function,
+				 column_entry_index );
+
+				return( -1 );
+			}
+		}
+	}
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	/* Only the values of the requested columns are read
+	 */
+	column_projection = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * record_layout->number_of_columns );
+
+	if( column_projection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column projection.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     column_projection,
+	     0,
+	     sizeof( uint8_t ) * record_layout->number_of_columns ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column projection.",
+		 function );
+
+		goto on_error;
+	}
+	/* The copy function of a column is determined once for the batch
+	 * instead of for every value
+	 */
+	copy_value_functions = (void (**)(uint8_t *, const uint8_t *, size_t)) memory_allocate(
+	                        sizeof( void (*)(uint8_t *, const uint8_t *, size_t) ) * number_of_column_entries );
+
+	if( copy_value_functions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create copy value functions.",
+		 function );
+
+		goto on_error;
+	}
+	for( column_entry_index = 0;
+	     column_entry_index < number_of_column_entries;
+	     column_entry_index++ )
+	{
+		column_entry = column_entries[ column_entry_index ];
+
+		column_projection[ column_entry ] = 1;
+
+		switch( record_layout->columns[ column_entry ].value_size )
+		{
+			case 2:
+				copy_value_functions[ column_entry_index ] = &libesedb_table_copy_batch_value_16bit;
+				break;
+
+			case 4:
+				copy_value_functions[ column_entry_index ] = &libesedb_table_copy_batch_value_32bit;
+				break;
+
+			case 8:
+				copy_value_functions[ column_entry_index ] = &libesedb_table_copy_batch_value_64bit;
+				break;
+
+			default:
+				copy_value_functions[ column_entry_index ] = &libesedb_table_copy_batch_value_data;
+				break;
+		}
+	}
+	/* The records are read by walking the chain of leaf pages
+	 */
+	if( libesedb_table_get_batch_cursor(
+	     internal_table,
+	     first_record_entry,
+	     column_projection,
+	     &cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch cursor.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libesedb_cursor_read_next_value(
+		          (libesedb_internal_cursor_t *) cursor,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 first_record_entry + record_index );
+
+			goto on_error;
+		}
+		/* The record is created once and reused for the other records of the batch
+		 */
+		if( libesedb_cursor_read_record(
+		     (libesedb_internal_cursor_t *) cursor,
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %d.",
+			 function,
+			 first_record_entry + record_index );
+
+			goto on_error;
+		}
+		internal_record = (libesedb_internal_record_t *) record;
+
+		for( column_entry_index = 0;
+		     column_entry_index < number_of_column_entries;
+		     column_entry_index++ )
+		{
+			column_entry    = column_entries[ column_entry_index ];
+			value_size      = (size_t) record_layout->columns[ column_entry ].value_size;
+			data_type_value = &( internal_record->data_type_values[ column_entry ] );
+			vector_value    = &( ( column_vectors[ column_entry_index ] )[ record_index * value_size ] );
+
+			if( data_type_value->data_size == 0 )
+			{
+				if( memory_set(
+				     vector_value,
+				     0,
+				     value_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear value: %d of record: %d.",
+					 function,
+					 column_entry_index,
+					 first_record_entry + record_index );
+
+					goto on_error;
+				}
+				continue;
+			}
+			/* Multi values and long values have no fixed size
+			 */
+			if( ( data_type_value->data_flags != 0 )
+			 || ( (size_t) data_type_value->data_size != value_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported value: %d of record: %d.",
+				 function,
+				 column_entry_index,
+				 first_record_entry + record_index );
+
+				goto on_error;
+			}
+			copy_value_functions[ column_entry_index ](
+			 vector_value,
+			 &( internal_record->values_data[ data_type_value->data_offset ] ),
+			 value_size );
+
+			if( null_bitmaps != NULL )
+			{
+				( null_bitmaps[ column_entry_index ] )[ record_index / 8 ] |= (uint8_t) ( 1 << ( record_index % 8 ) );
+			}
+		}
+	}
+	if( libesedb_record_free(
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_cursor_free(
+	     &cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free cursor.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 copy_value_functions );
+
+	memory_free(
+	 column_projection );
+
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( cursor != NULL )
+	{
+		libesedb_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	if( copy_value_functions != NULL )
+	{
+		memory_free(
+		 copy_value_functions );
+	}
+	if( column_projection != NULL )
+	{
+		memory_free(
+		 column_projection );
+	}
+	return( -1 );
+}
+
+/* Exports the values of a batch of records as an Arrow record batch
+ * The record batch is exported as a struct array with a child array per column
+ * If column_entries is NULL the values of all the columns are exported
+ * The records are read in order from the chain of leaf pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_export_arrow_batch(
+     libesedb_table_t *table,
+     int first_record_entry,
+     int number_of_records,
+     const int *column_entries,
+     int number_of_column_entries,
+     struct ArrowSchema *schema,
+     struct ArrowArray *array,
+     libcerror_error_t **error )
+{
+	libesedb_arrow_column_t **arrow_columns                  = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_cursor_t *cursor                                = NULL;
+	libesedb_internal_record_t *internal_record              = NULL;
+	libesedb_internal_table_t *internal_table                = NULL;
+	libesedb_record_layout_t *record_layout                  = NULL;
+	libesedb_record_t *record                                = NULL;
+	uint8_t *column_projection                               = NULL;
+	uint8_t *name                                            = NULL;
+	static char *function                                    = "libesedb_table_export_arrow_batch";
+	size_t name_size                                         = 0;
+	uint8_t is_multi_valued                                  = 0;
+	int column_entry                                         = 0;
+	int column_entry_index                                   = 0;
+	int number_of_table_records                              = 0;
+	int record_index                                         = 0;
+	int result                                               = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	record_layout = internal_table->table_definition->record_layout;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - invalid table definition - missing record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_entries == NULL )
+	{
+		number_of_column_entries = record_layout->number_of_columns;
+	}
+	else if( number_of_column_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of column entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( schema == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid schema.",
+		 function );
+
+		return( -1 );
+	}
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_get_number_of_records(
+	     table,
+	     &number_of_table_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_record_entry < 0 )
+	 || ( first_record_entry > number_of_table_records )
+	 || ( number_of_records > ( number_of_table_records - first_record_entry ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_entries != NULL )
+	{
+		for( column_entry_index = 0;
+		     column_entry_index < number_of_column_entries;
+		     column_entry_index++ )
+		{
+			column_entry = column_entries[ column_entry_index ];
+
+			if( ( column_entry < 0 )
+			 || ( column_entry >= record_layout->number_of_columns ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid column entry: %d value out of bounds.",
+				 function,
+				 column_entry_index );
+
+				return( -1 );
+			}
+		}
+	}
+	/* The release callbacks are cleared so the schema and array can be released on error
+	 */
+	schema->release = NULL;
+	array->release  = NULL;
+
+	if( number_of_column_entries > 0 )
+	{
+		arrow_columns = (libesedb_arrow_column_t **) memory_allocate(
+		                                              sizeof( libesedb_arrow_column_t * ) * number_of_column_entries );
+
+		if( arrow_columns == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create Arrow columns.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     arrow_columns,
+		     0,
+		     sizeof( libesedb_arrow_column_t * ) * number_of_column_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear Arrow columns.",
+			 function );
+
+			memory_free(
+			 arrow_columns );
+
+			arrow_columns = NULL;
+
+			goto on_error;
+		}
+		/* Only the values of the exported columns are read
+		 */
+		column_projection = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * record_layout->number_of_columns );
+
+		if( column_projection == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create column projection.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     column_projection,
+		     0,
+		     sizeof( uint8_t ) * record_layout->number_of_columns ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear column projection.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( column_entry_index = 0;
+	     column_entry_index < number_of_column_entries;
+	     column_entry_index++ )
+	{
+		if( column_entries != NULL )
+		{
+			column_entry = column_entries[ column_entry_index ];
+		}
+		else
+		{
+			column_entry = column_entry_index;
+		}
+		column_catalog_definition = record_layout->columns[ column_entry ].column_catalog_definition;
+
+		if( column_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column catalog definition: %d.",
+			 function,
+			 column_entry );
+
+			goto on_error;
+		}
+		if( ( column_catalog_definition->flags & LIBESEDB_COLUMN_FLAG_IS_MULTI_VALUED ) != 0 )
+		{
+			is_multi_valued = 1;
+		}
+		else
+		{
+			is_multi_valued = 0;
+		}
+		if( libesedb_arrow_column_initialize(
+		     &( arrow_columns[ column_entry_index ] ),
+		     column_catalog_definition->column_type,
+		     is_multi_valued,
+		     number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create Arrow column: %d.",
+			 function,
+			 column_entry_index );
+
+			goto on_error;
+		}
+		column_projection[ column_entry ] = 1;
+	}
+	/* The records are read by walking the chain of leaf pages
+	 */
+	if( libesedb_table_get_batch_cursor(
+	     internal_table,
+	     first_record_entry,
+	     column_projection,
+	     &cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch cursor.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libesedb_cursor_read_next_value(
+		          (libesedb_internal_cursor_t *) cursor,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 first_record_entry + record_index );
+
+			goto on_error;
+		}
+		/* The record is created once and reused for the other records of the batch
+		 */
+		if( libesedb_cursor_read_record(
+		     (libesedb_internal_cursor_t *) cursor,
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %d.",
+			 function,
+			 first_record_entry + record_index );
+
+			goto on_error;
+		}
+		internal_record = (libesedb_internal_record_t *) record;
+
+		for( column_entry_index = 0;
+		     column_entry_index < number_of_column_entries;
+		     column_entry_index++ )
+		{
+			if( column_entries != NULL )
+			{
+				column_entry = column_entries[ column_entry_index ];
+			}
+			else
+			{
+				column_entry = column_entry_index;
+			}
+			if( libesedb_arrow_column_append_record_value(
+			     arrow_columns[ column_entry_index ],
+			     internal_record,
+			     column_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append value: %d of record: %d.",
+				 function,
+				 column_entry_index,
+				 first_record_entry + record_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( record != NULL )
+	{
+		if( libesedb_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( cursor != NULL )
+	{
+		if( libesedb_cursor_free(
+		     &cursor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cursor.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_arrow_schema_initialize(
+	     schema,
+	     "+s",
+	     NULL,
+	     0,
+	     0,
+	     (int64_t) number_of_column_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize schema.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_arrow_array_initialize(
+	     array,
+	     (int64_t) number_of_records,
+	     0,
+	     1,
+	     (int64_t) number_of_column_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize array.",
+		 function );
+
+		goto on_error;
+	}
+	for( column_entry_index = 0;
+	     column_entry_index < number_of_column_entries;
+	     column_entry_index++ )
+	{
+		if( column_entries != NULL )
+		{
+			column_entry = column_entries[ column_entry_index ];
+		}
+		else
+		{
+			column_entry = column_entry_index;
+		}
+		column_catalog_definition = record_layout->columns[ column_entry ].column_catalog_definition;
+
+		if( libesedb_catalog_definition_get_utf8_name_size(
+		     column_catalog_definition,
+		     &name_size,
+		     internal_table->io_handle->ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d name size.",
+			 function,
+			 column_entry_index );
+
+			goto on_error;
+		}
+		if( name_size > 0 )
+		{
+			name = (uint8_t *) memory_allocate(
+			                    sizeof( uint8_t ) * name_size );
+
+			if( name == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create column: %d name.",
+				 function,
+				 column_entry_index );
+
+				goto on_error;
+			}
+			if( libesedb_catalog_definition_get_utf8_name(
+			     column_catalog_definition,
+			     name,
+			     name_size,
+			     internal_table->io_handle->ascii_codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column: %d name.",
+				 function,
+				 column_entry_index );
+
+				goto on_error;
+			}
+			/* The end-of-string character is added by the schema
+			 */
+			name_size -= 1;
+		}
+		if( libesedb_arrow_column_export(
+		     arrow_columns[ column_entry_index ],
+		     name,
+		     name_size,
+		     schema->children[ column_entry_index ],
+		     array->children[ column_entry_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to export Arrow column: %d.",
+			 function,
+			 column_entry_index );
+
+			goto on_error;
+		}
+		if( name != NULL )
+		{
+			memory_free(
+			 name );
+
+			name = NULL;
+		}
+		if( libesedb_arrow_column_free(
+		     &( arrow_columns[ column_entry_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free Arrow column: %d.",
+			 function,
+			 column_entry_index );
+
+			goto on_error;
+		}
+	}
+	if( arrow_columns != NULL )
+	{
+		memory_free(
+		 arrow_columns );
+	}
+	if( column_projection != NULL )
+	{
+		memory_free(
+		 column_projection );
+	}
+	return( 1 );
+
+on_error:
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( cursor != NULL )
+	{
+		libesedb_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	if( arrow_columns != NULL )
+	{
+		for( column_entry_index = 0;
+		     column_entry_index < number_of_column_entries;
+		     column_entry_index++ )
+		{
+			if( arrow_columns[ column_entry_index ] != NULL )
+			{
+				libesedb_arrow_column_free(
+				 &( arrow_columns[ column_entry_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 arrow_columns );
+	}
+	if( column_projection != NULL )
+	{
+		memory_free(
+		 column_projection );
+	}
+	libesedb_arrow_array_release(
+	 array );
+
+	libesedb_arrow_schema_release(
+	 schema );
+
+	return( -1 );
+}
+
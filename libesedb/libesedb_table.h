@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_arrow.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
@@ -59,21 +60,15 @@ struct libesedb_internal_table
 	libesedb_table_definition_t *template_table_definition;
 
 	/* The pages vector
+	 * This is a reference to the pages vector of the file
 	 */
 	libfdata_vector_t *pages_vector;
 
 	/* The pages cache
+	 * This is a reference to the pages cache of the file
 	 */
 	libfcache_cache_t *pages_cache;
 
-	/* The long values pages vector
-	 */
-	libfdata_vector_t *long_values_pages_vector;
-
-	/* The long values pages cache
-	 */
-	libfcache_cache_t *long_values_pages_cache;
-
 	/* The table values tree
 	 */
 	libfdata_btree_t *table_values_tree;
@@ -89,6 +84,23 @@ struct libesedb_internal_table
 	/* The long values cache
 	 */
 	libfcache_cache_t *long_values_cache;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* Value to indicate the number of records was determined
+	 */
+	uint8_t number_of_records_is_set;
+
+	/* The column projection
+	 * Contains a value per column that indicates if the column value is read
+	 */
+	uint8_t *column_projection;
+
+	/* The number of columns in the column projection
+	 */
+	int number_of_projection_columns;
 };
 
 int libesedb_table_initialize(
@@ -97,6 +109,8 @@ int libesedb_table_initialize(
      libesedb_io_handle_t *io_handle,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
      libcerror_error_t **error );
 
 LIBESEDB_EXTERN \
@@ -177,6 +191,14 @@ int libesedb_table_get_column(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_entry_by_utf8_name(
+     libesedb_table_t *table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *column_entry,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_number_of_indexes(
      libesedb_table_t *table,
@@ -196,6 +218,19 @@ int libesedb_table_get_number_of_records(
      int *number_of_records,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_known_number_of_records(
+     libesedb_table_t *table,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_set_column_projection(
+     libesedb_table_t *table,
+     const int *column_entries,
+     int number_of_column_entries,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_record(
      libesedb_table_t *table,
@@ -203,6 +238,58 @@ int libesedb_table_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_by_key(
+     libesedb_table_t *table,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_cursor(
+     libesedb_table_t *table,
+     libesedb_cursor_t **cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_value_size(
+     libesedb_table_t *table,
+     int column_entry,
+     size_t *value_size,
+     libcerror_error_t **error );
+
+int libesedb_table_get_batch_cursor(
+     libesedb_internal_table_t *internal_table,
+     int first_record_entry,
+     const uint8_t *column_projection,
+     libesedb_cursor_t **cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_read_batch(
+     libesedb_table_t *table,
+     int first_record_entry,
+     int number_of_records,
+     const int *column_entries,
+     int number_of_column_entries,
+     uint8_t **column_vectors,
+     const size_t *column_vector_sizes,
+     uint8_t **null_bitmaps,
+     size_t null_bitmap_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_export_arrow_batch(
+     libesedb_table_t *table,
+     int first_record_entry,
+     int number_of_records,
+     const int *column_entries,
+     int number_of_column_entries,
+     struct ArrowSchema *schema,
+     struct ArrowArray *array,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
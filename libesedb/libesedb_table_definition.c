@@ -266,6 +266,22 @@ int libesedb_table_definition_free(
 
 			result = -1;
 		}
+		if( ( *table_definition )->record_layout != NULL )
+		{
+			if( libesedb_record_layout_free(
+			     &( ( *table_definition )->record_layout ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record layout.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *table_definition );
 
@@ -274,6 +290,77 @@ int libesedb_table_definition_free(
 	return( result );
 }
 
+/* Initializes the record layout of the table definition
+ * The record layout is created once and used to read all the records of the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_definition_initialize_record_layout(
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libcerror_error_t **error )
+{
+	libcdata_list_t *template_table_column_catalog_definition_list = NULL;
+	static char *function                                          = "libesedb_table_definition_initialize_record_layout";
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->column_catalog_definition_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing column catalog definition list.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->record_layout != NULL )
+	{
+		return( 1 );
+	}
+	if( template_table_definition != NULL )
+	{
+		if( template_table_definition->column_catalog_definition_list == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid template table definition - missing column catalog definition list.",
+			 function );
+
+			return( -1 );
+		}
+		template_table_column_catalog_definition_list = template_table_definition->column_catalog_definition_list;
+	}
+	if( libesedb_record_layout_initialize(
+	     &( table_definition->record_layout ),
+	     template_table_column_catalog_definition_list,
+	     table_definition->column_catalog_definition_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record layout.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Sets a long value catalog definition to the table definition
  * Returns 1 if successful or -1 on error
  */
@@ -516,3 +603,123 @@ int libesedb_table_definition_append_index_catalog_definition(
 	return( 1 );
 }
 
+/* Retrieves the column catalog definition for a specific column identifier
+ * Returns 1 if successful, 0 if no such column catalog definition or -1 on error
+ */
+int libesedb_table_definition_get_column_catalog_definition_by_identifier(
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	static char *function                 = "libesedb_table_definition_get_column_catalog_definition_by_identifier";
+	int element_index                     = 0;
+	int number_of_elements                = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_first_element(
+	     table_definition->column_catalog_definition_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first element of column catalog definition list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_number_of_elements(
+	     table_definition->column_catalog_definition_list,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements in column catalog definition list.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( *column_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column catalog definition: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( ( *column_catalog_definition )->identifier == column_identifier )
+		{
+			return( 1 );
+		}
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next element of element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+	}
+	*column_catalog_definition = NULL;
+
+	return( 0 );
+}
+
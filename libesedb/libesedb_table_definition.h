@@ -28,6 +28,7 @@
 #include "libesedb_catalog_definition.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_record_layout.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -56,6 +57,10 @@ struct libesedb_table_definition
 	/* The index catalog definition list
 	 */
 	libcdata_list_t *index_catalog_definition_list;
+
+	/* The record layout
+	 */
+	libesedb_record_layout_t *record_layout;
 };
 
 int libesedb_table_definition_initialize(
@@ -67,6 +72,11 @@ int libesedb_table_definition_free(
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error );
 
+int libesedb_table_definition_initialize_record_layout(
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libcerror_error_t **error );
+
 int libesedb_table_definition_set_long_value_catalog_definition(
      libesedb_table_definition_t *table_definition,
      libesedb_catalog_definition_t *long_value_catalog_definition,
@@ -87,6 +97,12 @@ int libesedb_table_definition_append_index_catalog_definition(
      libesedb_catalog_definition_t *index_catalog_definition,
      libcerror_error_t **error );
 
+int libesedb_table_definition_get_column_catalog_definition_by_identifier(
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -35,6 +35,7 @@
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libesedb_column {}	libesedb_column_t;
+typedef struct libesedb_cursor {}	libesedb_cursor_t;
 typedef struct libesedb_file {}		libesedb_file_t;
 typedef struct libesedb_index {}	libesedb_index_t;
 typedef struct libesedb_long_value {}	libesedb_long_value_t;
@@ -44,6 +45,7 @@ typedef struct libesedb_table {}	libesedb_table_t;
 
 #else
 typedef intptr_t libesedb_column_t;
+typedef intptr_t libesedb_cursor_t;
 typedef intptr_t libesedb_file_t;
 typedef intptr_t libesedb_index_t;
 typedef intptr_t libesedb_long_value_t;
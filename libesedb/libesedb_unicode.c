@@ -0,0 +1,887 @@
+/*
+ * Unicode string functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_unicode.h"
+
+#if defined( HAVE_LIBESEDB_UNICODE_X86_SIMD )
+#include <immintrin.h>
+#endif
+
+#if defined( HAVE_LIBESEDB_UNICODE_X86_SIMD )
+
+/* The instruction set used to convert the strings
+ * -1 represents that the instruction set has not been determined yet
+ */
+static int libesedb_unicode_instruction_set = -1;
+
+/* Determines the UTF-8 string size of blocks of 16 UTF-16 little-endian code units using SSE2
+ * Stops at the first block that contains an end of string character or a surrogate
+ */
+static __attribute__((target("sse2"))) void libesedb_unicode_utf8_string_size_from_utf16_stream_sse2(
+                                             const uint8_t *utf16_stream,
+                                             size_t utf16_stream_size,
+                                             size_t *utf16_stream_index,
+                                             size_t *utf8_string_size )
+{
+	uint64_t values[ 2 ];
+
+	__m128i single_byte_mask       = _mm_set1_epi16( (short) 0xff80 );
+	__m128i double_byte_mask       = _mm_set1_epi16( (short) 0xf800 );
+	__m128i surrogate_value        = _mm_set1_epi16( (short) 0xd800 );
+	__m128i one_value              = _mm_set1_epi8( 1 );
+	__m128i zero_value             = _mm_setzero_si128();
+	__m128i first_code_units       = _mm_setzero_si128();
+	__m128i first_upper_bits       = _mm_setzero_si128();
+	__m128i second_code_units      = _mm_setzero_si128();
+	__m128i second_upper_bits      = _mm_setzero_si128();
+	__m128i smaller_sizes          = _mm_setzero_si128();
+	size_t safe_utf16_stream_index = *utf16_stream_index;
+	size_t safe_utf8_string_size   = *utf8_string_size;
+
+	while( ( utf16_stream_size - safe_utf16_stream_index ) >= 32 )
+	{
+		first_code_units  = _mm_loadu_si128(
+		                     (const __m128i *) &( utf16_stream[ safe_utf16_stream_index ] ) );
+		second_code_units = _mm_loadu_si128(
+		                     (const __m128i *) &( utf16_stream[ safe_utf16_stream_index + 16 ] ) );
+
+		first_upper_bits  = _mm_and_si128( first_code_units, double_byte_mask );
+		second_upper_bits = _mm_and_si128( second_code_units, double_byte_mask );
+
+		if( _mm_movemask_epi8(
+		     _mm_or_si128(
+		      _mm_or_si128(
+		       _mm_cmpeq_epi16( first_code_units, zero_value ),
+		       _mm_cmpeq_epi16( second_code_units, zero_value ) ),
+		      _mm_or_si128(
+		       _mm_cmpeq_epi16( first_upper_bits, surrogate_value ),
+		       _mm_cmpeq_epi16( second_upper_bits, surrogate_value ) ) ) ) != 0 )
+		{
+			break;
+		}
+		/* A code unit is encoded in 3 bytes, 1 byte less if less than 0x0800
+		 * and another byte less if less than 0x0080. The number of bytes less
+		 * is counted per code unit and summed into 64-bit values.
+		 */
+		smaller_sizes = _mm_add_epi64(
+		                 smaller_sizes,
+		                 _mm_sad_epu8(
+		                  _mm_add_epi8(
+		                   _mm_and_si128(
+		                    _mm_packs_epi16(
+		                     _mm_cmpeq_epi16(
+		                      _mm_and_si128( first_code_units, single_byte_mask ),
+		                      zero_value ),
+		                     _mm_cmpeq_epi16(
+		                      _mm_and_si128( second_code_units, single_byte_mask ),
+		                      zero_value ) ),
+		                    one_value ),
+		                   _mm_and_si128(
+		                    _mm_packs_epi16(
+		                     _mm_cmpeq_epi16( first_upper_bits, zero_value ),
+		                     _mm_cmpeq_epi16( second_upper_bits, zero_value ) ),
+		                    one_value ) ),
+		                  zero_value ) );
+
+		safe_utf8_string_size   += 48;
+		safe_utf16_stream_index += 32;
+	}
+	_mm_storeu_si128(
+	 (__m128i *) values,
+	 smaller_sizes );
+
+	*utf16_stream_index = safe_utf16_stream_index;
+	*utf8_string_size   = safe_utf8_string_size - (size_t) ( values[ 0 ] + values[ 1 ] );
+}
+
+/* Determines the UTF-8 string size of blocks of 32 UTF-16 little-endian code units using AVX2
+ * Stops at the first block that contains an end of string character or a surrogate
+ */
+static __attribute__((target("avx2"))) void libesedb_unicode_utf8_string_size_from_utf16_stream_avx2(
+                                             const uint8_t *utf16_stream,
+                                             size_t utf16_stream_size,
+                                             size_t *utf16_stream_index,
+                                             size_t *utf8_string_size )
+{
+	uint64_t values[ 4 ];
+
+	__m256i single_byte_mask       = _mm256_set1_epi16( (short) 0xff80 );
+	__m256i double_byte_mask       = _mm256_set1_epi16( (short) 0xf800 );
+	__m256i surrogate_value        = _mm256_set1_epi16( (short) 0xd800 );
+	__m256i one_value              = _mm256_set1_epi8( 1 );
+	__m256i zero_value             = _mm256_setzero_si256();
+	__m256i first_code_units       = _mm256_setzero_si256();
+	__m256i first_upper_bits       = _mm256_setzero_si256();
+	__m256i second_code_units      = _mm256_setzero_si256();
+	__m256i second_upper_bits      = _mm256_setzero_si256();
+	__m256i smaller_sizes          = _mm256_setzero_si256();
+	size_t safe_utf16_stream_index = *utf16_stream_index;
+	size_t safe_utf8_string_size   = *utf8_string_size;
+
+	while( ( utf16_stream_size - safe_utf16_stream_index ) >= 64 )
+	{
+		first_code_units  = _mm256_loadu_si256(
+		                     (const __m256i *) &( utf16_stream[ safe_utf16_stream_index ] ) );
+		second_code_units = _mm256_loadu_si256(
+		                     (const __m256i *) &( utf16_stream[ safe_utf16_stream_index + 32 ] ) );
+
+		first_upper_bits  = _mm256_and_si256( first_code_units, double_byte_mask );
+		second_upper_bits = _mm256_and_si256( second_code_units, double_byte_mask );
+
+		if( _mm256_movemask_epi8(
+		     _mm256_or_si256(
+		      _mm256_or_si256(
+		       _mm256_cmpeq_epi16( first_code_units, zero_value ),
+		       _mm256_cmpeq_epi16( second_code_units, zero_value ) ),
+		      _mm256_or_si256(
+		       _mm256_cmpeq_epi16( first_upper_bits, surrogate_value ),
+		       _mm256_cmpeq_epi16( second_upper_bits, surrogate_value ) ) ) ) != 0 )
+		{
+			break;
+		}
+		/* A code unit is encoded in 3 bytes, 1 byte less if less than 0x0800
+		 * and another byte less if less than 0x0080. The number of bytes less
+		 * is counted per code unit and summed into 64-bit values.
+		 */
+		smaller_sizes = _mm256_add_epi64(
+		                 smaller_sizes,
+		                 _mm256_sad_epu8(
+		                  _mm256_add_epi8(
+		                   _mm256_and_si256(
+		                    _mm256_packs_epi16(
+		                     _mm256_cmpeq_epi16(
+		                      _mm256_and_si256( first_code_units, single_byte_mask ),
+		                      zero_value ),
+		                     _mm256_cmpeq_epi16(
+		                      _mm256_and_si256( second_code_units, single_byte_mask ),
+		                      zero_value ) ),
+		                    one_value ),
+		                   _mm256_and_si256(
+		                    _mm256_packs_epi16(
+		                     _mm256_cmpeq_epi16( first_upper_bits, zero_value ),
+		                     _mm256_cmpeq_epi16( second_upper_bits, zero_value ) ),
+		                    one_value ) ),
+		                  zero_value ) );
+
+		safe_utf8_string_size   += 96;
+		safe_utf16_stream_index += 64;
+	}
+	_mm256_storeu_si256(
+	 (__m256i *) values,
+	 smaller_sizes );
+
+	*utf16_stream_index = safe_utf16_stream_index;
+	*utf8_string_size   = safe_utf8_string_size - (size_t) ( values[ 0 ] + values[ 1 ] + values[ 2 ] + values[ 3 ] );
+}
+
+/* Copies blocks of 16 UTF-16 little-endian code units to an UTF-8 string using SSE2
+ * Only blocks that consist entirely of 1 byte or entirely of 2 byte UTF-8 encoded
+ * code units are copied, the function stops at the first other block
+ */
+static __attribute__((target("sse2"))) void libesedb_unicode_utf8_string_copy_from_utf16_stream_sse2(
+                                             uint8_t *utf8_string,
+                                             size_t utf8_string_size,
+                                             size_t *utf8_string_index,
+                                             const uint8_t *utf16_stream,
+                                             size_t utf16_stream_size,
+                                             size_t *utf16_stream_index )
+{
+	__m128i single_byte_mask       = _mm_set1_epi16( (short) 0xff80 );
+	__m128i double_byte_mask       = _mm_set1_epi16( (short) 0xf800 );
+	__m128i lower_bits_mask        = _mm_set1_epi16( 0x003f );
+	__m128i lead_byte_value        = _mm_set1_epi16( 0x00c0 );
+	__m128i continuation_value     = _mm_set1_epi16( 0x0080 );
+	__m128i zero_value             = _mm_setzero_si128();
+	__m128i first_code_units       = _mm_setzero_si128();
+	__m128i second_code_units      = _mm_setzero_si128();
+	__m128i single_bytes           = _mm_setzero_si128();
+	size_t safe_utf16_stream_index = *utf16_stream_index;
+	size_t safe_utf8_string_index  = *utf8_string_index;
+	int single_byte_bitmask        = 0;
+	int double_byte_bitmask        = 0;
+
+	while( ( ( utf16_stream_size - safe_utf16_stream_index ) >= 32 )
+	    && ( ( utf8_string_size - safe_utf8_string_index ) >= 32 ) )
+	{
+		first_code_units  = _mm_loadu_si128(
+		                     (const __m128i *) &( utf16_stream[ safe_utf16_stream_index ] ) );
+		second_code_units = _mm_loadu_si128(
+		                     (const __m128i *) &( utf16_stream[ safe_utf16_stream_index + 16 ] ) );
+
+		single_byte_bitmask = _mm_movemask_epi8(
+		                       _mm_packs_epi16(
+		                        _mm_cmpeq_epi16(
+		                         _mm_and_si128( first_code_units, single_byte_mask ),
+		                         zero_value ),
+		                        _mm_cmpeq_epi16(
+		                         _mm_and_si128( second_code_units, single_byte_mask ),
+		                         zero_value ) ) );
+
+		if( single_byte_bitmask == 0xffff )
+		{
+			single_bytes = _mm_packus_epi16( first_code_units, second_code_units );
+
+			/* Leave the end of string character to the caller
+			 */
+			if( _mm_movemask_epi8( _mm_cmpeq_epi8( single_bytes, zero_value ) ) != 0 )
+			{
+				break;
+			}
+			_mm_storeu_si128(
+			 (__m128i *) &( utf8_string[ safe_utf8_string_index ] ),
+			 single_bytes );
+
+			safe_utf8_string_index += 16;
+		}
+		else if( single_byte_bitmask == 0 )
+		{
+			double_byte_bitmask = _mm_movemask_epi8(
+			                       _mm_packs_epi16(
+			                        _mm_cmpeq_epi16(
+			                         _mm_and_si128( first_code_units, double_byte_mask ),
+			                         zero_value ),
+			                        _mm_cmpeq_epi16(
+			                         _mm_and_si128( second_code_units, double_byte_mask ),
+			                         zero_value ) ) );
+
+			if( double_byte_bitmask != 0xffff )
+			{
+				break;
+			}
+			/* Every code unit is stored as a lead byte followed by a continuation byte
+			 */
+			_mm_storeu_si128(
+			 (__m128i *) &( utf8_string[ safe_utf8_string_index ] ),
+			 _mm_or_si128(
+			  _mm_or_si128(
+			   _mm_srli_epi16( first_code_units, 6 ),
+			   lead_byte_value ),
+			  _mm_slli_epi16(
+			   _mm_or_si128(
+			    _mm_and_si128( first_code_units, lower_bits_mask ),
+			    continuation_value ),
+			   8 ) ) );
+
+			_mm_storeu_si128(
+			 (__m128i *) &( utf8_string[ safe_utf8_string_index + 16 ] ),
+			 _mm_or_si128(
+			  _mm_or_si128(
+			   _mm_srli_epi16( second_code_units, 6 ),
+			   lead_byte_value ),
+			  _mm_slli_epi16(
+			   _mm_or_si128(
+			    _mm_and_si128( second_code_units, lower_bits_mask ),
+			    continuation_value ),
+			   8 ) ) );
+
+			safe_utf8_string_index += 32;
+		}
+		else
+		{
+			break;
+		}
+		safe_utf16_stream_index += 32;
+	}
+	*utf16_stream_index = safe_utf16_stream_index;
+	*utf8_string_index  = safe_utf8_string_index;
+}
+
+/* Copies blocks of 32 UTF-16 little-endian code units to an UTF-8 string using AVX2
+ * Only blocks that consist entirely of 1 byte or entirely of 2 byte UTF-8 encoded
+ * code units are copied, the function stops at the first other block
+ */
+static __attribute__((target("avx2"))) void libesedb_unicode_utf8_string_copy_from_utf16_stream_avx2(
+                                             uint8_t *utf8_string,
+                                             size_t utf8_string_size,
+                                             size_t *utf8_string_index,
+                                             const uint8_t *utf16_stream,
+                                             size_t utf16_stream_size,
+                                             size_t *utf16_stream_index )
+{
+	__m256i single_byte_mask       = _mm256_set1_epi16( (short) 0xff80 );
+	__m256i double_byte_mask       = _mm256_set1_epi16( (short) 0xf800 );
+	__m256i lower_bits_mask        = _mm256_set1_epi16( 0x003f );
+	__m256i lead_byte_value        = _mm256_set1_epi16( 0x00c0 );
+	__m256i continuation_value     = _mm256_set1_epi16( 0x0080 );
+	__m256i zero_value             = _mm256_setzero_si256();
+	__m256i first_code_units       = _mm256_setzero_si256();
+	__m256i second_code_units      = _mm256_setzero_si256();
+	__m256i single_bytes           = _mm256_setzero_si256();
+	size_t safe_utf16_stream_index = *utf16_stream_index;
+	size_t safe_utf8_string_index  = *utf8_string_index;
+	uint32_t single_byte_bitmask   = 0;
+	uint32_t double_byte_bitmask   = 0;
+
+	while( ( ( utf16_stream_size - safe_utf16_stream_index ) >= 64 )
+	    && ( ( utf8_string_size - safe_utf8_string_index ) >= 64 ) )
+	{
+		first_code_units  = _mm256_loadu_si256(
+		                     (const __m256i *) &( utf16_stream[ safe_utf16_stream_index ] ) );
+		second_code_units = _mm256_loadu_si256(
+		                     (const __m256i *) &( utf16_stream[ safe_utf16_stream_index + 32 ] ) );
+
+		single_byte_bitmask = (uint32_t) _mm256_movemask_epi8(
+		                                  _mm256_packs_epi16(
+		                                   _mm256_cmpeq_epi16(
+		                                    _mm256_and_si256( first_code_units, single_byte_mask ),
+		                                    zero_value ),
+		                                   _mm256_cmpeq_epi16(
+		                                    _mm256_and_si256( second_code_units, single_byte_mask ),
+		                                    zero_value ) ) );
+
+		if( single_byte_bitmask == 0xffffffffUL )
+		{
+			/* The pack operates on 128-bit lanes, hence the 64-bit elements
+			 * are reordered to restore the order of the code units
+			 */
+			single_bytes = _mm256_permute4x64_epi64(
+			                _mm256_packus_epi16( first_code_units, second_code_units ),
+			                0xd8 );
+
+			/* Leave the end of string character to the caller
+			 */
+			if( _mm256_movemask_epi8( _mm256_cmpeq_epi8( single_bytes, zero_value ) ) != 0 )
+			{
+				break;
+			}
+			_mm256_storeu_si256(
+			 (__m256i *) &( utf8_string[ safe_utf8_string_index ] ),
+			 single_bytes );
+
+			safe_utf8_string_index += 32;
+		}
+		else if( single_byte_bitmask == 0 )
+		{
+			double_byte_bitmask = (uint32_t) _mm256_movemask_epi8(
+			                                  _mm256_packs_epi16(
+			                                   _mm256_cmpeq_epi16(
+			                                    _mm256_and_si256( first_code_units, double_byte_mask ),
+			                                    zero_value ),
+			                                   _mm256_cmpeq_epi16(
+			                                    _mm256_and_si256( second_code_units, double_byte_mask ),
+			                                    zero_value ) ) );
+
+			if( double_byte_bitmask != 0xffffffffUL )
+			{
+				break;
+			}
+			/* Every code unit is stored as a lead byte followed by a continuation byte
+			 */
+			_mm256_storeu_si256(
+			 (__m256i *) &( utf8_string[ safe_utf8_string_index ] ),
+			 _mm256_or_si256(
+			  _mm256_or_si256(
+			   _mm256_srli_epi16( first_code_units, 6 ),
+			   lead_byte_value ),
+			  _mm256_slli_epi16(
+			   _mm256_or_si256(
+			    _mm256_and_si256( first_code_units, lower_bits_mask ),
+			    continuation_value ),
+			   8 ) ) );
+
+			_mm256_storeu_si256(
+			 (__m256i *) &( utf8_string[ safe_utf8_string_index + 32 ] ),
+			 _mm256_or_si256(
+			  _mm256_or_si256(
+			   _mm256_srli_epi16( second_code_units, 6 ),
+			   lead_byte_value ),
+			  _mm256_slli_epi16(
+			   _mm256_or_si256(
+			    _mm256_and_si256( second_code_units, lower_bits_mask ),
+			    continuation_value ),
+			   8 ) ) );
+
+			safe_utf8_string_index += 64;
+		}
+		else
+		{
+			break;
+		}
+		safe_utf16_stream_index += 64;
+	}
+	*utf16_stream_index = safe_utf16_stream_index;
+	*utf8_string_index  = safe_utf8_string_index;
+}
+
+#endif /* defined( HAVE_LIBESEDB_UNICODE_X86_SIMD ) */
+
+/* Retrieves the best instruction set supported by the CPU
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_unicode_get_supported_instruction_set(
+     int *instruction_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_unicode_get_supported_instruction_set";
+
+	if( instruction_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction set.",
+		 function );
+
+		return( -1 );
+	}
+	*instruction_set = LIBESEDB_UNICODE_INSTRUCTION_SET_NONE;
+
+#if defined( HAVE_LIBESEDB_UNICODE_X86_SIMD )
+	__builtin_cpu_init();
+
+	if( __builtin_cpu_supports( "avx2" ) )
+	{
+		*instruction_set = LIBESEDB_UNICODE_INSTRUCTION_SET_AVX2;
+	}
+	else if( __builtin_cpu_supports( "sse2" ) )
+	{
+		*instruction_set = LIBESEDB_UNICODE_INSTRUCTION_SET_SSE2;
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the instruction set used to convert the strings
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_unicode_get_instruction_set(
+     int *instruction_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_unicode_get_instruction_set";
+
+	if( instruction_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_UNICODE_X86_SIMD )
+	if( libesedb_unicode_instruction_set == -1 )
+	{
+		if( libesedb_unicode_get_supported_instruction_set(
+		     &libesedb_unicode_instruction_set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve supported instruction set.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*instruction_set = libesedb_unicode_instruction_set;
+#else
+	*instruction_set = LIBESEDB_UNICODE_INSTRUCTION_SET_NONE;
+#endif
+	return( 1 );
+}
+
+/* Sets the instruction set used to convert the strings
+ * The instruction set must be supported by the CPU
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_unicode_set_instruction_set(
+     int instruction_set,
+     libcerror_error_t **error )
+{
+	static char *function         = "libesedb_unicode_set_instruction_set";
+	int supported_instruction_set = 0;
+
+	if( ( instruction_set != LIBESEDB_UNICODE_INSTRUCTION_SET_NONE )
+	 && ( instruction_set != LIBESEDB_UNICODE_INSTRUCTION_SET_SSE2 )
+	 && ( instruction_set != LIBESEDB_UNICODE_INSTRUCTION_SET_AVX2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported instruction set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_unicode_get_supported_instruction_set(
+	     &supported_instruction_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve supported instruction set.",
+		 function );
+
+		return( -1 );
+	}
+	if( instruction_set > supported_instruction_set )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: instruction set not supported by CPU.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_UNICODE_X86_SIMD )
+	libesedb_unicode_instruction_set = instruction_set;
+#endif
+	return( 1 );
+}
+
+/* Determines the size of an UTF-8 string from an UTF-16 little-endian stream
+ * The returned size includes the end of string character
+ * Streams with a byte order mark or surrogates are not supported
+ * and should be converted with libuna instead
+ * Returns 1 if successful, 0 if the stream is not supported or -1 on error
+ */
+int libesedb_unicode_utf8_string_size_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "libesedb_unicode_utf8_string_size_from_utf16_stream";
+	size_t safe_utf8_string_size   = 0;
+	size_t utf16_stream_index      = 0;
+	uint16_t utf16_character       = 0;
+
+#if defined( HAVE_LIBESEDB_UNICODE_X86_SIMD )
+	int instruction_set            = 0;
+#endif
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size == 0 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 utf16_stream,
+	 utf16_character );
+
+	if( ( utf16_character == 0xfeff )
+	 || ( utf16_character == 0xfffe ) )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBESEDB_UNICODE_X86_SIMD )
+	if( libesedb_unicode_get_instruction_set(
+	     &instruction_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve instruction set.",
+		 function );
+
+		return( -1 );
+	}
+	if( instruction_set == LIBESEDB_UNICODE_INSTRUCTION_SET_AVX2 )
+	{
+		libesedb_unicode_utf8_string_size_from_utf16_stream_avx2(
+		 utf16_stream,
+		 utf16_stream_size,
+		 &utf16_stream_index,
+		 &safe_utf8_string_size );
+	}
+	else if( instruction_set == LIBESEDB_UNICODE_INSTRUCTION_SET_SSE2 )
+	{
+		libesedb_unicode_utf8_string_size_from_utf16_stream_sse2(
+		 utf16_stream,
+		 utf16_stream_size,
+		 &utf16_stream_index,
+		 &safe_utf8_string_size );
+	}
+#endif
+	while( utf16_stream_index < utf16_stream_size )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 utf16_character );
+
+		utf16_stream_index += 2;
+
+		if( utf16_character == 0 )
+		{
+			break;
+		}
+		if( ( utf16_character & 0xf800 ) == 0xd800 )
+		{
+			return( 0 );
+		}
+		if( utf16_character < 0x0080 )
+		{
+			safe_utf8_string_size += 1;
+		}
+		else if( utf16_character < 0x0800 )
+		{
+			safe_utf8_string_size += 2;
+		}
+		else
+		{
+			safe_utf8_string_size += 3;
+		}
+	}
+	/* Add the end of string character
+	 */
+	*utf8_string_size = safe_utf8_string_size + 1;
+
+	return( 1 );
+}
+
+/* Copies an UTF-8 string from an UTF-16 little-endian stream
+ * The size should include the end of string character
+ * Streams with a byte order mark or surrogates and strings that are too small
+ * are not supported and should be converted with libuna instead
+ * Returns 1 if successful, 0 if the stream is not supported or -1 on error
+ */
+int libesedb_unicode_utf8_string_copy_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "libesedb_unicode_utf8_string_copy_from_utf16_stream";
+	size_t utf16_stream_index      = 0;
+	size_t utf8_string_index       = 0;
+	uint16_t utf16_character       = 0;
+
+#if defined( HAVE_LIBESEDB_UNICODE_X86_SIMD )
+	size_t bulk_utf16_stream_index = 0;
+	int instruction_set            = 0;
+#endif
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size == 0 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 utf16_stream,
+	 utf16_character );
+
+	if( ( utf16_character == 0xfeff )
+	 || ( utf16_character == 0xfffe ) )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBESEDB_UNICODE_X86_SIMD )
+	if( libesedb_unicode_get_instruction_set(
+	     &instruction_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve instruction set.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( utf16_stream_index < utf16_stream_size )
+	{
+#if defined( HAVE_LIBESEDB_UNICODE_X86_SIMD )
+		/* Convert in bulk again once the block the bulk conversion stopped at has been converted
+		 */
+		if( ( instruction_set != LIBESEDB_UNICODE_INSTRUCTION_SET_NONE )
+		 && ( utf16_stream_index >= bulk_utf16_stream_index ) )
+		{
+			if( instruction_set == LIBESEDB_UNICODE_INSTRUCTION_SET_AVX2 )
+			{
+				libesedb_unicode_utf8_string_copy_from_utf16_stream_avx2(
+				 utf8_string,
+				 utf8_string_size,
+				 &utf8_string_index,
+				 utf16_stream,
+				 utf16_stream_size,
+				 &utf16_stream_index );
+
+				bulk_utf16_stream_index = utf16_stream_index + 64;
+			}
+			else if( instruction_set == LIBESEDB_UNICODE_INSTRUCTION_SET_SSE2 )
+			{
+				libesedb_unicode_utf8_string_copy_from_utf16_stream_sse2(
+				 utf8_string,
+				 utf8_string_size,
+				 &utf8_string_index,
+				 utf16_stream,
+				 utf16_stream_size,
+				 &utf16_stream_index );
+
+				bulk_utf16_stream_index = utf16_stream_index + 32;
+			}
+			if( utf16_stream_index >= utf16_stream_size )
+			{
+				break;
+			}
+		}
+#endif
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 utf16_character );
+
+		utf16_stream_index += 2;
+
+		if( utf16_character == 0 )
+		{
+			break;
+		}
+		if( ( utf16_character & 0xf800 ) == 0xd800 )
+		{
+			return( 0 );
+		}
+		if( utf16_character < 0x0080 )
+		{
+			if( utf8_string_index >= utf8_string_size )
+			{
+				return( 0 );
+			}
+			utf8_string[ utf8_string_index++ ] = (uint8_t) utf16_character;
+		}
+		else if( utf16_character < 0x0800 )
+		{
+			if( ( utf8_string_size - utf8_string_index ) < 2 )
+			{
+				return( 0 );
+			}
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xc0 | ( utf16_character >> 6 ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( utf16_character & 0x3f ) );
+		}
+		else
+		{
+			if( ( utf8_string_size - utf8_string_index ) < 3 )
+			{
+				return( 0 );
+			}
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xe0 | ( utf16_character >> 12 ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( utf16_character >> 6 ) & 0x3f ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( utf16_character & 0x3f ) );
+		}
+	}
+	/* Add the end of string character
+	 */
+	if( utf8_string_index >= utf8_string_size )
+	{
+		return( 0 );
+	}
+	utf8_string[ utf8_string_index ] = 0;
+
+	return( 1 );
+}
+
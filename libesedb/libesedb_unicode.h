@@ -0,0 +1,79 @@
+/*
+ * Unicode string functions
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_UNICODE_H )
+#define _LIBESEDB_UNICODE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#if defined( __clang__ ) || ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) )
+#define HAVE_LIBESEDB_UNICODE_X86_SIMD	1
+#endif
+#endif
+
+/* The Unicode instruction sets
+ */
+enum LIBESEDB_UNICODE_INSTRUCTION_SETS
+{
+	LIBESEDB_UNICODE_INSTRUCTION_SET_NONE	= 0,
+	LIBESEDB_UNICODE_INSTRUCTION_SET_SSE2	= 1,
+	LIBESEDB_UNICODE_INSTRUCTION_SET_AVX2	= 2
+};
+
+int libesedb_unicode_get_supported_instruction_set(
+     int *instruction_set,
+     libcerror_error_t **error );
+
+int libesedb_unicode_get_instruction_set(
+     int *instruction_set,
+     libcerror_error_t **error );
+
+int libesedb_unicode_set_instruction_set(
+     int instruction_set,
+     libcerror_error_t **error );
+
+int libesedb_unicode_utf8_string_size_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libesedb_unicode_utf8_string_copy_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_UNICODE_H ) */
+
@@ -0,0 +1,790 @@
+/*
+ * Library Arrow C data interface functions test program
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_arrow.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_arrow_column_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_arrow_column_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libesedb_arrow_column_t *arrow_column = NULL;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_arrow_column_initialize(
+	          &arrow_column,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          0,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "arrow_column",
+	 arrow_column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_arrow_column_free(
+	          &arrow_column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "arrow_column",
+	 arrow_column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_arrow_column_initialize(
+	          NULL,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          0,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arrow_column = (libesedb_arrow_column_t *) 0x12345678UL;
+
+	result = libesedb_arrow_column_initialize(
+	          &arrow_column,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          0,
+	          4,
+	          &error );
+
+	arrow_column = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_arrow_column_initialize(
+	          &arrow_column,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          0,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arrow_column != NULL )
+	{
+		libesedb_arrow_column_free(
+		 &arrow_column,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_arrow_column_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_arrow_column_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_arrow_column_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_arrow_column_append_value and libesedb_arrow_column_export functions
+ * of a fixed size column type
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_arrow_column_export_fixed_size(
+     void )
+{
+	struct ArrowArray array;
+	struct ArrowSchema schema;
+
+	uint8_t element_value_data[ 4 ] = { 0x04, 0x03, 0x02, 0x01 };
+
+	libcerror_error_t *error              = NULL;
+	libesedb_arrow_column_t *arrow_column = NULL;
+	uint8_t *element_data                 = NULL;
+	const int32_t *values                 = NULL;
+	const uint8_t *validity_bitmap        = NULL;
+	int result                            = 0;
+
+	schema.release = NULL;
+	array.release  = NULL;
+
+	result = libesedb_arrow_column_initialize(
+	          &arrow_column,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          0,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_arrow_column_get_element_data(
+	          arrow_column,
+	          4,
+	          &element_data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "element_data",
+	 element_data );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 element_data,
+	 element_value_data,
+	 4 );
+
+	result = libesedb_arrow_column_append_element(
+	          arrow_column,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_arrow_column_append_value(
+	          arrow_column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_arrow_column_append_value(
+	          arrow_column,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_arrow_column_export(
+	          arrow_column,
+	          (uint8_t *) "Value",
+	          5,
+	          &schema,
+	          &array,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          schema.format,
+	          "i",
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          schema.name,
+	          "Value",
+	          6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "array.length",
+	 array.length,
+	 (int64_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "array.null_count",
+	 array.null_count,
+	 (int64_t) 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "array.n_buffers",
+	 array.n_buffers,
+	 (int64_t) 2 );
+
+	validity_bitmap = (const uint8_t *) array.buffers[ 0 ];
+	values          = (const int32_t *) array.buffers[ 1 ];
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "validity_bitmap[ 0 ]",
+	 validity_bitmap[ 0 ],
+	 (uint8_t) 0x01 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT32(
+	 "values[ 0 ]",
+	 values[ 0 ],
+	 (int32_t) 0x01020304L );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT32(
+	 "values[ 1 ]",
+	 values[ 1 ],
+	 (int32_t) 0 );
+
+	array.release(
+	 &array );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "array.release",
+	 array.release );
+
+	schema.release(
+	 &schema );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "schema.release",
+	 schema.release );
+
+	/* Test error cases
+	 */
+	result = libesedb_arrow_column_append_value(
+	          arrow_column,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_arrow_column_get_element_data(
+	          arrow_column,
+	          2,
+	          &element_data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_arrow_column_free(
+	          &arrow_column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( array.release != NULL )
+	{
+		array.release(
+		 &array );
+	}
+	if( schema.release != NULL )
+	{
+		schema.release(
+		 &schema );
+	}
+	if( arrow_column != NULL )
+	{
+		libesedb_arrow_column_free(
+		 &arrow_column,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_arrow_column_append_value and libesedb_arrow_column_export functions
+ * of a multi valued variable size column type
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_arrow_column_export_multi_valued(
+     void )
+{
+	struct ArrowArray array;
+	struct ArrowSchema schema;
+
+	libcerror_error_t *error              = NULL;
+	libesedb_arrow_column_t *arrow_column = NULL;
+	uint8_t *element_data                 = NULL;
+	const uint8_t *data                   = NULL;
+	const int32_t *offsets                = NULL;
+	int result                            = 0;
+
+	schema.release = NULL;
+	array.release  = NULL;
+
+	result = libesedb_arrow_column_initialize(
+	          &arrow_column,
+	          LIBESEDB_COLUMN_TYPE_TEXT,
+	          1,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_arrow_column_append_value(
+	          arrow_column,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_arrow_column_get_element_data(
+	          arrow_column,
+	          2,
+	          &element_data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 element_data,
+	 "ab",
+	 2 );
+
+	result = libesedb_arrow_column_append_element(
+	          arrow_column,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_arrow_column_get_element_data(
+	          arrow_column,
+	          1,
+	          &element_data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_data[ 0 ] = (uint8_t) 'c';
+
+	result = libesedb_arrow_column_append_element(
+	          arrow_column,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_arrow_column_append_value(
+	          arrow_column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_arrow_column_export(
+	          arrow_column,
+	          NULL,
+	          0,
+	          &schema,
+	          &array,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          schema.format,
+	          "+l",
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "schema.n_children",
+	 schema.n_children,
+	 (int64_t) 1 );
+
+	result = memory_compare(
+	          schema.children[ 0 ]->format,
+	          "u",
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "array.length",
+	 array.length,
+	 (int64_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "array.null_count",
+	 array.null_count,
+	 (int64_t) 1 );
+
+	offsets = (const int32_t *) array.buffers[ 1 ];
+
+	ESEDB_TEST_ASSERT_EQUAL_INT32(
+	 "offsets[ 1 ]",
+	 offsets[ 1 ],
+	 (int32_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT32(
+	 "offsets[ 2 ]",
+	 offsets[ 2 ],
+	 (int32_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "array.children[ 0 ]->length",
+	 array.children[ 0 ]->length,
+	 (int64_t) 2 );
+
+	offsets = (const int32_t *) array.children[ 0 ]->buffers[ 1 ];
+	data    = (const uint8_t *) array.children[ 0 ]->buffers[ 2 ];
+
+	ESEDB_TEST_ASSERT_EQUAL_INT32(
+	 "offsets[ 1 ]",
+	 offsets[ 1 ],
+	 (int32_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT32(
+	 "offsets[ 2 ]",
+	 offsets[ 2 ],
+	 (int32_t) 3 );
+
+	result = memory_compare(
+	          data,
+	          "abc",
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	array.release(
+	 &array );
+
+	schema.release(
+	 &schema );
+
+	/* Clean up
+	 */
+	result = libesedb_arrow_column_free(
+	          &arrow_column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( array.release != NULL )
+	{
+		array.release(
+		 &array );
+	}
+	if( schema.release != NULL )
+	{
+		schema.release(
+		 &schema );
+	}
+	if( arrow_column != NULL )
+	{
+		libesedb_arrow_column_free(
+		 &arrow_column,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_arrow_column_initialize",
+	 esedb_test_arrow_column_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_arrow_column_free",
+	 esedb_test_arrow_column_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_arrow_column_export_fixed_size",
+	 esedb_test_arrow_column_export_fixed_size );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_arrow_column_export_multi_valued",
+	 esedb_test_arrow_column_export_multi_valued );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
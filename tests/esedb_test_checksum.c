@@ -1326,6 +1326,153 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_checksum_set_instruction_set function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_checksum_set_instruction_set(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	uint32_t ecc_checksum_value   = 0;
+	uint32_t xor_checksum_value   = 0;
+	int instruction_set           = 0;
+	int result                    = 0;
+	int supported_instruction_set = 0;
+
+	result = libesedb_checksum_get_supported_instruction_set(
+	          &supported_instruction_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( instruction_set = LIBESEDB_CHECKSUM_INSTRUCTION_SET_NONE;
+	     instruction_set <= supported_instruction_set;
+	     instruction_set++ )
+	{
+		result = libesedb_checksum_set_instruction_set(
+		          instruction_set,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_checksum_calculate_little_endian_ecc32(
+		          &ecc_checksum_value,
+		          &xor_checksum_value,
+		          esedb_test_checksum_page_0x620_0x0c_data,
+		          8192,
+		          8,
+		          10,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "ecc_checksum_value",
+		 ecc_checksum_value,
+		 (uint32_t) 0xf7e60819 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_checksum_calculate_little_endian_xor32(
+		          &xor_checksum_value,
+		          &( esedb_test_checksum_page_0x620_0x09_data[ 4 ] ),
+		          8192 - 4,
+		          0x89abcdef,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "xor_checksum_value",
+		 xor_checksum_value,
+		 (uint32_t) 0x27e4a431UL );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libesedb_checksum_set_instruction_set(
+	          supported_instruction_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_checksum_set_instruction_set(
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_checksum_get_instruction_set(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -1353,6 +1500,10 @@ int main(
 	 "libesedb_checksum_calculate_little_endian_xor32",
 	 esedb_test_checksum_calculate_little_endian_xor32 );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_checksum_set_instruction_set",
+	 esedb_test_checksum_set_instruction_set );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -68,6 +68,47 @@ uint8_t esedb_test_compression_xpress_compressed_data[ 1 ] = {
 	0x18
 };
 
+uint8_t esedb_test_compression_xpress_compressed_data_with_matches[ 28 ] = {
+	0x18, 0x34, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+	0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x7f, 0x00, 0xa6, 0x3f, 0x00
+};
+
+uint8_t esedb_test_compression_xpress_uncompressed_data[ 52 ] = {
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+	0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+	0x38, 0x39, 0x61, 0x62
+};
+
+uint8_t esedb_test_compression_xpress_compressed_data_with_invalid_offset[ 9 ] = {
+	0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00
+};
+
+uint8_t esedb_test_compression_xpress10_compressed_data[ 284 ] = {
+	0x30, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xd6, 0x7c,
+	0xdf, 0x8d, 0x04, 0x9e, 0x15, 0x02, 0x27, 0x00, 0xc5, 0x00, 0x00, 0x02
+};
+
+uint8_t esedb_test_compression_xpress9_compressed_data[ 2 ] = {
+	0x28, 0x00
+};
+
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
 /* Tests the libesedb_compression_7bit_decompress_get_size function
@@ -434,22 +475,24 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_decompress_get_size function
+/* Tests the libesedb_compression_xpress_decompress function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_decompress_get_size(
+int esedb_test_compression_xpress_decompress(
      void )
 {
-	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 0;
-	int result                    = 0;
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_decompress_get_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
-	          &uncompressed_data_size,
+	result = libesedb_compression_xpress_decompress(
+	          esedb_test_compression_xpress_compressed_data_with_matches,
+	          28,
+	          uncompressed_data,
+	          52,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -457,21 +500,27 @@ int esedb_test_compression_decompress_get_size(
 	 result,
 	 1 );
 
-	ESEDB_TEST_ASSERT_EQUAL_SIZE(
-	 "uncompressed_data_size",
-	 uncompressed_data_size,
-	 (size_t) 56 );
-
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	result = memory_compare(
+	          uncompressed_data,
+	          esedb_test_compression_xpress_uncompressed_data,
+	          52 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libesedb_compression_decompress_get_size(
+	result = libesedb_compression_xpress_decompress(
 	          NULL,
-	          50,
-	          &uncompressed_data_size,
+	          28,
+	          uncompressed_data,
+	          52,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -486,10 +535,11 @@ int esedb_test_compression_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress_get_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          (size_t) SSIZE_MAX + 1,
-	          &uncompressed_data_size,
+	result = libesedb_compression_xpress_decompress(
+	          esedb_test_compression_xpress_compressed_data_with_matches,
+	          28,
+	          NULL,
+	          52,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -504,10 +554,13 @@ int esedb_test_compression_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress_get_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          0,
-	          &uncompressed_data_size,
+	/* Test decompression with an uncompressed data size that is too small
+	 */
+	result = libesedb_compression_xpress_decompress(
+	          esedb_test_compression_xpress_compressed_data_with_matches,
+	          28,
+	          uncompressed_data,
+	          8,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -522,10 +575,13 @@ int esedb_test_compression_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress_get_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
-	          NULL,
+	/* Test decompression with a match offset that exceeds the uncompressed data
+	 */
+	result = libesedb_compression_xpress_decompress(
+	          esedb_test_compression_xpress_compressed_data_with_invalid_offset,
+	          9,
+	          uncompressed_data,
+	          4,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -551,10 +607,10 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_decompress function
+/* Tests the libesedb_compression_xpress_huffman_decompress function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_decompress(
+int esedb_test_compression_xpress_huffman_decompress(
      void )
 {
 	uint8_t uncompressed_data[ 64 ];
@@ -564,11 +620,11 @@ int esedb_test_compression_decompress(
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_decompress(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
+	result = libesedb_compression_xpress_huffman_decompress(
+	          &( esedb_test_compression_xpress10_compressed_data[ 13 ] ),
+	          284 - 13,
 	          uncompressed_data,
-	          64,
+	          52,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -582,8 +638,8 @@ int esedb_test_compression_decompress(
 
 	result = memory_compare(
 	          uncompressed_data,
-	          esedb_test_compression_7bit_uncompressed_data,
-	          56 );
+	          esedb_test_compression_xpress_uncompressed_data,
+	          52 );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -592,11 +648,11 @@ int esedb_test_compression_decompress(
 
 	/* Test error cases
 	 */
-	result = libesedb_compression_decompress(
+	result = libesedb_compression_xpress_huffman_decompress(
 	          NULL,
-	          50,
+	          284 - 13,
 	          uncompressed_data,
-	          64,
+	          52,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -611,11 +667,11 @@ int esedb_test_compression_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress(
-	          esedb_test_compression_7bit_compressed_data,
+	result = libesedb_compression_xpress_huffman_decompress(
+	          &( esedb_test_compression_xpress10_compressed_data[ 13 ] ),
 	          (size_t) SSIZE_MAX + 1,
 	          uncompressed_data,
-	          64,
+	          52,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -630,11 +686,30 @@ int esedb_test_compression_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress(
-	          esedb_test_compression_7bit_compressed_data,
-	          0,
+	result = libesedb_compression_xpress_huffman_decompress(
+	          &( esedb_test_compression_xpress10_compressed_data[ 13 ] ),
+	          284 - 13,
+	          NULL,
+	          52,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_xpress_huffman_decompress(
+	          &( esedb_test_compression_xpress10_compressed_data[ 13 ] ),
+	          284 - 13,
 	          uncompressed_data,
-	          64,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -649,11 +724,55 @@ int esedb_test_compression_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
-	          NULL,
-	          64,
+	/* Test decompression with compressed data that is too small
+	 */
+	result = libesedb_compression_xpress_huffman_decompress(
+	          &( esedb_test_compression_xpress10_compressed_data[ 13 ] ),
+	          128,
+	          uncompressed_data,
+	          52,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompression with a bit stream that is truncated after the code sizes
+	 */
+	result = libesedb_compression_xpress_huffman_decompress(
+	          &( esedb_test_compression_xpress10_compressed_data[ 13 ] ),
+	          256 + 8,
+	          uncompressed_data,
+	          52,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompression with an uncompressed data size that is too small
+	 */
+	result = libesedb_compression_xpress_huffman_decompress(
+	          &( esedb_test_compression_xpress10_compressed_data[ 13 ] ),
+	          284 - 13,
+	          uncompressed_data,
+	          40,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -679,22 +798,22 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_get_utf8_string_size function
+/* Tests the libesedb_compression_xpress10_decompress_get_size function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_get_utf8_string_size(
+int esedb_test_compression_xpress10_decompress_get_size(
      void )
 {
-	libcerror_error_t *error = NULL;
-	size_t utf8_string_size  = 0;
-	int result               = 0;
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_get_utf8_string_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
-	          &utf8_string_size,
+	result = libesedb_compression_xpress10_decompress_get_size(
+	          esedb_test_compression_xpress10_compressed_data,
+	          284,
+	          &uncompressed_data_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -703,9 +822,9 @@ int esedb_test_compression_get_utf8_string_size(
 	 1 );
 
 	ESEDB_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_size",
-	 utf8_string_size,
-	 (size_t) 56 );
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 52 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -713,10 +832,10 @@ int esedb_test_compression_get_utf8_string_size(
 
 	/* Test error cases
 	 */
-	result = libesedb_compression_get_utf8_string_size(
+	result = libesedb_compression_xpress10_decompress_get_size(
 	          NULL,
-	          50,
-	          &utf8_string_size,
+	          284,
+	          &uncompressed_data_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -731,10 +850,10 @@ int esedb_test_compression_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_get_utf8_string_size(
-	          esedb_test_compression_7bit_compressed_data,
+	result = libesedb_compression_xpress10_decompress_get_size(
+	          esedb_test_compression_xpress10_compressed_data,
 	          (size_t) SSIZE_MAX + 1,
-	          &utf8_string_size,
+	          &uncompressed_data_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -749,10 +868,10 @@ int esedb_test_compression_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_get_utf8_string_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          0,
-	          &utf8_string_size,
+	result = libesedb_compression_xpress10_decompress_get_size(
+	          esedb_test_compression_xpress10_compressed_data,
+	          12,
+	          &uncompressed_data_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -767,10 +886,28 @@ int esedb_test_compression_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_get_utf8_string_size(
+	result = libesedb_compression_xpress10_decompress_get_size(
+	          esedb_test_compression_xpress10_compressed_data,
+	          284,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_xpress10_decompress_get_size(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
-	          NULL,
+	          &uncompressed_data_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -796,23 +933,23 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_copy_to_utf8_string function
+/* Tests the libesedb_compression_xpress10_decompress function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_copy_to_utf8_string(
+int esedb_test_compression_xpress10_decompress(
      void )
 {
-	uint8_t utf8_string[ 64 ];
+	uint8_t uncompressed_data[ 64 ];
 
 	libcerror_error_t *error = NULL;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_copy_to_utf8_string(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
-	          utf8_string,
+	result = libesedb_compression_xpress10_decompress(
+	          esedb_test_compression_xpress10_compressed_data,
+	          284,
+	          uncompressed_data,
 	          64,
 	          &error );
 
@@ -826,9 +963,9 @@ int esedb_test_compression_copy_to_utf8_string(
 	 error );
 
 	result = memory_compare(
-	          utf8_string,
-	          esedb_test_compression_7bit_uncompressed_utf8_string,
-	          sizeof( uint8_t ) * 56 );
+	          uncompressed_data,
+	          esedb_test_compression_xpress_uncompressed_data,
+	          52 );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -837,29 +974,10 @@ int esedb_test_compression_copy_to_utf8_string(
 
 	/* Test error cases
 	 */
-	result = libesedb_compression_copy_to_utf8_string(
+	result = libesedb_compression_xpress10_decompress(
 	          NULL,
-	          50,
-	          utf8_string,
-	          64,
-	          &error );
-
-	ESEDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libesedb_compression_copy_to_utf8_string(
-	          esedb_test_compression_7bit_compressed_data,
-	          (size_t) SSIZE_MAX + 1,
-	          utf8_string,
+	          284,
+	          uncompressed_data,
 	          64,
 	          &error );
 
@@ -875,10 +993,10 @@ int esedb_test_compression_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_copy_to_utf8_string(
-	          esedb_test_compression_7bit_compressed_data,
-	          0,
-	          utf8_string,
+	result = libesedb_compression_xpress10_decompress(
+	          esedb_test_compression_xpress10_compressed_data,
+	          284,
+	          NULL,
 	          64,
 	          &error );
 
@@ -894,11 +1012,11 @@ int esedb_test_compression_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_copy_to_utf8_string(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
-	          NULL,
-	          64,
+	result = libesedb_compression_xpress10_decompress(
+	          esedb_test_compression_xpress10_compressed_data,
+	          284,
+	          uncompressed_data,
+	          40,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -924,22 +1042,22 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_get_utf16_string_size function
+/* Tests the libesedb_compression_decompress_get_size function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_get_utf16_string_size(
+int esedb_test_compression_decompress_get_size(
      void )
 {
-	libcerror_error_t *error = NULL;
-	size_t utf16_string_size = 0;
-	int result               = 0;
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_get_utf16_string_size(
+	result = libesedb_compression_decompress_get_size(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
-	          &utf16_string_size,
+	          &uncompressed_data_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -948,26 +1066,908 @@ int esedb_test_compression_get_utf16_string_size(
 	 1 );
 
 	ESEDB_TEST_ASSERT_EQUAL_SIZE(
-	 "utf16_string_size",
-	 utf16_string_size,
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
 	 (size_t) 56 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libesedb_compression_get_utf16_string_size(
-	          NULL,
-	          50,
-	          &utf16_string_size,
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_xpress10_compressed_data,
+	          284,
+	          &uncompressed_data_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 52 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_decompress_get_size(
+	          NULL,
+	          50,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test retrieving the size with an unsupported compression scheme
+	 */
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_xpress9_compressed_data,
+	          2,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_decompress(
+	          NULL,
+	          50,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_get_utf8_string_size_from_uncompressed_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_get_utf8_string_size_from_uncompressed_data(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	          NULL,
+	          50,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_get_utf8_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_get_utf8_string_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_get_utf8_string_size(
+	          NULL,
+	          50,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_copy_uncompressed_data_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_copy_uncompressed_data_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_copy_uncompressed_data_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          esedb_test_compression_7bit_uncompressed_utf8_string,
+	          sizeof( uint8_t ) * 56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_copy_uncompressed_data_to_utf8_string(
+	          NULL,
+	          50,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_uncompressed_data_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_uncompressed_data_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          NULL,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_uncompressed_data_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          utf8_string,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_copy_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_copy_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          esedb_test_compression_7bit_uncompressed_utf8_string,
+	          sizeof( uint8_t ) * 56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_copy_to_utf8_string(
+	          NULL,
+	          50,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_get_utf16_string_size_from_uncompressed_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_get_utf16_string_size_from_uncompressed_data(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	          NULL,
+	          50,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_get_utf16_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_get_utf16_string_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_get_utf16_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_get_utf16_string_size(
+	          NULL,
+	          50,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	ESEDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1041,6 +2041,144 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_compression_copy_uncompressed_data_to_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_copy_uncompressed_data_to_utf16_string(
+     void )
+{
+	uint16_t utf16_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_copy_uncompressed_data_to_utf16_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          utf16_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          esedb_test_compression_7bit_uncompressed_utf16_string,
+	          sizeof( uint16_t ) * 56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_copy_uncompressed_data_to_utf16_string(
+	          NULL,
+	          50,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          utf16_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_uncompressed_data_to_utf16_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          utf16_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_uncompressed_data_to_utf16_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          NULL,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_copy_uncompressed_data_to_utf16_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          utf16_string,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libesedb_compression_copy_to_utf16_string function
  * Returns 1 if successful or 0 if not
  */
@@ -1169,6 +2307,135 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_compression_set_instruction_set function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_set_instruction_set(
+     void )
+{
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error      = NULL;
+	int instruction_set           = 0;
+	int result                    = 0;
+	int supported_instruction_set = 0;
+
+	result = libesedb_compression_get_supported_instruction_set(
+	          &supported_instruction_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( instruction_set = LIBESEDB_COMPRESSION_INSTRUCTION_SET_NONE;
+	     instruction_set <= supported_instruction_set;
+	     instruction_set++ )
+	{
+		result = libesedb_compression_set_instruction_set(
+		          instruction_set,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_compression_7bit_decompress(
+		          esedb_test_compression_7bit_compressed_data,
+		          50,
+		          uncompressed_data,
+		          64,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          esedb_test_compression_7bit_uncompressed_data,
+		          56 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libesedb_compression_set_instruction_set(
+	          supported_instruction_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_set_instruction_set(
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_instruction_set(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -1200,7 +2467,21 @@ int main(
 	 "libesedb_compression_xpress_decompress_get_size",
 	 esedb_test_compression_xpress_decompress_get_size );
 
-	/* TODO: add tests for libesedb_compression_xpress_decompress */
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_xpress_decompress",
+	 esedb_test_compression_xpress_decompress );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_xpress_huffman_decompress",
+	 esedb_test_compression_xpress_huffman_decompress );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_xpress10_decompress_get_size",
+	 esedb_test_compression_xpress10_decompress_get_size );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_xpress10_decompress",
+	 esedb_test_compression_xpress10_decompress );
 
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_decompress_get_size",
@@ -1210,22 +2491,42 @@ int main(
 	 "libesedb_compression_decompress",
 	 esedb_test_compression_decompress );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_get_utf8_string_size_from_uncompressed_data",
+	 esedb_test_compression_get_utf8_string_size_from_uncompressed_data );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_get_utf8_string_size",
 	 esedb_test_compression_get_utf8_string_size );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_copy_uncompressed_data_to_utf8_string",
+	 esedb_test_compression_copy_uncompressed_data_to_utf8_string );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_copy_to_utf8_string",
 	 esedb_test_compression_copy_to_utf8_string );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_get_utf16_string_size_from_uncompressed_data",
+	 esedb_test_compression_get_utf16_string_size_from_uncompressed_data );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_get_utf16_string_size",
 	 esedb_test_compression_get_utf16_string_size );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_copy_uncompressed_data_to_utf16_string",
+	 esedb_test_compression_copy_uncompressed_data_to_utf16_string );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_copy_to_utf16_string",
 	 esedb_test_compression_copy_to_utf16_string );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_set_instruction_set",
+	 esedb_test_compression_set_instruction_set );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
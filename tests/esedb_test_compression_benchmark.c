@@ -0,0 +1,456 @@
+/*
+ * Library compression functions benchmark program
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_compression.h"
+
+/* The size of the benchmark payloads
+ * The uncompressed size of XPRESS compressed data is stored in 16 bits
+ */
+#define ESEDB_TEST_COMPRESSION_BENCHMARK_DATA_SIZE		65000
+
+/* The size of the compressed benchmark payloads
+ * This includes the worst case overhead of the compression indicators
+ */
+#define ESEDB_TEST_COMPRESSION_BENCHMARK_COMPRESSED_DATA_SIZE	( ESEDB_TEST_COMPRESSION_BENCHMARK_DATA_SIZE + ( ESEDB_TEST_COMPRESSION_BENCHMARK_DATA_SIZE / 8 ) + 16 )
+
+/* The minimum duration of a benchmark in clock ticks
+ */
+#define ESEDB_TEST_COMPRESSION_BENCHMARK_MINIMUM_DURATION	( CLOCKS_PER_SEC / 2 )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+uint8_t esedb_test_compression_benchmark_data[ ESEDB_TEST_COMPRESSION_BENCHMARK_DATA_SIZE ];
+
+uint8_t esedb_test_compression_benchmark_compressed_data[ ESEDB_TEST_COMPRESSION_BENCHMARK_COMPRESSED_DATA_SIZE ];
+
+uint8_t esedb_test_compression_benchmark_uncompressed_data[ ESEDB_TEST_COMPRESSION_BENCHMARK_DATA_SIZE ];
+
+uint16_t esedb_test_compression_benchmark_hash_table[ 4096 ];
+
+const char *esedb_test_compression_benchmark_words[ 16 ] = {
+	"Microsoft", "Windows", "Search", "System", "ItemName", "Document", "Users",
+	"AppData", "Local", "Temp", "Program Files", "Outlook", "Message", "Subject",
+	"{2F1E5C8A-0D6B-4E4B-9C3A-7F1C5E6B2A90}", "C:\\Users\\Public\\Documents\\" };
+
+/* Retrieves the next pseudo random value
+ * Returns the pseudo random value
+ */
+uint32_t esedb_test_compression_benchmark_random(
+          uint32_t *seed )
+{
+	*seed = ( *seed * 1103515245UL ) + 12345;
+
+	return( ( *seed >> 16 ) & 0x7fff );
+}
+
+/* Fills the benchmark data with UTF-16 little-endian text that resembles Windows Search strings
+ */
+void esedb_test_compression_benchmark_fill_text(
+      uint8_t *data,
+      size_t data_size )
+{
+	const char *word     = NULL;
+	size_t data_offset   = 0;
+	uint32_t seed        = 0x5eed;
+
+	while( ( data_offset + 2 ) <= data_size )
+	{
+		word = esedb_test_compression_benchmark_words[ esedb_test_compression_benchmark_random( &seed ) % 16 ];
+
+		while( ( *word != 0 )
+		    && ( ( data_offset + 2 ) <= data_size ) )
+		{
+			data[ data_offset++ ] = (uint8_t) *word++;
+			data[ data_offset++ ] = 0;
+		}
+		if( ( data_offset + 2 ) <= data_size )
+		{
+			data[ data_offset++ ] = (uint8_t) ' ';
+			data[ data_offset++ ] = 0;
+		}
+	}
+	while( data_offset < data_size )
+	{
+		data[ data_offset++ ] = 0;
+	}
+}
+
+/* Fills the benchmark data with pseudo random bytes that are mostly stored as literals
+ */
+void esedb_test_compression_benchmark_fill_binary(
+      uint8_t *data,
+      size_t data_size )
+{
+	size_t data_offset = 0;
+	uint32_t seed      = 0xb1a5;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) esedb_test_compression_benchmark_random( &seed );
+	}
+}
+
+/* Fills the benchmark data with long runs of the same byte value
+ */
+void esedb_test_compression_benchmark_fill_runs(
+      uint8_t *data,
+      size_t data_size )
+{
+	size_t data_offset = 0;
+	size_t run_size    = 0;
+	uint32_t seed      = 0x2a2a;
+	uint8_t byte_value = 0;
+
+	while( data_offset < data_size )
+	{
+		byte_value = (uint8_t) esedb_test_compression_benchmark_random( &seed );
+		run_size   = 64 + ( esedb_test_compression_benchmark_random( &seed ) % 4096 );
+
+		while( ( run_size > 0 )
+		    && ( data_offset < data_size ) )
+		{
+			data[ data_offset++ ] = byte_value;
+
+			run_size--;
+		}
+	}
+}
+
+/* Compresses data using a greedy XPRESS (LZ77) encoder
+ * The encoder only needs to produce valid input for the decompressor
+ * Returns the compressed data size or 0 on error
+ */
+size_t esedb_test_compression_benchmark_xpress_compress(
+        const uint8_t *data,
+        size_t data_size,
+        uint8_t *compressed_data,
+        size_t compressed_data_size )
+{
+	size_t compressed_data_offset      = 0;
+	size_t compression_indicator_index = 0;
+	size_t compression_shared_index    = 0;
+	size_t data_offset                 = 0;
+	size_t match_offset                = 0;
+	size_t match_size                  = 0;
+	size_t maximum_match_size          = 0;
+	size_t size_value                  = 0;
+	uint32_t compression_indicator     = 0;
+	uint32_t hash_value                = 0;
+	uint16_t candidate_offset          = 0;
+	int number_of_indicator_bits       = 0;
+
+	if( ( data_size > 65535 )
+	 || ( compressed_data_size < ( data_size + ( data_size / 8 ) + 16 ) ) )
+	{
+		return( 0 );
+	}
+	memory_set(
+	 esedb_test_compression_benchmark_hash_table,
+	 0,
+	 sizeof( uint16_t ) * 4096 );
+
+	compressed_data[ 0 ] = 0x18;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( compressed_data[ 1 ] ),
+	 data_size );
+
+	compression_indicator_index = 3;
+	compressed_data_offset      = 7;
+
+	while( data_offset < data_size )
+	{
+		if( number_of_indicator_bits == 32 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( compressed_data[ compression_indicator_index ] ),
+			 compression_indicator );
+
+			compression_indicator_index = compressed_data_offset;
+			compressed_data_offset     += 4;
+			compression_indicator       = 0;
+			number_of_indicator_bits    = 0;
+		}
+		match_size = 0;
+
+		if( ( data_offset + 3 ) <= data_size )
+		{
+			hash_value = ( (uint32_t) data[ data_offset ] << 16 )
+			           | ( (uint32_t) data[ data_offset + 1 ] << 8 )
+			           | data[ data_offset + 2 ];
+			hash_value = ( hash_value * 2654435761UL ) >> 20;
+			hash_value &= 0x0fff;
+
+			candidate_offset = esedb_test_compression_benchmark_hash_table[ hash_value ];
+
+			esedb_test_compression_benchmark_hash_table[ hash_value ] = (uint16_t) ( data_offset + 1 );
+
+			if( candidate_offset > 0 )
+			{
+				match_offset = data_offset - ( candidate_offset - 1 );
+
+				if( match_offset <= 8192 )
+				{
+					maximum_match_size = data_size - data_offset;
+
+					if( maximum_match_size > 32771 )
+					{
+						maximum_match_size = 32771;
+					}
+					while( ( match_size < maximum_match_size )
+					    && ( data[ data_offset - match_offset + match_size ] == data[ data_offset + match_size ] ) )
+					{
+						match_size++;
+					}
+				}
+			}
+		}
+		if( match_size >= 3 )
+		{
+			compression_indicator |= 0x80000000UL >> number_of_indicator_bits;
+
+			size_value = match_size - 3;
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 ( ( match_offset - 1 ) << 3 ) | ( size_value < 7 ? size_value : 7 ) );
+
+			compressed_data_offset += 2;
+
+			if( size_value >= 7 )
+			{
+				if( compression_shared_index == 0 )
+				{
+					compression_shared_index = compressed_data_offset;
+
+					compressed_data[ compressed_data_offset++ ] = (uint8_t) ( size_value - 7 < 15 ? size_value - 7 : 15 );
+				}
+				else
+				{
+					compressed_data[ compression_shared_index ] |= (uint8_t) ( ( size_value - 7 < 15 ? size_value - 7 : 15 ) << 4 );
+
+					compression_shared_index = 0;
+				}
+				if( size_value >= ( 7 + 15 ) )
+				{
+					compressed_data[ compressed_data_offset++ ] = (uint8_t) ( size_value - 22 < 255 ? size_value - 22 : 255 );
+
+					if( size_value >= ( 7 + 15 + 255 ) )
+					{
+						byte_stream_copy_from_uint16_little_endian(
+						 &( compressed_data[ compressed_data_offset ] ),
+						 size_value );
+
+						compressed_data_offset += 2;
+					}
+				}
+			}
+			data_offset += match_size;
+		}
+		else
+		{
+			compressed_data[ compressed_data_offset++ ] = data[ data_offset++ ];
+		}
+		number_of_indicator_bits++;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ compression_indicator_index ] ),
+	 compression_indicator );
+
+	return( compressed_data_offset );
+}
+
+/* Benchmarks the libesedb_compression_xpress_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_benchmark_xpress_decompress(
+     const char *payload_name,
+     void (*fill_function)(
+            uint8_t *data,
+            size_t data_size ) )
+{
+	libcerror_error_t *error      = NULL;
+	clock_t end_time              = 0;
+	clock_t start_time            = 0;
+	double number_of_seconds      = 0.0;
+	size_t compressed_data_size   = 0;
+	uint64_t number_of_bytes      = 0;
+	int number_of_iterations      = 0;
+	int result                    = 0;
+
+	fill_function(
+	 esedb_test_compression_benchmark_data,
+	 ESEDB_TEST_COMPRESSION_BENCHMARK_DATA_SIZE );
+
+	compressed_data_size = esedb_test_compression_benchmark_xpress_compress(
+	                        esedb_test_compression_benchmark_data,
+	                        ESEDB_TEST_COMPRESSION_BENCHMARK_DATA_SIZE,
+	                        esedb_test_compression_benchmark_compressed_data,
+	                        ESEDB_TEST_COMPRESSION_BENCHMARK_COMPRESSED_DATA_SIZE );
+
+	if( compressed_data_size == 0 )
+	{
+		goto on_error;
+	}
+
+	/* Verify the decompressed data before measuring
+	 */
+	result = libesedb_compression_xpress_decompress(
+	          esedb_test_compression_benchmark_compressed_data,
+	          compressed_data_size,
+	          esedb_test_compression_benchmark_uncompressed_data,
+	          ESEDB_TEST_COMPRESSION_BENCHMARK_DATA_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          esedb_test_compression_benchmark_uncompressed_data,
+	          esedb_test_compression_benchmark_data,
+	          ESEDB_TEST_COMPRESSION_BENCHMARK_DATA_SIZE );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	start_time = clock();
+
+	do
+	{
+		result = libesedb_compression_xpress_decompress(
+		          esedb_test_compression_benchmark_compressed_data,
+		          compressed_data_size,
+		          esedb_test_compression_benchmark_uncompressed_data,
+		          ESEDB_TEST_COMPRESSION_BENCHMARK_DATA_SIZE,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		number_of_bytes += ESEDB_TEST_COMPRESSION_BENCHMARK_DATA_SIZE;
+
+		number_of_iterations++;
+
+		end_time = clock();
+	}
+	while( ( end_time - start_time ) < ESEDB_TEST_COMPRESSION_BENCHMARK_MINIMUM_DURATION );
+
+	number_of_seconds = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	fprintf(
+	 stdout,
+	 "XPRESS decompress %-7s: %6" PRIzd " -> %6d bytes, %7d iterations, %7.3f GB/s\n",
+	 payload_name,
+	 compressed_data_size,
+	 ESEDB_TEST_COMPRESSION_BENCHMARK_DATA_SIZE,
+	 number_of_iterations,
+	 ( (double) number_of_bytes / number_of_seconds ) / 1000000000.0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	if( esedb_test_compression_benchmark_xpress_decompress(
+	     "text",
+	     &esedb_test_compression_benchmark_fill_text ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_compression_benchmark_xpress_decompress(
+	     "binary",
+	     &esedb_test_compression_benchmark_fill_binary ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_compression_benchmark_xpress_decompress(
+	     "runs",
+	     &esedb_test_compression_benchmark_fill_runs ) != 1 )
+	{
+		goto on_error;
+	}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,2434 @@
+/*
+ * Library cursor type test program
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_cursor.h"
+#include "../libesedb/libesedb_data_definition.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_key.h"
+#include "../libesedb/libesedb_multi_value.h"
+#include "../libesedb/libesedb_page.h"
+#include "../libesedb/libesedb_page_value.h"
+#include "../libesedb/libesedb_record.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+/* Tests the libesedb_cursor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_cursor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_cursor_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_cursor_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_cursor_reset(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_cursor_reset(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_cursor_set_upper_bound function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_cursor_set_upper_bound(
+     void )
+{
+	uint8_t key_data[ 4 ] = { 0x7f, 0x00, 0x00, 0x01 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_cursor_set_upper_bound(
+	          NULL,
+	          key_data,
+	          4,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_cursor_append_filter_equal function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_cursor_append_filter_equal(
+     void )
+{
+	uint8_t value_data[ 4 ] = { 0x01, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_cursor_append_filter_equal(
+	          NULL,
+	          1,
+	          value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_cursor_clear_filter function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_cursor_clear_filter(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_cursor_clear_filter(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_cursor_move_to_next function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_cursor_move_to_next(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_cursor_move_to_next(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_cursor_get_key_value_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_cursor_get_key_value_data_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t data_size         = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_cursor_get_key_value_data_size(
+	          NULL,
+	          0,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_cursor_get_next_record function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_cursor_get_next_record(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libesedb_record_t *record = NULL;
+	int result                = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_cursor_get_next_record(
+	          NULL,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_cursor_read_next_record function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_cursor_read_next_record(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libesedb_record_t *record = NULL;
+	int result                = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_cursor_read_next_record(
+	          NULL,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_cursor_get_value_key_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_cursor_get_value_key_size(
+     void )
+{
+	uint8_t page_value_data[ 8 ] = {
+		0x03, 0x00, 0x7f, 0x80, 0x01, 0x12, 0x34, 0x56 };
+
+	libesedb_page_t page;
+	libesedb_page_value_t page_value;
+
+	libcerror_error_t *error = NULL;
+	uint16_t key_size        = 0;
+	int result               = 0;
+
+	page.flags = LIBESEDB_PAGE_FLAG_IS_LEAF;
+
+	page_value.data   = page_value_data;
+	page_value.size   = 8;
+	page_value.offset = 0;
+	page_value.flags  = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_cursor_get_value_key_size(
+	          &page,
+	          &page_value,
+	          &key_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "key_size",
+	 key_size,
+	 (uint16_t) 5 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The common key size precedes the local key size
+	 */
+	page_value.flags = LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE;
+
+	page_value_data[ 2 ] = 0x01;
+	page_value_data[ 3 ] = 0x00;
+
+	result = libesedb_cursor_get_value_key_size(
+	          &page,
+	          &page_value,
+	          &key_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "key_size",
+	 key_size,
+	 (uint16_t) 5 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_cursor_get_value_key_size(
+	          NULL,
+	          &page_value,
+	          &key_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_cursor_get_value_key_size(
+	          &page,
+	          &page_value,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a local key size that exceeds the page value size
+	 */
+	page_value_data[ 2 ] = 0xff;
+
+	result = libesedb_cursor_get_value_key_size(
+	          &page,
+	          &page_value,
+	          &key_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with the common key size on a root page
+	 */
+	page_value_data[ 2 ] = 0x01;
+
+	page.flags = LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF;
+
+	result = libesedb_cursor_get_value_key_size(
+	          &page,
+	          &page_value,
+	          &key_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_cursor_seek_key function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_cursor_seek_key(
+     void )
+{
+	/* The root branch page references leaf page 2 with the separator key "B"
+	 * and leaf page 3 as the last child page
+	 */
+	uint8_t root_page_header_data[ 16 ] = {
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	};
+
+	uint8_t branch_page_value_data1[ 7 ] = {
+		0x01, 0x00, 'B', 0x02, 0x00, 0x00, 0x00
+	};
+
+	uint8_t branch_page_value_data2[ 6 ] = {
+		0x00, 0x00, 0x03, 0x00, 0x00, 0x00
+	};
+
+	uint8_t leaf_page_value_data1[ 4 ] = {
+		0x01, 0x00, 'A', 0xaa
+	};
+
+	uint8_t leaf_page_value_data2[ 4 ] = {
+		0x01, 0x00, 'B', 0xbb
+	};
+
+	uint8_t leaf_page_value_data3[ 4 ] = {
+		0x01, 0x00, 'C', 0xcc
+	};
+
+	const uint8_t *page_values_data[ 3 ];
+	uint16_t page_values_data_size[ 3 ];
+
+	/* The key, expected result, exact match, page number and page value index of the seek tests
+	 */
+	const char *seek_keys[ 6 ]                = { "A", "B", "C", "AB", "BB", "D" };
+	int expected_results[ 6 ]                 = { 1, 1, 1, 1, 1, 0 };
+	uint8_t expected_is_exact_match[ 6 ]      = { 1, 1, 1, 0, 0, 0 };
+	uint32_t expected_page_numbers[ 6 ]       = { 2, 3, 3, 3, 3, 3 };
+	uint16_t expected_page_value_indexes[ 6 ] = { 1, 1, 2, 1, 2, 3 };
+
+	uint8_t file_data[ 5 * 4096 ];
+
+	libesedb_internal_cursor_t internal_cursor;
+	libesedb_key_t key;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libesedb_io_handle_t *io_handle  = NULL;
+	libfcache_cache_t *pages_cache   = NULL;
+	libfdata_vector_t *pages_vector  = NULL;
+	uint8_t is_exact_match           = 0;
+	int result                       = 0;
+	int segment_index                = 0;
+	int test_index                   = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &internal_cursor,
+	     0,
+	     sizeof( libesedb_internal_cursor_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     file_data,
+	     0,
+	     5 * 4096 ) == NULL )
+	{
+		return( 0 );
+	}
+	page_values_data[ 0 ]      = root_page_header_data;
+	page_values_data_size[ 0 ] = 16;
+	page_values_data[ 1 ]      = branch_page_value_data1;
+	page_values_data_size[ 1 ] = 7;
+	page_values_data[ 2 ]      = branch_page_value_data2;
+	page_values_data_size[ 2 ] = 6;
+
+	result = esedb_test_write_page(
+	          &( file_data[ 2 * 4096 ] ),
+	          4096,
+	          LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT,
+	          0,
+	          0,
+	          8,
+	          page_values_data,
+	          page_values_data_size,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page_values_data_size[ 0 ] = 0;
+	page_values_data[ 1 ]      = leaf_page_value_data1;
+	page_values_data_size[ 1 ] = 4;
+
+	result = esedb_test_write_page(
+	          &( file_data[ 3 * 4096 ] ),
+	          4096,
+	          LIBESEDB_PAGE_FLAG_IS_LEAF,
+	          0,
+	          3,
+	          8,
+	          page_values_data,
+	          page_values_data_size,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page_values_data[ 1 ]      = leaf_page_value_data2;
+	page_values_data_size[ 1 ] = 4;
+	page_values_data[ 2 ]      = leaf_page_value_data3;
+	page_values_data_size[ 2 ] = 4;
+
+	result = esedb_test_write_page(
+	          &( file_data[ 4 * 4096 ] ),
+	          4096,
+	          LIBESEDB_PAGE_FLAG_IS_LEAF,
+	          2,
+	          0,
+	          8,
+	          page_values_data,
+	          page_values_data_size,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          5 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->page_size = 4096;
+
+	result = libesedb_io_handle_set_pages_data_range(
+	          io_handle,
+	          5 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_initialize(
+	          &pages_vector,
+	          (size64_t) io_handle->page_size,
+	          (intptr_t *) io_handle,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	          NULL,
+	          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_append_segment(
+	          pages_vector,
+	          &segment_index,
+	          0,
+	          io_handle->pages_data_offset,
+	          io_handle->pages_data_size,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_initialize(
+	          &pages_cache,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_initialize(
+	          &( internal_cursor.data_definition ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_cursor.file_io_handle   = file_io_handle;
+	internal_cursor.io_handle        = io_handle;
+	internal_cursor.pages_vector     = pages_vector;
+	internal_cursor.pages_cache      = pages_cache;
+	internal_cursor.root_page_number = 1;
+
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 6;
+	     test_index++ )
+	{
+		key.type      = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+		key.data      = (uint8_t *) seek_keys[ test_index ];
+		key.data_size = narrow_string_length(
+		                 seek_keys[ test_index ] );
+
+		result = libesedb_cursor_seek_key(
+		          &internal_cursor,
+		          &key,
+		          &is_exact_match,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 expected_results[ test_index ] );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT8(
+		 "is_exact_match",
+		 is_exact_match,
+		 expected_is_exact_match[ test_index ] );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "internal_cursor.current_page_number",
+		 internal_cursor.current_page_number,
+		 expected_page_numbers[ test_index ] );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT16(
+		 "internal_cursor.current_page_value_index",
+		 internal_cursor.current_page_value_index,
+		 expected_page_value_indexes[ test_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libesedb_cursor_seek_key(
+	          NULL,
+	          &key,
+	          &is_exact_match,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_cursor_seek_key(
+	          &internal_cursor,
+	          NULL,
+	          &is_exact_match,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_cursor_seek_key(
+	          &internal_cursor,
+	          &key,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	if( internal_cursor.key_data != NULL )
+	{
+		memory_free(
+		 internal_cursor.key_data );
+
+		internal_cursor.key_data = NULL;
+	}
+	result = libesedb_data_definition_free(
+	          &( internal_cursor.data_definition ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_free(
+	          &pages_vector,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_cursor.key_data != NULL )
+	{
+		memory_free(
+		 internal_cursor.key_data );
+	}
+	if( internal_cursor.data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &( internal_cursor.data_definition ),
+		 NULL );
+	}
+	if( pages_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &pages_cache,
+		 NULL );
+	}
+	if( pages_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &pages_vector,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		esedb_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_cursor_read_matching_record function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_cursor_read_matching_record(
+     void )
+{
+	/* The records consist of 2 32-bit fixed size columns
+	 */
+	uint8_t leaf_page_value_data1[ 18 ] = {
+		0x04, 0x00, 0x7f, 0x80, 0x00, 0x01, 0x02, 0x7f, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00,
+		0x00, 0x00
+	};
+
+	uint8_t leaf_page_value_data2[ 18 ] = {
+		0x04, 0x00, 0x7f, 0x80, 0x00, 0x02, 0x02, 0x7f, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00,
+		0x00, 0x00
+	};
+
+	uint8_t leaf_page_value_data3[ 18 ] = {
+		0x04, 0x00, 0x7f, 0x80, 0x00, 0x03, 0x02, 0x7f, 0x0c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0a, 0x00,
+		0x00, 0x00
+	};
+
+	uint8_t root_page_header_data[ 16 ] = {
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	};
+
+	/* Only the first column is projected
+	 */
+	uint8_t column_projection[ 2 ] = { 1, 0 };
+
+	uint8_t filter_value_data[ 4 ] = { 0x0a, 0x00, 0x00, 0x00 };
+
+	const uint8_t *page_values_data[ 4 ];
+	uint16_t page_values_data_size[ 4 ];
+
+	uint8_t file_data[ 3 * 4096 ];
+
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition  = NULL;
+	libesedb_cursor_t *cursor                                = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_record_t *record                                = NULL;
+	libesedb_table_definition_t *table_definition            = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	const uint8_t *value_data                                = NULL;
+	size_t value_data_size                                   = 0;
+	uint32_t column_identifier                               = 0;
+	int result                                               = 0;
+	int segment_index                                        = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     file_data,
+	     0,
+	     3 * 4096 ) == NULL )
+	{
+		return( 0 );
+	}
+	page_values_data[ 0 ]      = root_page_header_data;
+	page_values_data_size[ 0 ] = 16;
+	page_values_data[ 1 ]      = leaf_page_value_data1;
+	page_values_data_size[ 1 ] = 18;
+	page_values_data[ 2 ]      = leaf_page_value_data2;
+	page_values_data_size[ 2 ] = 18;
+	page_values_data[ 3 ]      = leaf_page_value_data3;
+	page_values_data_size[ 3 ] = 18;
+
+	result = esedb_test_write_page(
+	          &( file_data[ 2 * 4096 ] ),
+	          4096,
+	          LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF,
+	          0,
+	          0,
+	          8,
+	          page_values_data,
+	          page_values_data_size,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          3 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->page_size = 4096;
+
+	result = libesedb_io_handle_set_pages_data_range(
+	          io_handle,
+	          3 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_initialize(
+	          &pages_vector,
+	          (size64_t) io_handle->page_size,
+	          (intptr_t *) io_handle,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	          NULL,
+	          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_append_segment(
+	          pages_vector,
+	          &segment_index,
+	          0,
+	          io_handle->pages_data_offset,
+	          io_handle->pages_data_size,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_initialize(
+	          &pages_cache,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition->type                               = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+	table_catalog_definition->identifier                         = 8;
+	table_catalog_definition->father_data_page_object_identifier = 8;
+	table_catalog_definition->father_data_page_number            = 1;
+
+	result = libesedb_table_definition_initialize(
+	          &table_definition,
+	          table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table definition now manages the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	for( column_identifier = 1;
+	     column_identifier <= 2;
+	     column_identifier++ )
+	{
+		result = libesedb_catalog_definition_initialize(
+		          &column_catalog_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		column_catalog_definition->type                               = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+		column_catalog_definition->identifier                         = column_identifier;
+		column_catalog_definition->father_data_page_object_identifier = 8;
+		column_catalog_definition->column_type                        = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED;
+		column_catalog_definition->size                               = 4;
+
+		result = libesedb_table_definition_append_column_catalog_definition(
+		          table_definition,
+		          column_catalog_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The table definition now manages the column catalog definition
+		 */
+		column_catalog_definition = NULL;
+	}
+	result = libesedb_table_definition_initialize_record_layout(
+	          table_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_cursor_initialize(
+	          &cursor,
+	          file_io_handle,
+	          io_handle,
+	          table_definition,
+	          NULL,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cursor",
+	 cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libesedb_internal_cursor_t *) cursor )->column_projection = column_projection;
+
+	/* Test that a filter value data size that does not match the column type is rejected
+	 */
+	result = libesedb_cursor_append_filter_equal(
+	          cursor,
+	          2,
+	          filter_value_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that a filter on a column that is not projected is applied
+	 */
+	result = libesedb_cursor_append_filter_equal(
+	          cursor,
+	          2,
+	          filter_value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_cursor_read_matching_record(
+	          (libesedb_internal_cursor_t *) cursor,
+	          0,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_get_value_data_pointer(
+	          record,
+	          0,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_data[ 0 ]",
+	 value_data[ 0 ],
+	 1 );
+
+	/* The value of the filter column that is not projected is not part of the record
+	 */
+	result = libesedb_record_get_value_data_pointer(
+	          record,
+	          1,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The record is reused to read the next matching record
+	 */
+	result = libesedb_cursor_read_matching_record(
+	          (libesedb_internal_cursor_t *) cursor,
+	          0,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_get_value_data_pointer(
+	          record,
+	          0,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_data[ 0 ]",
+	 value_data[ 0 ],
+	 3 );
+
+	result = libesedb_cursor_read_matching_record(
+	          (libesedb_internal_cursor_t *) cursor,
+	          0,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_cursor_read_matching_record(
+	          NULL,
+	          0,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_cursor_read_matching_record(
+	          (libesedb_internal_cursor_t *) cursor,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_cursor_free(
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_free(
+	          &pages_vector,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( cursor != NULL )
+	{
+		libesedb_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	if( pages_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &pages_cache,
+		 NULL );
+	}
+	if( pages_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &pages_vector,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		esedb_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests that a multi value remains valid when the record is reused by libesedb_cursor_read_next_record
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_cursor_read_next_record_multi_value(
+     void )
+{
+	/* The records consist of a tagged multi value column with 2 32-bit values
+	 */
+	uint8_t leaf_page_value_data1[ 27 ] = {
+		0x04, 0x00, 0x7f, 0x80, 0x00, 0x01, 0x00, 0x7f, 0x04, 0x00, 0x00, 0x01, 0x04, 0x40, 0x08, 0x04,
+		0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00
+	};
+
+	uint8_t leaf_page_value_data2[ 27 ] = {
+		0x04, 0x00, 0x7f, 0x80, 0x00, 0x02, 0x00, 0x7f, 0x04, 0x00, 0x00, 0x01, 0x04, 0x40, 0x08, 0x04,
+		0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00
+	};
+
+	uint8_t root_page_header_data[ 16 ] = {
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	};
+
+	const uint8_t *page_values_data[ 3 ];
+	uint16_t page_values_data_size[ 3 ];
+
+	uint8_t file_data[ 3 * 4096 ];
+
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition  = NULL;
+	libesedb_cursor_t *cursor                                = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_multi_value_t *multi_value                      = NULL;
+	libesedb_record_t *record                                = NULL;
+	libesedb_table_definition_t *table_definition            = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	uint32_t value_32bit                                     = 0;
+	int number_of_values                                     = 0;
+	int result                                               = 0;
+	int segment_index                                        = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     file_data,
+	     0,
+	     3 * 4096 ) == NULL )
+	{
+		return( 0 );
+	}
+	page_values_data[ 0 ]      = root_page_header_data;
+	page_values_data_size[ 0 ] = 16;
+	page_values_data[ 1 ]      = leaf_page_value_data1;
+	page_values_data_size[ 1 ] = 27;
+	page_values_data[ 2 ]      = leaf_page_value_data2;
+	page_values_data_size[ 2 ] = 27;
+
+	result = esedb_test_write_page(
+	          &( file_data[ 2 * 4096 ] ),
+	          4096,
+	          LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF,
+	          0,
+	          0,
+	          8,
+	          page_values_data,
+	          page_values_data_size,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          3 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->page_size = 4096;
+
+	result = libesedb_io_handle_set_pages_data_range(
+	          io_handle,
+	          3 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_initialize(
+	          &pages_vector,
+	          (size64_t) io_handle->page_size,
+	          (intptr_t *) io_handle,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	          NULL,
+	          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_append_segment(
+	          pages_vector,
+	          &segment_index,
+	          0,
+	          io_handle->pages_data_offset,
+	          io_handle->pages_data_size,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_initialize(
+	          &pages_cache,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition->type                               = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+	table_catalog_definition->identifier                         = 8;
+	table_catalog_definition->father_data_page_object_identifier = 8;
+	table_catalog_definition->father_data_page_number            = 1;
+
+	result = libesedb_table_definition_initialize(
+	          &table_definition,
+	          table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table definition now manages the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	result = libesedb_catalog_definition_initialize(
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	column_catalog_definition->type                               = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+	column_catalog_definition->identifier                         = 256;
+	column_catalog_definition->father_data_page_object_identifier = 8;
+	column_catalog_definition->column_type                        = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED;
+	column_catalog_definition->size                               = 4;
+
+	result = libesedb_table_definition_append_column_catalog_definition(
+	          table_definition,
+	          column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table definition now manages the column catalog definition
+	 */
+	column_catalog_definition = NULL;
+
+	result = libesedb_table_definition_initialize_record_layout(
+	          table_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_cursor_initialize(
+	          &cursor,
+	          file_io_handle,
+	          io_handle,
+	          table_definition,
+	          NULL,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cursor",
+	 cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_cursor_read_next_record(
+	          cursor,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_get_multi_value(
+	          record,
+	          0,
+	          &multi_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the multi value remains valid when the record is reused
+	 */
+	result = libesedb_cursor_read_next_record(
+	          cursor,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_multi_value_get_number_of_values(
+	          multi_value,
+	          &number_of_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_multi_value_get_value_32bit(
+	          multi_value,
+	          1,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_multi_value_free(
+	          &multi_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the multi value of the reused record contains the values of the next record
+	 */
+	result = libesedb_record_get_multi_value(
+	          record,
+	          0,
+	          &multi_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The multi value remains valid when the record is freed
+	 */
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_multi_value_get_value_32bit(
+	          multi_value,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_multi_value_free(
+	          &multi_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_cursor_free(
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_free(
+	          &pages_vector,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( multi_value != NULL )
+	{
+		libesedb_multi_value_free(
+		 &multi_value,
+		 NULL );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( cursor != NULL )
+	{
+		libesedb_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	if( pages_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &pages_cache,
+		 NULL );
+	}
+	if( pages_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &pages_vector,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		esedb_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	/* TODO: add tests for libesedb_cursor_initialize */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_cursor_free",
+	 esedb_test_cursor_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_cursor_reset",
+	 esedb_test_cursor_reset );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_cursor_get_value_key_size",
+	 esedb_test_cursor_get_value_key_size );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_cursor_seek_key",
+	 esedb_test_cursor_seek_key );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_cursor_read_matching_record",
+	 esedb_test_cursor_read_matching_record );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_cursor_read_next_record_multi_value",
+	 esedb_test_cursor_read_next_record_multi_value );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_cursor_set_upper_bound",
+	 esedb_test_cursor_set_upper_bound );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_cursor_append_filter_equal",
+	 esedb_test_cursor_append_filter_equal );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_cursor_clear_filter",
+	 esedb_test_cursor_clear_filter );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_cursor_move_to_next",
+	 esedb_test_cursor_move_to_next );
+
+	/* TODO: add tests for libesedb_cursor_get_key */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_cursor_get_key_value_data_size",
+	 esedb_test_cursor_get_key_value_data_size );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_cursor_get_next_record",
+	 esedb_test_cursor_get_next_record );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_cursor_read_next_record",
+	 esedb_test_cursor_read_next_record );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
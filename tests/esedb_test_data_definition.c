@@ -35,6 +35,10 @@
 
 #include "../libesedb/libesedb_data_definition.h"
 
+uint8_t esedb_test_data_definition_tagged_data_types_data[ 24 ] = {
+	0x00, 0x01, 0x0c, 0x00, 0x02, 0x01, 0x10, 0x00, 0x2c, 0x01, 0x14, 0x40, 0x41, 0x42, 0x43, 0x44,
+	0x45, 0x46, 0x47, 0x48, 0x00, 0x49, 0x4a, 0x4b };
+
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
 /* Tests the libesedb_data_definition_initialize function
@@ -270,6 +274,179 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_data_definition_get_tagged_data_type function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_get_tagged_data_type(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	uint16_t tagged_data_type_offset = 0;
+	uint16_t tagged_data_type_size   = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_data,
+	          3,
+	          0x3fff,
+	          24,
+	          0x0102,
+	          &tagged_data_type_offset,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "tagged_data_type_offset",
+	 tagged_data_type_offset,
+	 0x0010 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "tagged_data_type_size",
+	 tagged_data_type_size,
+	 4 );
+
+	/* Test the last tagged data type, its value ends at the end of the data
+	 */
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_data,
+	          3,
+	          0x3fff,
+	          24,
+	          0x012c,
+	          &tagged_data_type_offset,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "tagged_data_type_offset",
+	 tagged_data_type_offset,
+	 0x4014 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "tagged_data_type_size",
+	 tagged_data_type_size,
+	 4 );
+
+	/* Test a column identifier without a tagged data type
+	 */
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_data,
+	          3,
+	          0x3fff,
+	          24,
+	          0x0101,
+	          &tagged_data_type_offset,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_get_tagged_data_type(
+	          NULL,
+	          3,
+	          0x3fff,
+	          24,
+	          0x0102,
+	          &tagged_data_type_offset,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_data,
+	          7,
+	          0x3fff,
+	          24,
+	          0x0102,
+	          &tagged_data_type_offset,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_data,
+	          3,
+	          0x3fff,
+	          24,
+	          0x0102,
+	          NULL,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -299,6 +476,10 @@ int main(
 
 	/* TODO: add tests for libesedb_data_definition_read_data */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_data_definition_get_tagged_data_type",
+	 esedb_test_data_definition_get_tagged_data_type );
+
 	/* TODO: add tests for libesedb_data_definition_read_record */
 
 	/* TODO: add tests for libesedb_data_definition_read_long_value */
@@ -923,6 +923,24 @@ int esedb_test_file_open_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
+	result = libesedb_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBESEDB_OPEN_READ_MEMORY_MAPPED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	/* Test open when already opened
 	 */
 	result = libesedb_file_open_file_io_handle(
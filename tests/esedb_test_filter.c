@@ -0,0 +1,1057 @@
+/*
+ * Library filter functions test program
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_filter.h"
+#include "../libesedb/libesedb_record.h"
+#include "../libesedb/libesedb_record_layout.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_filter_initialize(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libesedb_filter_t *filter = NULL;
+	int result                = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_filter_initialize(
+	          &filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_free(
+	          &filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_filter_initialize(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	filter = (libesedb_filter_t *) 0x12345678UL;
+
+	result = libesedb_filter_initialize(
+	          &filter,
+	          &error );
+
+	filter = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_filter_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_filter_initialize(
+		          &filter,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( filter != NULL )
+			{
+				libesedb_filter_free(
+				 &filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "filter",
+			 filter );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_filter_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_filter_initialize(
+		          &filter,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( filter != NULL )
+			{
+				libesedb_filter_free(
+				 &filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "filter",
+			 filter );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libesedb_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_filter_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_filter_append_predicate function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_filter_append_predicate(
+     void )
+{
+	uint8_t value_data[ 4 ] = { 0x01, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error  = NULL;
+	libesedb_filter_t *filter = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_filter_initialize(
+	          &filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_filter_append_predicate(
+	          filter,
+	          LIBESEDB_FILTER_PREDICATE_TYPE_EQUAL,
+	          0,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          value_data,
+	          4,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_append_predicate(
+	          filter,
+	          LIBESEDB_FILTER_PREDICATE_TYPE_RANGE,
+	          1,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          NULL,
+	          0,
+	          value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "filter->number_of_predicates",
+	 filter->number_of_predicates,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libesedb_filter_append_predicate(
+	          NULL,
+	          LIBESEDB_FILTER_PREDICATE_TYPE_EQUAL,
+	          0,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          value_data,
+	          4,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_filter_append_predicate(
+	          filter,
+	          0xff,
+	          0,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          value_data,
+	          4,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_filter_append_predicate(
+	          filter,
+	          LIBESEDB_FILTER_PREDICATE_TYPE_EQUAL,
+	          -1,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          value_data,
+	          4,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_filter_append_predicate(
+	          filter,
+	          LIBESEDB_FILTER_PREDICATE_TYPE_EQUAL,
+	          0,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          NULL,
+	          4,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_filter_append_predicate(
+	          filter,
+	          LIBESEDB_FILTER_PREDICATE_TYPE_RANGE,
+	          0,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_filter_append_predicate(
+	          filter,
+	          LIBESEDB_FILTER_PREDICATE_TYPE_EQUAL,
+	          0,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          value_data,
+	          (size_t) SSIZE_MAX + 1,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "filter->number_of_predicates",
+	 filter->number_of_predicates,
+	 2 );
+
+	/* Clean up
+	 */
+	result = libesedb_filter_free(
+	          &filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libesedb_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_filter_compare_value_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_filter_compare_value_data(
+     void )
+{
+	uint8_t negative_value_data[ 4 ] = { 0xff, 0xff, 0xff, 0xff };
+	uint8_t positive_value_data[ 4 ] = { 0x01, 0x00, 0x00, 0x00 };
+	uint8_t large_value_data[ 4 ]    = { 0x00, 0x01, 0x00, 0x00 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_filter_compare_value_data(
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          negative_value_data,
+	          4,
+	          positive_value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_LESS );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_compare_value_data(
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED,
+	          negative_value_data,
+	          4,
+	          positive_value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_GREATER );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_compare_value_data(
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          large_value_data,
+	          4,
+	          positive_value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_GREATER );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Binary data is compared byte by byte
+	 */
+	result = libesedb_filter_compare_value_data(
+	          LIBESEDB_COLUMN_TYPE_BINARY_DATA,
+	          large_value_data,
+	          4,
+	          positive_value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_LESS );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_compare_value_data(
+	          LIBESEDB_COLUMN_TYPE_BINARY_DATA,
+	          positive_value_data,
+	          1,
+	          positive_value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_LESS );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_compare_value_data(
+	          LIBESEDB_COLUMN_TYPE_BINARY_DATA,
+	          positive_value_data,
+	          4,
+	          positive_value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_EQUAL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_filter_compare_value_data(
+	          LIBESEDB_COLUMN_TYPE_BINARY_DATA,
+	          NULL,
+	          4,
+	          positive_value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_filter_compare_value_data(
+	          LIBESEDB_COLUMN_TYPE_BINARY_DATA,
+	          positive_value_data,
+	          4,
+	          NULL,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_filter_match_record function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_filter_match_record(
+     void )
+{
+	uint8_t values_data[ 8 ]      = { 0x2a, 0x00, 0x00, 0x00, 'a', 'b', 'c', 'd' };
+	uint8_t lower_value_data[ 4 ] = { 0x28, 0x00, 0x00, 0x00 };
+	uint8_t upper_value_data[ 4 ] = { 0x29, 0x00, 0x00, 0x00 };
+
+	libesedb_catalog_definition_t column_catalog_definitions[ 3 ];
+	libesedb_data_type_value_t data_type_values[ 3 ];
+	libesedb_internal_record_t internal_record;
+	libesedb_record_layout_column_t columns[ 3 ];
+	libesedb_record_layout_t record_layout;
+	libesedb_table_definition_t table_definition;
+
+	libcerror_error_t *error  = NULL;
+	libesedb_filter_t *filter = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 column_catalog_definitions,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) * 3 );
+
+	memory_set(
+	 data_type_values,
+	 0,
+	 sizeof( libesedb_data_type_value_t ) * 3 );
+
+	memory_set(
+	 &internal_record,
+	 0,
+	 sizeof( libesedb_internal_record_t ) );
+
+	memory_set(
+	 columns,
+	 0,
+	 sizeof( libesedb_record_layout_column_t ) * 3 );
+
+	memory_set(
+	 &record_layout,
+	 0,
+	 sizeof( libesedb_record_layout_t ) );
+
+	memory_set(
+	 &table_definition,
+	 0,
+	 sizeof( libesedb_table_definition_t ) );
+
+	column_catalog_definitions[ 0 ].column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED;
+	column_catalog_definitions[ 1 ].column_type = LIBESEDB_COLUMN_TYPE_TEXT;
+	column_catalog_definitions[ 2 ].column_type = LIBESEDB_COLUMN_TYPE_TEXT;
+
+	columns[ 0 ].column_catalog_definition = &( column_catalog_definitions[ 0 ] );
+	columns[ 1 ].column_catalog_definition = &( column_catalog_definitions[ 1 ] );
+	columns[ 2 ].column_catalog_definition = &( column_catalog_definitions[ 2 ] );
+
+	record_layout.columns           = columns;
+	record_layout.number_of_columns = 3;
+
+	table_definition.record_layout = &record_layout;
+
+	data_type_values[ 0 ].data_offset = 0;
+	data_type_values[ 0 ].data_size   = 4;
+	data_type_values[ 0 ].is_set      = 1;
+	data_type_values[ 1 ].data_offset = 4;
+	data_type_values[ 1 ].data_size   = 4;
+	data_type_values[ 1 ].is_set      = 1;
+	data_type_values[ 2 ].is_set      = 1;
+
+	internal_record.table_definition = &table_definition;
+	internal_record.data_type_values = data_type_values;
+	internal_record.values_data      = values_data;
+	internal_record.values_data_size = 8;
+
+	result = libesedb_filter_initialize(
+	          &filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_filter_append_predicate(
+	          filter,
+	          LIBESEDB_FILTER_PREDICATE_TYPE_RANGE,
+	          0,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          lower_value_data,
+	          4,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_append_predicate(
+	          filter,
+	          LIBESEDB_FILTER_PREDICATE_TYPE_PREFIX,
+	          1,
+	          LIBESEDB_COLUMN_TYPE_TEXT,
+	          (uint8_t *) "ab",
+	          2,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_append_predicate(
+	          filter,
+	          LIBESEDB_FILTER_PREDICATE_TYPE_IS_NULL,
+	          2,
+	          LIBESEDB_COLUMN_TYPE_TEXT,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_match_record(
+	          filter,
+	          &internal_record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The value is greater than the upper bound
+	 */
+	result = libesedb_filter_append_predicate(
+	          filter,
+	          LIBESEDB_FILTER_PREDICATE_TYPE_RANGE,
+	          0,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          NULL,
+	          0,
+	          upper_value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_match_record(
+	          filter,
+	          &internal_record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_filter_match_record(
+	          NULL,
+	          &internal_record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_filter_match_record(
+	          filter,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Values of columns that are not projected cannot be evaluated
+	 */
+	data_type_values[ 0 ].is_set = 0;
+
+	result = libesedb_filter_match_record(
+	          filter,
+	          &internal_record,
+	          &error );
+
+	data_type_values[ 0 ].is_set = 1;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_filter_free(
+	          &filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libesedb_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_filter_initialize",
+	 esedb_test_filter_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_filter_free",
+	 esedb_test_filter_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_filter_append_predicate",
+	 esedb_test_filter_append_predicate );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_filter_compare_value_data",
+	 esedb_test_filter_compare_value_data );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_filter_match_record",
+	 esedb_test_filter_match_record );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -19,8 +19,10 @@
  * along with this software.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -560,3 +562,158 @@ int esedb_test_close_file_io_handle(
 	return( result );
 }
 
+
+/* Writes the data of a page for test data
+ * The page has a page header without extended page header, no checksum and page values without page tag flags
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_write_page(
+     uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t page_flags,
+     uint32_t previous_page_number,
+     uint32_t next_page_number,
+     uint32_t father_data_page_object_identifier,
+     const uint8_t **page_values_data,
+     const uint16_t *page_values_data_size,
+     uint16_t number_of_page_values,
+     libcerror_error_t **error )
+{
+	uint8_t *page_tag_data     = NULL;
+	static char *function      = "esedb_test_write_page";
+	size_t page_tags_data_size = 0;
+	size_t page_values_offset  = 0;
+	uint16_t page_value_index  = 0;
+
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_data_size < 40 )
+	 || ( page_data_size > 8192 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_page_values > 0 )
+	 && ( ( page_values_data == NULL )
+	  || ( page_values_data_size == NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page values data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     page_data,
+	     0,
+	     page_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page data.",
+		 function );
+
+		return( -1 );
+	}
+	page_tags_data_size = 4 * (size_t) number_of_page_values;
+
+	for( page_value_index = 0;
+	     page_value_index < number_of_page_values;
+	     page_value_index++ )
+	{
+		if( page_values_data_size[ page_value_index ] > ( page_data_size - 40 - page_tags_data_size - page_values_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page value: %" PRIu16 " data size value out of bounds.",
+			 function,
+			 page_value_index );
+
+			return( -1 );
+		}
+		if( page_values_data_size[ page_value_index ] > 0 )
+		{
+			if( memory_copy(
+			     &( page_data[ 40 + page_values_offset ] ),
+			     page_values_data[ page_value_index ],
+			     (size_t) page_values_data_size[ page_value_index ] ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy page value: %" PRIu16 " data.",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+		}
+		/* The page tags are stored back to front at the end of the page
+		 * and the offset is relative to the end of the page header
+		 */
+		page_tag_data = &( page_data[ page_data_size - ( 4 * (size_t) page_value_index ) - 4 ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 page_tag_data,
+		 page_values_data_size[ page_value_index ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page_tag_data[ 2 ] ),
+		 (uint16_t) page_values_offset );
+
+		page_values_offset += page_values_data_size[ page_value_index ];
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 16 ] ),
+	 previous_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 20 ] ),
+	 next_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 24 ] ),
+	 father_data_page_object_identifier );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 28 ] ),
+	 (uint16_t) ( page_data_size - 40 - page_tags_data_size - page_values_offset ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 32 ] ),
+	 (uint16_t) page_values_offset );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 34 ] ),
+	 number_of_page_values );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 36 ] ),
+	 page_flags );
+
+	return( 1 );
+}
+
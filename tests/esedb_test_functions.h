@@ -58,6 +58,18 @@ int esedb_test_close_file_io_handle(
      libbfio_handle_t **file_io_handle,
      libcerror_error_t **error );
 
+int esedb_test_write_page(
+     uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t page_flags,
+     uint32_t previous_page_number,
+     uint32_t next_page_number,
+     uint32_t father_data_page_object_identifier,
+     const uint8_t **page_values_data,
+     const uint16_t *page_values_data_size,
+     uint16_t number_of_page_values,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,892 @@
+/*
+ * Library huffman_tree type test program
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_huffman_tree.h"
+
+/* Code sizes that result in the canonical codes:
+ * symbol 0: 10, symbol 1: 0, symbol 2: 110, symbol 3: 111
+ */
+uint8_t esedb_test_huffman_tree_code_sizes[ 4 ] = {
+	2, 1, 3, 3 };
+
+/* Code sizes of which the code 11 is not assigned to a symbol
+ */
+uint8_t esedb_test_huffman_tree_incomplete_code_sizes[ 3 ] = {
+	1, 0, 2 };
+
+/* Code sizes that require more codes than available
+ */
+uint8_t esedb_test_huffman_tree_over_subscribed_code_sizes[ 3 ] = {
+	1, 1, 1 };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_huffman_tree_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_huffman_tree_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libesedb_huffman_tree_t *huffman_tree = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 2;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_huffman_tree_initialize(
+	          &huffman_tree,
+	          512,
+	          15,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_huffman_tree_free(
+	          &huffman_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_huffman_tree_initialize(
+	          NULL,
+	          512,
+	          15,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	huffman_tree = (libesedb_huffman_tree_t *) 0x12345678UL;
+
+	result = libesedb_huffman_tree_initialize(
+	          &huffman_tree,
+	          512,
+	          15,
+	          &error );
+
+	huffman_tree = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_huffman_tree_initialize(
+	          &huffman_tree,
+	          0,
+	          15,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_huffman_tree_initialize(
+	          &huffman_tree,
+	          512,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_huffman_tree_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_huffman_tree_initialize(
+		          &huffman_tree,
+		          512,
+		          15,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( huffman_tree != NULL )
+			{
+				libesedb_huffman_tree_free(
+				 &huffman_tree,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "huffman_tree",
+			 huffman_tree );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_huffman_tree_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_huffman_tree_initialize(
+		          &huffman_tree,
+		          512,
+		          15,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( huffman_tree != NULL )
+			{
+				libesedb_huffman_tree_free(
+				 &huffman_tree,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "huffman_tree",
+			 huffman_tree );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( huffman_tree != NULL )
+	{
+		libesedb_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_huffman_tree_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_huffman_tree_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_huffman_tree_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_huffman_tree_build function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_huffman_tree_build(
+     void )
+{
+	uint8_t code_sizes[ 4 ]               = { 0, 0, 0, 0 };
+	libcerror_error_t *error              = NULL;
+	libesedb_huffman_tree_t *huffman_tree = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_huffman_tree_initialize(
+	          &huffman_tree,
+	          4,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_huffman_tree_build(
+	          huffman_tree,
+	          esedb_test_huffman_tree_code_sizes,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "huffman_tree->number_of_lookup_bits",
+	 huffman_tree->number_of_lookup_bits,
+	 3 );
+
+	result = libesedb_huffman_tree_build(
+	          huffman_tree,
+	          esedb_test_huffman_tree_incomplete_code_sizes,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "huffman_tree->number_of_lookup_bits",
+	 huffman_tree->number_of_lookup_bits,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libesedb_huffman_tree_build(
+	          NULL,
+	          esedb_test_huffman_tree_code_sizes,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_huffman_tree_build(
+	          huffman_tree,
+	          NULL,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_huffman_tree_build(
+	          huffman_tree,
+	          esedb_test_huffman_tree_code_sizes,
+	          5,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test build with code sizes that exceed the maximum code size
+	 */
+	code_sizes[ 0 ] = 4;
+
+	result = libesedb_huffman_tree_build(
+	          huffman_tree,
+	          code_sizes,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test build without codes
+	 */
+	code_sizes[ 0 ] = 0;
+
+	result = libesedb_huffman_tree_build(
+	          huffman_tree,
+	          code_sizes,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test build with more codes than available
+	 */
+	result = libesedb_huffman_tree_build(
+	          huffman_tree,
+	          esedb_test_huffman_tree_over_subscribed_code_sizes,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_huffman_tree_free(
+	          &huffman_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( huffman_tree != NULL )
+	{
+		libesedb_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_huffman_tree_get_symbol function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_huffman_tree_get_symbol(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libesedb_huffman_tree_t *huffman_tree = NULL;
+	uint16_t symbol                       = 0;
+	uint8_t code_size                     = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_huffman_tree_initialize(
+	          &huffman_tree,
+	          4,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_huffman_tree_build(
+	          huffman_tree,
+	          esedb_test_huffman_tree_code_sizes,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_huffman_tree_get_symbol(
+	          huffman_tree,
+	          0x7fffffffUL,
+	          &symbol,
+	          &code_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "symbol",
+	 symbol,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "code_size",
+	 code_size,
+	 1 );
+
+	result = libesedb_huffman_tree_get_symbol(
+	          huffman_tree,
+	          0x80000000UL,
+	          &symbol,
+	          &code_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "symbol",
+	 symbol,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "code_size",
+	 code_size,
+	 2 );
+
+	result = libesedb_huffman_tree_get_symbol(
+	          huffman_tree,
+	          0xc0000000UL,
+	          &symbol,
+	          &code_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "symbol",
+	 symbol,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "code_size",
+	 code_size,
+	 3 );
+
+	result = libesedb_huffman_tree_get_symbol(
+	          huffman_tree,
+	          0xe0000000UL,
+	          &symbol,
+	          &code_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "symbol",
+	 symbol,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "code_size",
+	 code_size,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libesedb_huffman_tree_get_symbol(
+	          NULL,
+	          0,
+	          &symbol,
+	          &code_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_huffman_tree_get_symbol(
+	          huffman_tree,
+	          0,
+	          NULL,
+	          &code_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_huffman_tree_get_symbol(
+	          huffman_tree,
+	          0,
+	          &symbol,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test get symbol with a code that is not assigned to a symbol
+	 */
+	result = libesedb_huffman_tree_build(
+	          huffman_tree,
+	          esedb_test_huffman_tree_incomplete_code_sizes,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_huffman_tree_get_symbol(
+	          huffman_tree,
+	          0xc0000000UL,
+	          &symbol,
+	          &code_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_huffman_tree_free(
+	          &huffman_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( huffman_tree != NULL )
+	{
+		libesedb_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_huffman_tree_initialize",
+	 esedb_test_huffman_tree_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_huffman_tree_free",
+	 esedb_test_huffman_tree_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_huffman_tree_build",
+	 esedb_test_huffman_tree_build );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_huffman_tree_get_symbol",
+	 esedb_test_huffman_tree_get_symbol );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,19 +21,28 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_cursor.h"
 #include "../libesedb/libesedb_index.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_page.h"
+#include "../libesedb/libesedb_record.h"
+#include "../libesedb/libesedb_table_definition.h"
 
 /* Tests the libesedb_index_free function
  * Returns 1 if successful or 0 if not
@@ -75,6 +84,1079 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* Tests the libesedb_index_seek function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_seek(
+     void )
+{
+	/* The table values tree root page 1 references leaf page 2 with the separator key
+	 * of record 2 and leaf page 3 as the last child page
+	 */
+	uint8_t table_branch_page_value_data1[ 11 ] = {
+		0x05, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00
+	};
+
+	uint8_t table_branch_page_value_data2[ 6 ] = {
+		0x00, 0x00, 0x03, 0x00, 0x00, 0x00
+	};
+
+	/* The records consist of a single 32-bit fixed size column
+	 */
+	uint8_t table_leaf_page_value_data1[ 15 ] = {
+		0x05, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x01, 0x01, 0x7f, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00
+	};
+
+	uint8_t table_leaf_page_value_data2[ 15 ] = {
+		0x05, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x02, 0x01, 0x7f, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00
+	};
+
+	uint8_t table_leaf_page_value_data3[ 15 ] = {
+		0x05, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x03, 0x01, 0x7f, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00
+	};
+
+	/* The index values tree root page 4 references leaf page 5 with the separator key "B"
+	 * and leaf page 6 as the last child page
+	 */
+	uint8_t index_branch_page_value_data1[ 7 ] = {
+		0x01, 0x00, 'B', 0x05, 0x00, 0x00, 0x00
+	};
+
+	uint8_t index_branch_page_value_data2[ 6 ] = {
+		0x00, 0x00, 0x06, 0x00, 0x00, 0x00
+	};
+
+	/* The index values contain the key of the record in the table
+	 */
+	uint8_t index_leaf_page_value_data1[ 8 ] = {
+		0x01, 0x00, 'A', 0x7f, 0x80, 0x00, 0x00, 0x01
+	};
+
+	uint8_t index_leaf_page_value_data2[ 8 ] = {
+		0x01, 0x00, 'B', 0x7f, 0x80, 0x00, 0x00, 0x02
+	};
+
+	uint8_t index_leaf_page_value_data3[ 8 ] = {
+		0x01, 0x00, 'C', 0x7f, 0x80, 0x00, 0x00, 0x03
+	};
+
+	uint8_t root_page_header_data[ 16 ] = {
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	};
+
+	/* The key, match mode, expected result and expected record value of the seek tests
+	 */
+	const char *seek_keys[ 7 ]          = { "A", "B", "C", "B", "AB", "AB", "D" };
+	int expected_results[ 7 ]           = { 1, 1, 1, 1, 1, 0, 0 };
+	uint8_t expected_record_values[ 7 ] = { 1, 2, 3, 3, 2, 0, 0 };
+
+	int match_modes[ 7 ] = {
+		LIBESEDB_KEY_MATCH_MODE_EQUAL,
+		LIBESEDB_KEY_MATCH_MODE_EQUAL,
+		LIBESEDB_KEY_MATCH_MODE_GREATER_EQUAL,
+		LIBESEDB_KEY_MATCH_MODE_GREATER,
+		LIBESEDB_KEY_MATCH_MODE_GREATER_EQUAL,
+		LIBESEDB_KEY_MATCH_MODE_EQUAL,
+		LIBESEDB_KEY_MATCH_MODE_GREATER_EQUAL
+	};
+
+	const uint8_t *page_values_data[ 3 ];
+	uint16_t page_values_data_size[ 3 ];
+
+	uint8_t file_data[ 8 * 4096 ];
+	uint8_t key[ 1 ];
+
+	libesedb_internal_index_t internal_index;
+
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_catalog_definition_t *index_catalog_definition  = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition  = NULL;
+	libesedb_cursor_t *cursor                                = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_record_t *record                                = NULL;
+	libesedb_table_definition_t *table_definition            = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	const uint8_t *value_data                                = NULL;
+	size_t key_size                                          = 0;
+	size_t value_data_size                                   = 0;
+	uint8_t expected_record_value                            = 0;
+	int result                                               = 0;
+	int segment_index                                        = 0;
+	int test_index                                           = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &internal_index,
+	     0,
+	     sizeof( libesedb_internal_index_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     file_data,
+	     0,
+	     8 * 4096 ) == NULL )
+	{
+		return( 0 );
+	}
+	page_values_data[ 0 ]      = root_page_header_data;
+	page_values_data_size[ 0 ] = 16;
+	page_values_data[ 1 ]      = table_branch_page_value_data1;
+	page_values_data_size[ 1 ] = 11;
+	page_values_data[ 2 ]      = table_branch_page_value_data2;
+	page_values_data_size[ 2 ] = 6;
+
+	result = esedb_test_write_page(
+	          &( file_data[ 2 * 4096 ] ),
+	          4096,
+	          LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT,
+	          0,
+	          0,
+	          8,
+	          page_values_data,
+	          page_values_data_size,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page_values_data_size[ 0 ] = 0;
+	page_values_data[ 1 ]      = table_leaf_page_value_data1;
+	page_values_data_size[ 1 ] = 15;
+
+	result = esedb_test_write_page(
+	          &( file_data[ 3 * 4096 ] ),
+	          4096,
+	          LIBESEDB_PAGE_FLAG_IS_LEAF,
+	          0,
+	          3,
+	          8,
+	          page_values_data,
+	          page_values_data_size,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page_values_data[ 1 ]      = table_leaf_page_value_data2;
+	page_values_data_size[ 1 ] = 15;
+	page_values_data[ 2 ]      = table_leaf_page_value_data3;
+	page_values_data_size[ 2 ] = 15;
+
+	result = esedb_test_write_page(
+	          &( file_data[ 4 * 4096 ] ),
+	          4096,
+	          LIBESEDB_PAGE_FLAG_IS_LEAF,
+	          2,
+	          0,
+	          8,
+	          page_values_data,
+	          page_values_data_size,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page_values_data_size[ 0 ] = 16;
+	page_values_data[ 1 ]      = index_branch_page_value_data1;
+	page_values_data_size[ 1 ] = 7;
+	page_values_data[ 2 ]      = index_branch_page_value_data2;
+	page_values_data_size[ 2 ] = 6;
+
+	result = esedb_test_write_page(
+	          &( file_data[ 5 * 4096 ] ),
+	          4096,
+	          LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT | LIBESEDB_PAGE_FLAG_IS_INDEX,
+	          0,
+	          0,
+	          9,
+	          page_values_data,
+	          page_values_data_size,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page_values_data_size[ 0 ] = 0;
+	page_values_data[ 1 ]      = index_leaf_page_value_data1;
+	page_values_data_size[ 1 ] = 8;
+
+	result = esedb_test_write_page(
+	          &( file_data[ 6 * 4096 ] ),
+	          4096,
+	          LIBESEDB_PAGE_FLAG_IS_LEAF | LIBESEDB_PAGE_FLAG_IS_INDEX,
+	          0,
+	          6,
+	          9,
+	          page_values_data,
+	          page_values_data_size,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page_values_data[ 1 ]      = index_leaf_page_value_data2;
+	page_values_data_size[ 1 ] = 8;
+	page_values_data[ 2 ]      = index_leaf_page_value_data3;
+	page_values_data_size[ 2 ] = 8;
+
+	result = esedb_test_write_page(
+	          &( file_data[ 7 * 4096 ] ),
+	          4096,
+	          LIBESEDB_PAGE_FLAG_IS_LEAF | LIBESEDB_PAGE_FLAG_IS_INDEX,
+	          5,
+	          0,
+	          9,
+	          page_values_data,
+	          page_values_data_size,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          8 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->page_size = 4096;
+
+	result = libesedb_io_handle_set_pages_data_range(
+	          io_handle,
+	          8 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_initialize(
+	          &pages_vector,
+	          (size64_t) io_handle->page_size,
+	          (intptr_t *) io_handle,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	          NULL,
+	          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_append_segment(
+	          pages_vector,
+	          &segment_index,
+	          0,
+	          io_handle->pages_data_offset,
+	          io_handle->pages_data_size,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_initialize(
+	          &pages_cache,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition->type                               = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+	table_catalog_definition->identifier                         = 8;
+	table_catalog_definition->father_data_page_object_identifier = 8;
+	table_catalog_definition->father_data_page_number            = 1;
+
+	result = libesedb_table_definition_initialize(
+	          &table_definition,
+	          table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table definition now manages the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	result = libesedb_catalog_definition_initialize(
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	column_catalog_definition->type                               = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+	column_catalog_definition->identifier                         = 1;
+	column_catalog_definition->father_data_page_object_identifier = 8;
+	column_catalog_definition->column_type                        = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED;
+	column_catalog_definition->size                               = 4;
+
+	result = libesedb_table_definition_append_column_catalog_definition(
+	          table_definition,
+	          column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table definition now manages the column catalog definition
+	 */
+	column_catalog_definition = NULL;
+
+	result = libesedb_table_definition_initialize_record_layout(
+	          table_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &index_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	index_catalog_definition->type                               = LIBESEDB_CATALOG_DEFINITION_TYPE_INDEX;
+	index_catalog_definition->identifier                         = 9;
+	index_catalog_definition->father_data_page_object_identifier = 8;
+	index_catalog_definition->father_data_page_number            = 4;
+
+	internal_index.file_io_handle           = file_io_handle;
+	internal_index.io_handle                = io_handle;
+	internal_index.table_definition         = table_definition;
+	internal_index.index_catalog_definition = index_catalog_definition;
+	internal_index.pages_vector             = pages_vector;
+	internal_index.pages_cache              = pages_cache;
+
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 7;
+	     test_index++ )
+	{
+		result = libesedb_index_seek(
+		          (libesedb_index_t *) &internal_index,
+		          (uint8_t *) seek_keys[ test_index ],
+		          narrow_string_length(
+		           seek_keys[ test_index ] ),
+		          match_modes[ test_index ],
+		          &cursor,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 expected_results[ test_index ] );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( expected_results[ test_index ] == 0 )
+		{
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "cursor",
+			 cursor );
+
+			continue;
+		}
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "cursor",
+		 cursor );
+
+		/* The record is retrieved from the table by the key in the index value
+		 */
+		result = libesedb_cursor_get_next_record(
+		          cursor,
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_record_get_value_data_pointer(
+		          record,
+		          0,
+		          &value_data,
+		          &value_data_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_SIZE(
+		 "value_data_size",
+		 value_data_size,
+		 (size_t) 4 );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT8(
+		 "value_data[ 0 ]",
+		 value_data[ 0 ],
+		 expected_record_values[ test_index ] );
+
+		result = libesedb_record_free(
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_cursor_free(
+		          &cursor,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test reading all records in index order
+	 * An empty key positions the cursor before the first index value
+	 */
+	result = libesedb_index_seek(
+	          (libesedb_index_t *) &internal_index,
+	          NULL,
+	          0,
+	          LIBESEDB_KEY_MATCH_MODE_GREATER_EQUAL,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cursor",
+	 cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( expected_record_value = 1;
+	     expected_record_value <= 3;
+	     expected_record_value++ )
+	{
+		result = libesedb_cursor_get_next_record(
+		          cursor,
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_record_get_value_data_pointer(
+		          record,
+		          0,
+		          &value_data,
+		          &value_data_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT8(
+		 "value_data[ 0 ]",
+		 value_data[ 0 ],
+		 expected_record_value );
+
+		result = libesedb_record_free(
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libesedb_cursor_get_next_record(
+	          cursor,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_cursor_free(
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading all index values in index order without reading the records
+	 */
+	result = libesedb_index_seek(
+	          (libesedb_index_t *) &internal_index,
+	          NULL,
+	          0,
+	          LIBESEDB_KEY_MATCH_MODE_EQUAL,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cursor",
+	 cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( test_index = 0;
+	     test_index < 3;
+	     test_index++ )
+	{
+		result = libesedb_cursor_move_to_next(
+		          cursor,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_cursor_get_key_size(
+		          cursor,
+		          &key_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_SIZE(
+		 "key_size",
+		 key_size,
+		 (size_t) 1 );
+
+		result = libesedb_cursor_get_key(
+		          cursor,
+		          key,
+		          1,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT8(
+		 "key[ 0 ]",
+		 key[ 0 ],
+		 (uint8_t) ( 'A' + test_index ) );
+	}
+	result = libesedb_cursor_move_to_next(
+	          cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_cursor_free(
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_seek(
+	          NULL,
+	          (uint8_t *) "A",
+	          1,
+	          LIBESEDB_KEY_MATCH_MODE_GREATER_EQUAL,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	result = libesedb_index_seek(
+	          (libesedb_index_t *) &internal_index,
+	          NULL,
+	          1,
+	          LIBESEDB_KEY_MATCH_MODE_GREATER_EQUAL,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_seek(
+	          (libesedb_index_t *) &internal_index,
+	          (uint8_t *) "A",
+	          1,
+	          -1,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	result = libesedb_index_seek(
+	          (libesedb_index_t *) &internal_index,
+	          NULL,
+	          0,
+	          -1,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	result = libesedb_index_seek(
+	          (libesedb_index_t *) &internal_index,
+	          (uint8_t *) "A",
+	          1,
+	          LIBESEDB_KEY_MATCH_MODE_GREATER_EQUAL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_definition_free(
+	          &index_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_free(
+	          &pages_vector,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( cursor != NULL )
+	{
+		libesedb_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	if( index_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &index_catalog_definition,
+		 NULL );
+	}
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	if( pages_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &pages_cache,
+		 NULL );
+	}
+	if( pages_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &pages_vector,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		esedb_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -118,6 +1200,10 @@ int main(
 
 	/* TODO: add tests for libesedb_index_get_record */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_index_seek",
+	 esedb_test_index_seek );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -34,6 +34,12 @@
 #include "esedb_test_unused.h"
 
 #include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_page.h"
+#include "../libesedb/libesedb_page_value.h"
+
+#if defined( HAVE_LIBESEDB_MEMORY_MAPPED_IO )
+#include <sys/mman.h>
+#endif
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
@@ -398,40 +404,735 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+/* Tests the libesedb_io_handle_map_file function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_map_file(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	int result                      = 0;
 
-/* The main program
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_map_file(
+	          NULL,
+	          "test",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_map_file(
+	          io_handle,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_unmap_file function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
-#endif
+int esedb_test_io_handle_unmap_file(
+     void )
 {
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	int result                      = 0;
 
-#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
 
-	ESEDB_TEST_RUN(
-	 "libesedb_io_handle_initialize",
-	 esedb_test_io_handle_initialize );
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	ESEDB_TEST_RUN(
-	 "libesedb_io_handle_free",
-	 esedb_test_io_handle_free );
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
 
-	ESEDB_TEST_RUN(
-	 "libesedb_io_handle_clear",
-	 esedb_test_io_handle_clear );
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libesedb_io_handle_set_pages_data_range */
+	/* Test regular cases
+	 */
+	result = libesedb_io_handle_unmap_file(
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_unmap_file(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_set_maximum_cache_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_set_maximum_cache_entries(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	int maximum_cache_entries       = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_io_handle_set_maximum_cache_entries(
+	          io_handle,
+	          LIBESEDB_CACHE_TYPE_PAGES,
+	          128,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_get_maximum_cache_entries(
+	          io_handle,
+	          LIBESEDB_CACHE_TYPE_PAGES,
+	          &maximum_cache_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "maximum_cache_entries",
+	 maximum_cache_entries,
+	 128 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_set_maximum_cache_entries(
+	          NULL,
+	          LIBESEDB_CACHE_TYPE_PAGES,
+	          128,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_set_maximum_cache_entries(
+	          io_handle,
+	          -1,
+	          128,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_set_maximum_cache_entries(
+	          io_handle,
+	          LIBESEDB_CACHE_TYPE_PAGES,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_get_maximum_cache_entries(
+	          io_handle,
+	          LIBESEDB_CACHE_TYPE_PAGES,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBESEDB_MEMORY_MAPPED_IO )
+
+/* Tests the libesedb_io_handle_read_page function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_read_page(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libesedb_io_handle_t *io_handle   = NULL;
+	libesedb_page_t *page             = NULL;
+	libesedb_page_value_t *page_value = NULL;
+	libfcache_cache_t *pages_cache    = NULL;
+	libfdata_vector_t *pages_vector   = NULL;
+	uint8_t *mapped_data              = NULL;
+	uint8_t *page_data                = NULL;
+	size_t mapped_data_size           = 3 * 16384;
+	int page_index                    = 0;
+	int read_index                    = 0;
+	int result                        = 0;
+	int segment_index                 = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER;
+	io_handle->page_size       = 16384;
+
+	/* Create 2 leaf pages with an extended page header, each with a page value
+	 * that has the common key size page tag flag set in its first 16-bit value
+	 */
+	mapped_data = (uint8_t *) mmap(
+	                           NULL,
+	                           mapped_data_size,
+	                           PROT_READ | PROT_WRITE,
+	                           MAP_PRIVATE | MAP_ANONYMOUS,
+	                           -1,
+	                           0 );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		mapped_data = NULL;
+	}
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_data",
+	 mapped_data );
+
+	io_handle->mapped_data      = mapped_data;
+	io_handle->mapped_data_size = (size64_t) mapped_data_size;
+
+	for( page_index = 1;
+	     page_index < 3;
+	     page_index++ )
+	{
+		page_data = &( mapped_data[ page_index * 16384 ] );
+
+		/* The available page tag and page flags in the page header
+		 */
+		page_data[ 34 ] = 2;
+		page_data[ 36 ] = LIBESEDB_PAGE_FLAG_IS_LEAF;
+
+		/* The page values after the extended page header
+		 */
+		page_data[ 80 + 4 ] = 0x02;
+		page_data[ 80 + 5 ] = LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE << 5;
+
+		/* The page tags back to front at the end of the page
+		 * page tag 0: offset 0, size 4, page tag 1: offset 4, size 8
+		 */
+		page_data[ 16384 - 4 ] = 4;
+		page_data[ 16384 - 8 ] = 8;
+		page_data[ 16384 - 6 ] = 4;
+	}
+	/* The mapped data is made read-only so that any modification by the page read fails
+	 */
+	result = mprotect(
+	          mapped_data,
+	          mapped_data_size,
+	          PROT_READ );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfdata_vector_initialize(
+	          &pages_vector,
+	          (size64_t) io_handle->page_size,
+	          (intptr_t *) io_handle,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	          NULL,
+	          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_append_segment(
+	          pages_vector,
+	          &segment_index,
+	          0,
+	          (off64_t) io_handle->page_size,
+	          (size64_t) ( 2 * io_handle->page_size ),
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A cache of a single entry evicts the first page when the second page is read
+	 */
+	result = libfcache_cache_initialize(
+	          &pages_cache,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( read_index = 0;
+	     read_index < 3;
+	     read_index++ )
+	{
+		page_index = read_index % 2;
+
+		page = NULL;
+
+		result = libfdata_vector_get_element_value_by_index(
+		          pages_vector,
+		          NULL,
+		          pages_cache,
+		          page_index,
+		          (intptr_t **) &page,
+		          0,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "page",
+		 page );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_page_get_value(
+		          page,
+		          1,
+		          &page_value,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "page_value",
+		 page_value );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT8(
+		 "page_value->flags",
+		 page_value->flags,
+		 (uint8_t) LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT8(
+		 "page_value->data[ 1 ]",
+		 page_value->data[ 1 ],
+		 (uint8_t) ( LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE << 5 ) );
+	}
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_free(
+	          &pages_vector,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The IO handle unmaps the mapped data
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pages_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &pages_cache,
+		 NULL );
+	}
+	if( pages_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &pages_vector,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		if( ( io_handle->mapped_data == NULL )
+		 && ( mapped_data != NULL ) )
+		{
+			munmap(
+			 mapped_data,
+			 mapped_data_size );
+		}
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBESEDB_MEMORY_MAPPED_IO ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_initialize",
+	 esedb_test_io_handle_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_free",
+	 esedb_test_io_handle_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_clear",
+	 esedb_test_io_handle_clear );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_map_file",
+	 esedb_test_io_handle_map_file );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_unmap_file",
+	 esedb_test_io_handle_unmap_file );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_set_maximum_cache_entries",
+	 esedb_test_io_handle_set_maximum_cache_entries );
+
+	/* TODO: add tests for libesedb_io_handle_set_pages_data_range */
+
+#if defined( HAVE_LIBESEDB_MEMORY_MAPPED_IO )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_read_page",
+	 esedb_test_io_handle_read_page );
 
-	/* TODO: add tests for libesedb_io_handle_read_page */
+#endif /* defined( HAVE_LIBESEDB_MEMORY_MAPPED_IO ) */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
@@ -429,6 +429,237 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_key_read_fixed_size_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_read_fixed_size_segment(
+     void )
+{
+	uint8_t key_data[ 11 ] = {
+		0x7f, 0x80, 0x00, 0x00, 0x2a, 0x80, 0xfe, 0xd6, 0x00, 0x7f, 0xff };
+	uint8_t value_data[ 8 ];
+
+	libcerror_error_t *error = NULL;
+	size_t key_data_offset   = 0;
+	size_t value_size        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_key_read_fixed_size_segment(
+	          key_data,
+	          11,
+	          &key_data_offset,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          value_data,
+	          8,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key_data_offset",
+	 key_data_offset,
+	 (size_t) 5 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_data,
+	          "\x2a\x00\x00\x00",
+	          4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a descending segment
+	 */
+	result = libesedb_key_read_fixed_size_segment(
+	          key_data,
+	          11,
+	          &key_data_offset,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED,
+	          value_data,
+	          8,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key_data_offset",
+	 key_data_offset,
+	 (size_t) 8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_data,
+	          "\x29\x81",
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a NULL segment
+	 */
+	result = libesedb_key_read_fixed_size_segment(
+	          key_data,
+	          11,
+	          &key_data_offset,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED,
+	          value_data,
+	          8,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key_data_offset",
+	 key_data_offset,
+	 (size_t) 9 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_key_read_fixed_size_segment(
+	          key_data,
+	          11,
+	          &key_data_offset,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          value_data,
+	          8,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	key_data_offset = 0;
+
+	result = libesedb_key_read_fixed_size_segment(
+	          NULL,
+	          11,
+	          &key_data_offset,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          value_data,
+	          8,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_key_read_fixed_size_segment(
+	          key_data,
+	          11,
+	          &key_data_offset,
+	          LIBESEDB_COLUMN_TYPE_TEXT,
+	          value_data,
+	          8,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_key_read_fixed_size_segment(
+	          key_data,
+	          11,
+	          &key_data_offset,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          value_data,
+	          2,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -468,6 +699,10 @@ int main(
 
 #endif
 
+	ESEDB_TEST_RUN(
+	 "libesedb_key_read_fixed_size_segment",
+	 esedb_test_key_read_fixed_size_segment );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
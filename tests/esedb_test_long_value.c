@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -75,6 +76,347 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* Tests the libesedb_long_value_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_read_buffer(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error                           = NULL;
+	libesedb_internal_long_value_t internal_long_value;
+	ssize_t read_count                                 = 0;
+
+	if( memory_set(
+	     &internal_long_value,
+	     0,
+	     sizeof( libesedb_internal_long_value_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	internal_long_value.current_data_segment_index = -1;
+
+	/* Test error cases
+	 */
+	read_count = libesedb_long_value_read_buffer(
+	              NULL,
+	              buffer,
+	              16,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              (libesedb_long_value_t *) &internal_long_value,
+	              NULL,
+	              16,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              (libesedb_long_value_t *) &internal_long_value,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_long_value.current_offset = -1;
+
+	read_count = libesedb_long_value_read_buffer(
+	              (libesedb_long_value_t *) &internal_long_value,
+	              buffer,
+	              16,
+	              &error );
+
+	internal_long_value.current_offset = 0;
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_seek_offset(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libesedb_internal_long_value_t internal_long_value;
+	off64_t offset                                     = 0;
+
+	if( memory_set(
+	     &internal_long_value,
+	     0,
+	     sizeof( libesedb_internal_long_value_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	internal_long_value.current_data_segment_index = 2;
+
+	/* Test regular cases
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          (libesedb_long_value_t *) &internal_long_value,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_long_value.current_data_segment_index",
+	 internal_long_value.current_data_segment_index,
+	 2 );
+
+	offset = libesedb_long_value_seek_offset(
+	          (libesedb_long_value_t *) &internal_long_value,
+	          1024,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 1024 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_long_value.current_data_segment_index",
+	 internal_long_value.current_data_segment_index,
+	 -1 );
+
+	offset = libesedb_long_value_seek_offset(
+	          (libesedb_long_value_t *) &internal_long_value,
+	          -24,
+	          SEEK_CUR,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 1000 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libesedb_long_value_seek_offset(
+	          (libesedb_long_value_t *) &internal_long_value,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libesedb_long_value_seek_offset(
+	          (libesedb_long_value_t *) &internal_long_value,
+	          0,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_get_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_get_offset(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libesedb_internal_long_value_t internal_long_value;
+	off64_t offset                                     = 0;
+	int result                                         = 0;
+
+	if( memory_set(
+	     &internal_long_value,
+	     0,
+	     sizeof( libesedb_internal_long_value_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	internal_long_value.current_offset = 512;
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_get_offset(
+	          (libesedb_long_value_t *) &internal_long_value,
+	          &offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 512 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_get_offset(
+	          NULL,
+	          &offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_get_offset(
+	          (libesedb_long_value_t *) &internal_long_value,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -116,6 +458,18 @@ int main(
 
 	/* TODO: add tests for libesedb_long_value_get_data_segment */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_read_buffer",
+	 esedb_test_long_value_read_buffer );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_seek_offset",
+	 esedb_test_long_value_seek_offset );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_get_offset",
+	 esedb_test_long_value_get_offset );
+
 	/* TODO: add tests for libesedb_long_value_get_utf8_string_size */
 
 	/* TODO: add tests for libesedb_long_value_get_utf8_string */
@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,6 +35,8 @@
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_checksum.h"
+#include "../libesedb/libesedb_io_handle.h"
 #include "../libesedb/libesedb_page.h"
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
@@ -254,6 +258,379 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_page_verify_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_verify_data(
+     void )
+{
+	uint8_t page_data[ 16384 ];
+
+	libesedb_io_handle_t io_handle;
+
+	libcerror_error_t *error                    = NULL;
+	size_t checksum_offset                      = 0;
+	uint32_t calculated_ecc32_checksum          = 0;
+	uint32_t calculated_xor32_checksum          = 0;
+	uint32_t corruption_flags                   = 0;
+	uint32_t father_data_page_object_identifier = 0;
+	int block_index                             = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &io_handle,
+	     0,
+	     sizeof( libesedb_io_handle_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     page_data,
+	     0,
+	     16384 ) == NULL )
+	{
+		return( 0 );
+	}
+	io_handle.format_revision = 0x09;
+	io_handle.page_size       = 4096;
+
+	/* The page number, father data page object identifier and page flags
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 4 ] ),
+	 5 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 24 ] ),
+	 8 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 36 ] ),
+	 LIBESEDB_PAGE_FLAG_IS_LEAF );
+
+	result = libesedb_checksum_calculate_little_endian_xor32(
+	          &calculated_xor32_checksum,
+	          &( page_data[ 4 ] ),
+	          4096 - 4,
+	          0x89abcdef,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 page_data,
+	 calculated_xor32_checksum );
+
+	/* Test verification of a valid page
+	 */
+	result = libesedb_page_verify_data(
+	          &io_handle,
+	          5,
+	          page_data,
+	          4096,
+	          &father_data_page_object_identifier,
+	          &corruption_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "father_data_page_object_identifier",
+	 father_data_page_object_identifier,
+	 (uint32_t) 8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "corruption_flags",
+	 corruption_flags,
+	 (uint32_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test verification of a page with a checksum mismatch
+	 */
+	page_data[ 100 ] = 0xff;
+
+	result = libesedb_page_verify_data(
+	          &io_handle,
+	          5,
+	          page_data,
+	          4096,
+	          &father_data_page_object_identifier,
+	          &corruption_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "corruption_flags",
+	 corruption_flags,
+	 (uint32_t) LIBESEDB_PAGE_CORRUPTION_FLAG_CHECKSUM_MISMATCH );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test verification of a page with an extended page header
+	 */
+	io_handle.format_revision = 0x11;
+	io_handle.page_size       = 16384;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( page_data[ 64 ] ),
+	 (uint64_t) 5 );
+
+	/* The checksums of blocks 1 to 3 are stored in the extended page header,
+	 * which is part of block 0, hence block 0 is calculated last
+	 */
+	for( block_index = 3;
+	     block_index >= 0;
+	     block_index-- )
+	{
+		result = libesedb_checksum_calculate_little_endian_ecc32(
+		          &calculated_ecc32_checksum,
+		          &calculated_xor32_checksum,
+		          &( page_data[ block_index * 4096 ] ),
+		          4096,
+		          ( block_index == 0 ) ? 8 : 0,
+		          5,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( block_index == 0 )
+		{
+			checksum_offset = 0;
+		}
+		else
+		{
+			checksum_offset = 40 + ( ( block_index - 1 ) * 8 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( page_data[ checksum_offset ] ),
+		 calculated_xor32_checksum );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( page_data[ checksum_offset + 4 ] ),
+		 calculated_ecc32_checksum );
+	}
+	result = libesedb_page_verify_data(
+	          &io_handle,
+	          5,
+	          page_data,
+	          16384,
+	          &father_data_page_object_identifier,
+	          &corruption_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "corruption_flags",
+	 corruption_flags,
+	 (uint32_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The page number is the initial value of the block checksums
+	 */
+	result = libesedb_page_verify_data(
+	          &io_handle,
+	          6,
+	          page_data,
+	          16384,
+	          &father_data_page_object_identifier,
+	          &corruption_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "corruption_flags",
+	 corruption_flags,
+	 (uint32_t) ( LIBESEDB_PAGE_CORRUPTION_FLAG_CHECKSUM_MISMATCH | LIBESEDB_PAGE_CORRUPTION_FLAG_PAGE_NUMBER_MISMATCH ) );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test verification of a page with an extended page header
+	 * which data of the third block was modified
+	 */
+	page_data[ 8192 + 100 ] = 0xff;
+
+	result = libesedb_page_verify_data(
+	          &io_handle,
+	          5,
+	          page_data,
+	          16384,
+	          &father_data_page_object_identifier,
+	          &corruption_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "corruption_flags",
+	 corruption_flags,
+	 (uint32_t) LIBESEDB_PAGE_CORRUPTION_FLAG_CHECKSUM_MISMATCH );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_verify_data(
+	          NULL,
+	          5,
+	          page_data,
+	          16384,
+	          &father_data_page_object_identifier,
+	          &corruption_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_verify_data(
+	          &io_handle,
+	          5,
+	          NULL,
+	          16384,
+	          &father_data_page_object_identifier,
+	          &corruption_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_verify_data(
+	          &io_handle,
+	          5,
+	          page_data,
+	          4096,
+	          &father_data_page_object_identifier,
+	          &corruption_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_verify_data(
+	          &io_handle,
+	          5,
+	          page_data,
+	          16384,
+	          NULL,
+	          &corruption_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_verify_data(
+	          &io_handle,
+	          5,
+	          page_data,
+	          16384,
+	          &father_data_page_object_identifier,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -281,6 +658,10 @@ int main(
 	 "libesedb_page_free",
 	 esedb_test_page_free );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_page_verify_data",
+	 esedb_test_page_verify_data );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
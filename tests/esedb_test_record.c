@@ -73,6 +73,53 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_record_get_value_data_pointer function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_get_value_data_pointer(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *data      = NULL;
+	size_t data_size         = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_get_value_data_pointer(
+	          NULL,
+	          0,
+	          &data,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data",
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
@@ -102,6 +149,10 @@ int main(
 	 "libesedb_record_free",
 	 esedb_test_record_free );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_record_get_value_data_pointer",
+	 esedb_test_record_get_value_data_pointer );
+
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
 	/* TODO: add tests for libesedb_record_get_number_of_values */
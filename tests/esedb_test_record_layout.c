@@ -0,0 +1,543 @@
+/*
+ * Library record_layout type test program
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_record_layout.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_record_layout_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_layout_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libesedb_record_layout_t *record_layout = NULL;
+	int result                              = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_layout_initialize(
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_layout = (libesedb_record_layout_t *) 0x12345678UL;
+
+	result = libesedb_record_layout_initialize(
+	          &record_layout,
+	          NULL,
+	          NULL,
+	          &error );
+
+	record_layout = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_layout_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_layout_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_layout_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_layout_set_columns function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_layout_set_columns(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	uint16_t fixed_size_data_type_value_offset = 0;
+	int result                                 = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_layout_set_columns(
+	          NULL,
+	          NULL,
+	          0,
+	          &fixed_size_data_type_value_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_layout_calculate_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_layout_calculate_name_hash(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t name_hash       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_layout_calculate_name_hash(
+	          NULL,
+	          0,
+	          &name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0x811c9dc5UL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_layout_calculate_name_hash(
+	          (uint8_t *) "a",
+	          1,
+	          &name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0xe40c292cUL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_layout_calculate_name_hash(
+	          NULL,
+	          1,
+	          &name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_layout_calculate_name_hash(
+	          (uint8_t *) "a",
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_layout_get_column_index_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_layout_get_column_index_by_utf8_name(
+     void )
+{
+	libesedb_catalog_definition_t column_catalog_definitions[ 3 ];
+	libesedb_record_layout_column_t columns[ 3 ];
+	libesedb_record_layout_t record_layout;
+
+	libcerror_error_t *error = NULL;
+	int column_index         = 0;
+	int result               = 0;
+
+	memory_set(
+	 column_catalog_definitions,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) * 3 );
+
+	memory_set(
+	 columns,
+	 0,
+	 sizeof( libesedb_record_layout_column_t ) * 3 );
+
+	memory_set(
+	 &record_layout,
+	 0,
+	 sizeof( libesedb_record_layout_t ) );
+
+	column_catalog_definitions[ 0 ].name      = (uint8_t *) "Id";
+	column_catalog_definitions[ 0 ].name_size = 2;
+	column_catalog_definitions[ 1 ].name      = (uint8_t *) "Name";
+	column_catalog_definitions[ 1 ].name_size = 4;
+	column_catalog_definitions[ 2 ].name      = (uint8_t *) "Id";
+	column_catalog_definitions[ 2 ].name_size = 2;
+
+	columns[ 0 ].column_catalog_definition = &( column_catalog_definitions[ 0 ] );
+	columns[ 1 ].column_catalog_definition = &( column_catalog_definitions[ 1 ] );
+	columns[ 2 ].column_catalog_definition = &( column_catalog_definitions[ 2 ] );
+
+	record_layout.columns           = columns;
+	record_layout.number_of_columns = 3;
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_layout_get_column_index_by_utf8_name(
+	          &record_layout,
+	          (uint8_t *) "Name",
+	          4,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &column_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "column_index",
+	 column_index,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first column with a duplicate name is returned
+	 */
+	result = libesedb_record_layout_get_column_index_by_utf8_name(
+	          &record_layout,
+	          (uint8_t *) "Id",
+	          3,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &column_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "column_index",
+	 column_index,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_layout_get_column_index_by_utf8_name(
+	          &record_layout,
+	          (uint8_t *) "Nam",
+	          3,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &column_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_layout_get_column_index_by_utf8_name(
+	          NULL,
+	          (uint8_t *) "Name",
+	          4,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &column_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_layout_get_column_index_by_utf8_name(
+	          &record_layout,
+	          NULL,
+	          4,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &column_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_layout_get_column_index_by_utf8_name(
+	          &record_layout,
+	          (uint8_t *) "Name",
+	          4,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 columns[ 0 ].utf8_name );
+	memory_free(
+	 columns[ 1 ].utf8_name );
+	memory_free(
+	 columns[ 2 ].utf8_name );
+	memory_free(
+	 record_layout.name_index );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( columns[ 0 ].utf8_name != NULL )
+	{
+		memory_free(
+		 columns[ 0 ].utf8_name );
+	}
+	if( columns[ 1 ].utf8_name != NULL )
+	{
+		memory_free(
+		 columns[ 1 ].utf8_name );
+	}
+	if( columns[ 2 ].utf8_name != NULL )
+	{
+		memory_free(
+		 columns[ 2 ].utf8_name );
+	}
+	if( record_layout.name_index != NULL )
+	{
+		memory_free(
+		 record_layout.name_index );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_layout_initialize",
+	 esedb_test_record_layout_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_layout_free",
+	 esedb_test_record_layout_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_layout_set_columns",
+	 esedb_test_record_layout_set_columns );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_layout_calculate_name_hash",
+	 esedb_test_record_layout_calculate_name_hash );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_layout_get_column_index_by_utf8_name",
+	 esedb_test_record_layout_get_column_index_by_utf8_name );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -20,20 +20,28 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_io_handle.h"
 #include "../libesedb/libesedb_table.h"
+#include "../libesedb/libesedb_table_definition.h"
 
 /* Tests the libesedb_table_free function
  * Returns 1 if successful or 0 if not
@@ -75,6 +83,1842 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* Tests the libesedb_table_get_known_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_known_number_of_records(
+     void )
+{
+	libesedb_internal_table_t internal_table;
+
+	libcerror_error_t *error = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	if( memory_set(
+	     &internal_table,
+	     0,
+	     sizeof( libesedb_internal_table_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_known_number_of_records(
+	          (libesedb_table_t *) &internal_table,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_table.number_of_records        = 5;
+	internal_table.number_of_records_is_set = 1;
+
+	result = libesedb_table_get_known_number_of_records(
+	          (libesedb_table_t *) &internal_table,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 5 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_known_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_known_number_of_records(
+	          (libesedb_table_t *) &internal_table,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_set_column_projection function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_set_column_projection(
+     void )
+{
+	uint8_t column_projection[ 4 ] = { 1, 1, 1, 1 };
+	int column_entries[ 2 ]        = { 1, 3 };
+
+	libesedb_internal_table_t internal_table;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	if( memory_set(
+	     &internal_table,
+	     0,
+	     sizeof( libesedb_internal_table_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	/* Test regular cases
+	 */
+	result = libesedb_table_set_column_projection(
+	          (libesedb_table_t *) &internal_table,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "internal_table.column_projection",
+	 internal_table.column_projection );
+
+	internal_table.column_projection            = column_projection;
+	internal_table.number_of_projection_columns = 4;
+
+	result = libesedb_table_set_column_projection(
+	          (libesedb_table_t *) &internal_table,
+	          column_entries,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          column_projection,
+	          "\x00\x01\x00\x01",
+	          4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_set_column_projection(
+	          NULL,
+	          column_entries,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_set_column_projection(
+	          (libesedb_table_t *) &internal_table,
+	          NULL,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_set_column_projection(
+	          (libesedb_table_t *) &internal_table,
+	          column_entries,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a column entry that is out of bounds, which leaves the column projection unchanged
+	 */
+	column_entries[ 1 ] = 4;
+
+	result = libesedb_table_set_column_projection(
+	          (libesedb_table_t *) &internal_table,
+	          column_entries,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = memory_compare(
+	          column_projection,
+	          "\x00\x01\x00\x01",
+	          4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_record_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_record_by_key(
+     void )
+{
+	uint8_t key_data[ 4 ] = { 0x7f, 0x00, 0x00, 0x01 };
+
+	libesedb_internal_table_t internal_table;
+
+	libcerror_error_t *error  = NULL;
+	libesedb_record_t *record = NULL;
+	int result                = 0;
+
+	if( memory_set(
+	     &internal_table,
+	     0,
+	     sizeof( libesedb_internal_table_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	/* Test error cases
+	 */
+	result = libesedb_table_get_record_by_key(
+	          NULL,
+	          key_data,
+	          4,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_by_key(
+	          (libesedb_table_t *) &internal_table,
+	          NULL,
+	          4,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_by_key(
+	          (libesedb_table_t *) &internal_table,
+	          key_data,
+	          0,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_by_key(
+	          (libesedb_table_t *) &internal_table,
+	          key_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_by_key(
+	          (libesedb_table_t *) &internal_table,
+	          key_data,
+	          4,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record = (libesedb_record_t *) 0x12345678UL;
+
+	result = libesedb_table_get_record_by_key(
+	          (libesedb_table_t *) &internal_table,
+	          key_data,
+	          4,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_column_value_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_column_value_size(
+     void )
+{
+	libesedb_record_layout_column_t record_layout_columns[ 2 ];
+
+	libesedb_internal_table_t internal_table;
+	libesedb_record_layout_t record_layout;
+	libesedb_table_definition_t table_definition;
+
+	libcerror_error_t *error = NULL;
+	size_t value_size        = 0;
+	int result               = 0;
+
+	if( memory_set(
+	     record_layout_columns,
+	     0,
+	     sizeof( libesedb_record_layout_column_t ) * 2 ) == NULL )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     &table_definition,
+	     0,
+	     sizeof( libesedb_table_definition_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     &internal_table,
+	     0,
+	     sizeof( libesedb_internal_table_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	record_layout_columns[ 0 ].value_size = 4;
+
+	record_layout.columns                          = record_layout_columns;
+	record_layout.number_of_columns                = 2;
+	record_layout.number_of_template_table_columns = 0;
+
+	table_definition.record_layout  = &record_layout;
+	internal_table.table_definition = &table_definition;
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_column_value_size(
+	          (libesedb_table_t *) &internal_table,
+	          0,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_column_value_size(
+	          (libesedb_table_t *) &internal_table,
+	          1,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_column_value_size(
+	          NULL,
+	          0,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_value_size(
+	          (libesedb_table_t *) &internal_table,
+	          -1,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_value_size(
+	          (libesedb_table_t *) &internal_table,
+	          2,
+	          &value_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_value_size(
+	          (libesedb_table_t *) &internal_table,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Initializes a test table of 4 records stored in 2 leaf pages
+ * Column 1 is a 32-bit and column 2 a 16-bit fixed size column, the value of column 2 of record 3 is NULL
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_table_initialize_test_table(
+     libesedb_internal_table_t *internal_table,
+     uint8_t *file_data,
+     size_t file_data_size,
+     libcerror_error_t **error )
+{
+	/* The table values tree root page 1 references leaf page 2 with the separator key
+	 * of record 3 and leaf page 3 as the last child page
+	 */
+	uint8_t branch_page_value_data1[ 11 ] = {
+		0x05, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00
+	};
+
+	uint8_t branch_page_value_data2[ 6 ] = {
+		0x00, 0x00, 0x03, 0x00, 0x00, 0x00
+	};
+
+	uint8_t leaf_page_value_data1[ 17 ] = {
+		0x05, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x01, 0x02, 0x7f, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a,
+		0x00
+	};
+
+	uint8_t leaf_page_value_data2[ 17 ] = {
+		0x05, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x02, 0x02, 0x7f, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14,
+		0x00
+	};
+
+	/* The last fixed size column of record 3 is column 1
+	 */
+	uint8_t leaf_page_value_data3[ 15 ] = {
+		0x05, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x03, 0x01, 0x7f, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00
+	};
+
+	uint8_t leaf_page_value_data4[ 17 ] = {
+		0x05, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x04, 0x02, 0x7f, 0x0a, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28,
+		0x00
+	};
+
+	uint8_t root_page_header_data[ 16 ] = {
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	};
+
+	const uint8_t *page_values_data[ 3 ];
+	uint16_t page_values_data_size[ 3 ];
+
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition  = NULL;
+	static char *function                                    = "esedb_test_table_initialize_test_table";
+	uint32_t column_identifier                               = 0;
+	int segment_index                                        = 0;
+
+	if( internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_data == NULL )
+	 || ( file_data_size != ( 5 * 4096 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_table,
+	     0,
+	     sizeof( libesedb_internal_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     file_data,
+	     0,
+	     file_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file data.",
+		 function );
+
+		return( -1 );
+	}
+	page_values_data[ 0 ]      = root_page_header_data;
+	page_values_data_size[ 0 ] = 16;
+	page_values_data[ 1 ]      = branch_page_value_data1;
+	page_values_data_size[ 1 ] = 11;
+	page_values_data[ 2 ]      = branch_page_value_data2;
+	page_values_data_size[ 2 ] = 6;
+
+	if( esedb_test_write_page(
+	     &( file_data[ 2 * 4096 ] ),
+	     4096,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT,
+	     0,
+	     0,
+	     8,
+	     page_values_data,
+	     page_values_data_size,
+	     3,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	page_values_data_size[ 0 ] = 0;
+	page_values_data[ 1 ]      = leaf_page_value_data1;
+	page_values_data_size[ 1 ] = 17;
+	page_values_data[ 2 ]      = leaf_page_value_data2;
+	page_values_data_size[ 2 ] = 17;
+
+	if( esedb_test_write_page(
+	     &( file_data[ 3 * 4096 ] ),
+	     4096,
+	     LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     0,
+	     3,
+	     8,
+	     page_values_data,
+	     page_values_data_size,
+	     3,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	page_values_data[ 1 ]      = leaf_page_value_data3;
+	page_values_data_size[ 1 ] = 15;
+	page_values_data[ 2 ]      = leaf_page_value_data4;
+	page_values_data_size[ 2 ] = 17;
+
+	if( esedb_test_write_page(
+	     &( file_data[ 4 * 4096 ] ),
+	     4096,
+	     LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     2,
+	     0,
+	     8,
+	     page_values_data,
+	     page_values_data_size,
+	     3,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_open_file_io_handle(
+	     &( internal_table->file_io_handle ),
+	     file_data,
+	     file_data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_io_handle_initialize(
+	     &( internal_table->io_handle ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	internal_table->io_handle->page_size = 4096;
+
+	if( libesedb_io_handle_set_pages_data_range(
+	     internal_table->io_handle,
+	     (size64_t) file_data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_vector_initialize(
+	     &( internal_table->pages_vector ),
+	     (size64_t) internal_table->io_handle->page_size,
+	     (intptr_t *) internal_table->io_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_vector_append_segment(
+	     internal_table->pages_vector,
+	     &segment_index,
+	     0,
+	     internal_table->io_handle->pages_data_offset,
+	     internal_table->io_handle->pages_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( internal_table->pages_cache ),
+	     4,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_catalog_definition_initialize(
+	     &table_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	table_catalog_definition->type                               = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+	table_catalog_definition->identifier                         = 8;
+	table_catalog_definition->father_data_page_object_identifier = 8;
+	table_catalog_definition->father_data_page_number            = 1;
+
+	if( libesedb_table_definition_initialize(
+	     &( internal_table->table_definition ),
+	     table_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The table definition now manages the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	for( column_identifier = 1;
+	     column_identifier <= 2;
+	     column_identifier++ )
+	{
+		if( libesedb_catalog_definition_initialize(
+		     &column_catalog_definition,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		column_catalog_definition->type                               = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+		column_catalog_definition->identifier                         = column_identifier;
+		column_catalog_definition->father_data_page_object_identifier = 8;
+
+		if( column_identifier == 1 )
+		{
+			column_catalog_definition->column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED;
+			column_catalog_definition->size        = 4;
+		}
+		else
+		{
+			column_catalog_definition->column_type = LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED;
+			column_catalog_definition->size        = 2;
+		}
+		/* The columns are named C1 and C2
+		 */
+		column_catalog_definition->name = (uint8_t *) memory_allocate(
+		                                               sizeof( uint8_t ) * 2 );
+
+		if( column_catalog_definition->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create column name.",
+			 function );
+
+			goto on_error;
+		}
+		column_catalog_definition->name[ 0 ] = (uint8_t) 'C';
+		column_catalog_definition->name[ 1 ] = (uint8_t) ( '0' + column_identifier );
+		column_catalog_definition->name_size = 2;
+
+		if( libesedb_table_definition_append_column_catalog_definition(
+		     internal_table->table_definition,
+		     column_catalog_definition,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		/* The table definition now manages the column catalog definition
+		 */
+		column_catalog_definition = NULL;
+	}
+	if( libesedb_table_definition_initialize_record_layout(
+	     internal_table->table_definition,
+	     NULL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	esedb_test_table_free_test_table(
+	 internal_table,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees a test table
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_table_free_test_table(
+     libesedb_internal_table_t *internal_table,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_table_free_test_table";
+	int result            = 1;
+
+	if( internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition != NULL )
+	{
+		if( libesedb_table_definition_free(
+		     &( internal_table->table_definition ),
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( internal_table->pages_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     &( internal_table->pages_cache ),
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( internal_table->pages_vector != NULL )
+	{
+		if( libfdata_vector_free(
+		     &( internal_table->pages_vector ),
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( internal_table->io_handle != NULL )
+	{
+		if( libesedb_io_handle_free(
+		     &( internal_table->io_handle ),
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( internal_table->file_io_handle != NULL )
+	{
+		if( esedb_test_close_file_io_handle(
+		     &( internal_table->file_io_handle ),
+		     error ) != 0 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Tests the libesedb_table_read_batch function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_read_batch(
+     void )
+{
+	uint32_t column_vector_data1[ 4 ];
+	int16_t column_vector_data2[ 4 ];
+	uint8_t null_bitmap_data1[ 1 ];
+	uint8_t null_bitmap_data2[ 1 ];
+
+	uint8_t file_data[ 5 * 4096 ];
+
+	libesedb_internal_table_t internal_table;
+
+	uint8_t *column_vectors[ 2 ]    = { (uint8_t *) column_vector_data1, (uint8_t *) column_vector_data2 };
+	uint8_t *null_bitmaps[ 2 ]      = { null_bitmap_data1, null_bitmap_data2 };
+	libcerror_error_t *error        = NULL;
+	size_t column_vector_sizes[ 2 ] = { sizeof( uint32_t ) * 4, sizeof( int16_t ) * 4 };
+	int column_entries[ 2 ]         = { 0, 1 };
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_table_initialize_test_table(
+	          &internal_table,
+	          file_data,
+	          5 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The records are stored in 2 leaf pages
+	 */
+	if( memory_set(
+	     column_vector_data2,
+	     0xff,
+	     sizeof( int16_t ) * 4 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libesedb_table_read_batch(
+	          (libesedb_table_t *) &internal_table,
+	          0,
+	          4,
+	          column_entries,
+	          2,
+	          column_vectors,
+	          column_vector_sizes,
+	          null_bitmaps,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_vector_data1[ 0 ]",
+	 column_vector_data1[ 0 ],
+	 (uint32_t) 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_vector_data1[ 1 ]",
+	 column_vector_data1[ 1 ],
+	 (uint32_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_vector_data1[ 2 ]",
+	 column_vector_data1[ 2 ],
+	 (uint32_t) 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_vector_data1[ 3 ]",
+	 column_vector_data1[ 3 ],
+	 (uint32_t) 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT16(
+	 "column_vector_data2[ 0 ]",
+	 column_vector_data2[ 0 ],
+	 (int16_t) 10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT16(
+	 "column_vector_data2[ 1 ]",
+	 column_vector_data2[ 1 ],
+	 (int16_t) 20 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT16(
+	 "column_vector_data2[ 2 ]",
+	 column_vector_data2[ 2 ],
+	 (int16_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT16(
+	 "column_vector_data2[ 3 ]",
+	 column_vector_data2[ 3 ],
+	 (int16_t) 40 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "null_bitmap_data1[ 0 ]",
+	 null_bitmap_data1[ 0 ],
+	 (uint8_t) 0x0f );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "null_bitmap_data2[ 0 ]",
+	 null_bitmap_data2[ 0 ],
+	 (uint8_t) 0x0b );
+
+	/* Test a batch that starts in the first leaf page and ends in the second
+	 */
+	result = libesedb_table_read_batch(
+	          (libesedb_table_t *) &internal_table,
+	          1,
+	          2,
+	          &( column_entries[ 1 ] ),
+	          1,
+	          &( column_vectors[ 1 ] ),
+	          &( column_vector_sizes[ 1 ] ),
+	          &( null_bitmaps[ 1 ] ),
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT16(
+	 "column_vector_data2[ 0 ]",
+	 column_vector_data2[ 0 ],
+	 (int16_t) 20 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT16(
+	 "column_vector_data2[ 1 ]",
+	 column_vector_data2[ 1 ],
+	 (int16_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "null_bitmap_data2[ 0 ]",
+	 null_bitmap_data2[ 0 ],
+	 (uint8_t) 0x01 );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_read_batch(
+	          NULL,
+	          0,
+	          4,
+	          column_entries,
+	          1,
+	          column_vectors,
+	          column_vector_sizes,
+	          null_bitmaps,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_read_batch(
+	          (libesedb_table_t *) &internal_table,
+	          0,
+	          -1,
+	          column_entries,
+	          1,
+	          column_vectors,
+	          column_vector_sizes,
+	          null_bitmaps,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_read_batch(
+	          (libesedb_table_t *) &internal_table,
+	          0,
+	          4,
+	          NULL,
+	          1,
+	          column_vectors,
+	          column_vector_sizes,
+	          null_bitmaps,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_read_batch(
+	          (libesedb_table_t *) &internal_table,
+	          0,
+	          4,
+	          column_entries,
+	          0,
+	          column_vectors,
+	          column_vector_sizes,
+	          null_bitmaps,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_read_batch(
+	          (libesedb_table_t *) &internal_table,
+	          0,
+	          4,
+	          column_entries,
+	          1,
+	          NULL,
+	          column_vector_sizes,
+	          null_bitmaps,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_read_batch(
+	          (libesedb_table_t *) &internal_table,
+	          0,
+	          4,
+	          column_entries,
+	          1,
+	          column_vectors,
+	          NULL,
+	          null_bitmaps,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_read_batch(
+	          (libesedb_table_t *) &internal_table,
+	          1,
+	          4,
+	          column_entries,
+	          1,
+	          column_vectors,
+	          column_vector_sizes,
+	          null_bitmaps,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_table_free_test_table(
+	          &internal_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_table_free_test_table(
+	 &internal_table,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_table_export_arrow_batch function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_export_arrow_batch(
+     void )
+{
+	struct ArrowArray array;
+	struct ArrowSchema schema;
+
+	uint8_t file_data[ 5 * 4096 ];
+
+	libesedb_internal_table_t internal_table;
+
+	const uint32_t *values_32bit = NULL;
+	const int16_t *values_16bit  = NULL;
+	const uint8_t *bitmap        = NULL;
+	libcerror_error_t *error     = NULL;
+	int column_entries[ 1 ]      = { 1 };
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &schema,
+	     0,
+	     sizeof( struct ArrowSchema ) ) == NULL )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     &array,
+	     0,
+	     sizeof( struct ArrowArray ) ) == NULL )
+	{
+		return( 0 );
+	}
+	result = esedb_test_table_initialize_test_table(
+	          &internal_table,
+	          file_data,
+	          5 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The records are stored in 2 leaf pages
+	 */
+	result = libesedb_table_export_arrow_batch(
+	          (libesedb_table_t *) &internal_table,
+	          0,
+	          4,
+	          NULL,
+	          0,
+	          &schema,
+	          &array,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "schema.release",
+	 schema.release );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "array.release",
+	 array.release );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "schema.n_children",
+	 schema.n_children,
+	 (int64_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "array.length",
+	 array.length,
+	 (int64_t) 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "array.n_children",
+	 array.n_children,
+	 (int64_t) 2 );
+
+	result = narrow_string_compare(
+	          schema.children[ 0 ]->format,
+	          "I",
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          schema.children[ 0 ]->name,
+	          "C1",
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          schema.children[ 1 ]->format,
+	          "s",
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "array.children[ 0 ]->null_count",
+	 array.children[ 0 ]->null_count,
+	 (int64_t) 0 );
+
+	values_32bit = (const uint32_t *) array.children[ 0 ]->buffers[ 1 ];
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "values_32bit",
+	 values_32bit );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 0 ]",
+	 values_32bit[ 0 ],
+	 (uint32_t) 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 1 ]",
+	 values_32bit[ 1 ],
+	 (uint32_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 2 ]",
+	 values_32bit[ 2 ],
+	 (uint32_t) 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 3 ]",
+	 values_32bit[ 3 ],
+	 (uint32_t) 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "array.children[ 1 ]->null_count",
+	 array.children[ 1 ]->null_count,
+	 (int64_t) 1 );
+
+	bitmap = (const uint8_t *) array.children[ 1 ]->buffers[ 0 ];
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "bitmap",
+	 bitmap );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "bitmap[ 0 ]",
+	 ( bitmap[ 0 ] & 0x0f ),
+	 (uint8_t) 0x0b );
+
+	values_16bit = (const int16_t *) array.children[ 1 ]->buffers[ 1 ];
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "values_16bit",
+	 values_16bit );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT16(
+	 "values_16bit[ 0 ]",
+	 values_16bit[ 0 ],
+	 (int16_t) 10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT16(
+	 "values_16bit[ 1 ]",
+	 values_16bit[ 1 ],
+	 (int16_t) 20 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT16(
+	 "values_16bit[ 3 ]",
+	 values_16bit[ 3 ],
+	 (int16_t) 40 );
+
+	schema.release(
+	 &schema );
+
+	array.release(
+	 &array );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "schema.release",
+	 schema.release );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "array.release",
+	 array.release );
+
+	/* Test a batch that starts in the first leaf page and ends in the second
+	 */
+	result = libesedb_table_export_arrow_batch(
+	          (libesedb_table_t *) &internal_table,
+	          1,
+	          2,
+	          column_entries,
+	          1,
+	          &schema,
+	          &array,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "array.length",
+	 array.length,
+	 (int64_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "array.children[ 0 ]->null_count",
+	 array.children[ 0 ]->null_count,
+	 (int64_t) 1 );
+
+	values_16bit = (const int16_t *) array.children[ 0 ]->buffers[ 1 ];
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "values_16bit",
+	 values_16bit );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT16(
+	 "values_16bit[ 0 ]",
+	 values_16bit[ 0 ],
+	 (int16_t) 20 );
+
+	schema.release(
+	 &schema );
+
+	array.release(
+	 &array );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_export_arrow_batch(
+	          NULL,
+	          0,
+	          4,
+	          NULL,
+	          0,
+	          &schema,
+	          &array,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_export_arrow_batch(
+	          (libesedb_table_t *) &internal_table,
+	          0,
+	          -1,
+	          NULL,
+	          0,
+	          &schema,
+	          &array,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_export_arrow_batch(
+	          (libesedb_table_t *) &internal_table,
+	          1,
+	          4,
+	          NULL,
+	          0,
+	          &schema,
+	          &array,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_export_arrow_batch(
+	          (libesedb_table_t *) &internal_table,
+	          0,
+	          4,
+	          NULL,
+	          0,
+	          NULL,
+	          &array,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_export_arrow_batch(
+	          (libesedb_table_t *) &internal_table,
+	          0,
+	          4,
+	          NULL,
+	          0,
+	          &schema,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_table_free_test_table(
+	          &internal_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an error in the middle of the batch
+	 * The next page of the first leaf page is set to a page outside the file
+	 * so that the batch fails after the records of the first leaf page were appended
+	 * The number of records is set since it can no longer be determined
+	 */
+	result = esedb_test_table_initialize_test_table(
+	          &internal_table,
+	          file_data,
+	          5 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_data[ ( 3 * 4096 ) + 20 ] ),
+	 7 );
+
+	internal_table.number_of_records        = 4;
+	internal_table.number_of_records_is_set = 1;
+
+	/* The release callbacks are set to verify they are cleared on error
+	 */
+	schema.release = &libesedb_arrow_schema_release;
+	array.release  = &libesedb_arrow_array_release;
+
+	result = libesedb_table_export_arrow_batch(
+	          (libesedb_table_t *) &internal_table,
+	          0,
+	          4,
+	          NULL,
+	          0,
+	          &schema,
+	          &array,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "schema.release",
+	 schema.release );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "array.release",
+	 array.release );
+
+	/* Clean up
+	 */
+	result = esedb_test_table_free_test_table(
+	          &internal_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( schema.release != NULL )
+	{
+		schema.release(
+		 &schema );
+	}
+	if( array.release != NULL )
+	{
+		array.release(
+		 &array );
+	}
+	esedb_test_table_free_test_table(
+	 &internal_table,
+	 NULL );
+
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -132,8 +1976,32 @@ int main(
 
 	/* TODO: add tests for libesedb_table_get_number_of_records */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_known_number_of_records",
+	 esedb_test_table_get_known_number_of_records );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_set_column_projection",
+	 esedb_test_table_set_column_projection );
+
 	/* TODO: add tests for libesedb_table_get_record */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_record_by_key",
+	 esedb_test_table_get_record_by_key );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_column_value_size",
+	 esedb_test_table_get_column_value_size );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_read_batch",
+	 esedb_test_table_read_batch );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_export_arrow_batch",
+	 esedb_test_table_export_arrow_batch );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
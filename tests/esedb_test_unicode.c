@@ -0,0 +1,659 @@
+/*
+ * Library Unicode functions test program
+ *
+ * Copyright (C) 2009-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_unicode.h"
+
+/* UTF-16 little-endian stream of 40 ASCII characters, 40 Cyrillic characters, U+20AC, A and U+00E9
+ */
+uint8_t esedb_test_unicode_utf16_stream[ 166 ] = {
+	0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00,
+	0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00,
+	0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00,
+	0x59, 0x00, 0x5a, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00,
+	0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00,
+	0x10, 0x04, 0x11, 0x04, 0x12, 0x04, 0x13, 0x04, 0x14, 0x04, 0x15, 0x04, 0x16, 0x04, 0x17, 0x04,
+	0x18, 0x04, 0x19, 0x04, 0x1a, 0x04, 0x1b, 0x04, 0x1c, 0x04, 0x1d, 0x04, 0x1e, 0x04, 0x1f, 0x04,
+	0x20, 0x04, 0x21, 0x04, 0x22, 0x04, 0x23, 0x04, 0x24, 0x04, 0x25, 0x04, 0x26, 0x04, 0x27, 0x04,
+	0x28, 0x04, 0x29, 0x04, 0x2a, 0x04, 0x2b, 0x04, 0x2c, 0x04, 0x2d, 0x04, 0x2e, 0x04, 0x2f, 0x04,
+	0x10, 0x04, 0x11, 0x04, 0x12, 0x04, 0x13, 0x04, 0x14, 0x04, 0x15, 0x04, 0x16, 0x04, 0x17, 0x04,
+	0xac, 0x20, 0x41, 0x00, 0xe9, 0x00
+};
+
+uint8_t esedb_test_unicode_utf8_string[ 127 ] = {
+	0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+	0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+	0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0xd0, 0x90, 0xd0, 0x91, 0xd0, 0x92, 0xd0, 0x93,
+	0xd0, 0x94, 0xd0, 0x95, 0xd0, 0x96, 0xd0, 0x97, 0xd0, 0x98, 0xd0, 0x99, 0xd0, 0x9a, 0xd0, 0x9b,
+	0xd0, 0x9c, 0xd0, 0x9d, 0xd0, 0x9e, 0xd0, 0x9f, 0xd0, 0xa0, 0xd0, 0xa1, 0xd0, 0xa2, 0xd0, 0xa3,
+	0xd0, 0xa4, 0xd0, 0xa5, 0xd0, 0xa6, 0xd0, 0xa7, 0xd0, 0xa8, 0xd0, 0xa9, 0xd0, 0xaa, 0xd0, 0xab,
+	0xd0, 0xac, 0xd0, 0xad, 0xd0, 0xae, 0xd0, 0xaf, 0xd0, 0x90, 0xd0, 0x91, 0xd0, 0x92, 0xd0, 0x93,
+	0xd0, 0x94, 0xd0, 0x95, 0xd0, 0x96, 0xd0, 0x97, 0xe2, 0x82, 0xac, 0x41, 0xc3, 0xa9, 0x00
+};
+
+/* UTF-16 little-endian stream of "A", an end of string character and "B"
+ */
+uint8_t esedb_test_unicode_terminated_utf16_stream[ 6 ] = {
+	0x41, 0x00, 0x00, 0x00, 0x42, 0x00
+};
+
+/* UTF-16 little-endian stream of a surrogate pair
+ */
+uint8_t esedb_test_unicode_surrogates_utf16_stream[ 4 ] = {
+	0x3d, 0xd8, 0x00, 0xde
+};
+
+/* UTF-16 little-endian stream of a byte order mark and "A"
+ */
+uint8_t esedb_test_unicode_byte_order_mark_utf16_stream[ 4 ] = {
+	0xff, 0xfe, 0x41, 0x00
+};
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_unicode_utf8_string_size_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_unicode_utf8_string_size_from_utf16_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_unicode_utf8_string_size_from_utf16_stream(
+	          esedb_test_unicode_utf16_stream,
+	          166,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 127 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_unicode_utf8_string_size_from_utf16_stream(
+	          esedb_test_unicode_terminated_utf16_stream,
+	          6,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test unsupported streams
+	 */
+	result = libesedb_unicode_utf8_string_size_from_utf16_stream(
+	          esedb_test_unicode_surrogates_utf16_stream,
+	          4,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_unicode_utf8_string_size_from_utf16_stream(
+	          esedb_test_unicode_byte_order_mark_utf16_stream,
+	          4,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_unicode_utf8_string_size_from_utf16_stream(
+	          esedb_test_unicode_utf16_stream,
+	          165,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_unicode_utf8_string_size_from_utf16_stream(
+	          esedb_test_unicode_utf16_stream,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_unicode_utf8_string_size_from_utf16_stream(
+	          NULL,
+	          166,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_unicode_utf8_string_size_from_utf16_stream(
+	          esedb_test_unicode_utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_unicode_utf8_string_size_from_utf16_stream(
+	          esedb_test_unicode_utf16_stream,
+	          166,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_unicode_utf8_string_copy_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_unicode_utf8_string_copy_from_utf16_stream(
+     void )
+{
+	uint8_t utf8_string[ 128 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_unicode_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          128,
+	          esedb_test_unicode_utf16_stream,
+	          166,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          esedb_test_unicode_utf8_string,
+	          127 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_unicode_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          128,
+	          esedb_test_unicode_terminated_utf16_stream,
+	          6,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "A",
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test unsupported streams
+	 */
+	result = libesedb_unicode_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          128,
+	          esedb_test_unicode_surrogates_utf16_stream,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_unicode_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          128,
+	          esedb_test_unicode_byte_order_mark_utf16_stream,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_unicode_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          126,
+	          esedb_test_unicode_utf16_stream,
+	          166,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_unicode_utf8_string_copy_from_utf16_stream(
+	          NULL,
+	          128,
+	          esedb_test_unicode_utf16_stream,
+	          166,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_unicode_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          esedb_test_unicode_utf16_stream,
+	          166,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_unicode_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          128,
+	          NULL,
+	          166,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_unicode_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          128,
+	          esedb_test_unicode_utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_unicode_set_instruction_set function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_unicode_set_instruction_set(
+     void )
+{
+	uint8_t utf8_string[ 128 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t utf8_string_size       = 0;
+	int instruction_set           = 0;
+	int result                    = 0;
+	int supported_instruction_set = 0;
+
+	result = libesedb_unicode_get_supported_instruction_set(
+	          &supported_instruction_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( instruction_set = LIBESEDB_UNICODE_INSTRUCTION_SET_NONE;
+	     instruction_set <= supported_instruction_set;
+	     instruction_set++ )
+	{
+		result = libesedb_unicode_set_instruction_set(
+		          instruction_set,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_unicode_utf8_string_size_from_utf16_stream(
+		          esedb_test_unicode_utf16_stream,
+		          166,
+		          &utf8_string_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_size",
+		 utf8_string_size,
+		 (size_t) 127 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_unicode_utf8_string_copy_from_utf16_stream(
+		          utf8_string,
+		          128,
+		          esedb_test_unicode_utf16_stream,
+		          166,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf8_string,
+		          esedb_test_unicode_utf8_string,
+		          127 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libesedb_unicode_set_instruction_set(
+	          supported_instruction_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_unicode_set_instruction_set(
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_unicode_get_instruction_set(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_unicode_utf8_string_size_from_utf16_stream",
+	 esedb_test_unicode_utf8_string_size_from_utf16_stream );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_unicode_utf8_string_copy_from_utf16_stream",
+	 esedb_test_unicode_utf8_string_copy_from_utf16_stream );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_unicode_set_instruction_set",
+	 esedb_test_unicode_set_instruction_set );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "catalog catalog_definition checksum column column_type compression data_definition data_segment database error file_header index io_handle key long_value multi_value notify page page_tree page_value record table table_definition"
+$LibraryTests = "arrow catalog catalog_definition checksum column column_type compression cursor data_definition data_segment database error file_header filter huffman_tree index io_handle key long_value multi_value notify page page_tree page_value record record_layout table table_definition unicode"
 $LibraryTestsWithInput = "file support"
 
 $InputGlob = "*"
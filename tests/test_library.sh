@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="catalog catalog_definition checksum column column_type compression data_definition data_segment database error file_header index io_handle key long_value multi_value notify page page_tree page_value record table table_definition";
+LIBRARY_TESTS="arrow catalog catalog_definition checksum column column_type compression cursor data_definition data_segment database error file_header filter huffman_tree index io_handle key long_value multi_value notify page page_tree page_value record record_layout table table_definition unicode";
 LIBRARY_TESTS_WITH_INPUT="file support";
 OPTION_SETS="";
 